@@ -0,0 +1,40 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <Kodgen/Parsing/ParsingSettings.h>
+#include <Kodgen/Misc/FundamentalTypes.h>
+
+class BenchmarkHelpers
+{
+	public:
+		BenchmarkHelpers()	= delete;
+		~BenchmarkHelpers()	= delete;
+
+		/**
+		*	@brief Setup parsing settings the same way as the CppProperties example.
+		*
+		*	@param parsingSettings Settings to setup.
+		*
+		*	@return true if a compiler could be set for the current platform, else false.
+		*/
+		static bool				initParsingSettings(kodgen::ParsingSettings& parsingSettings)	noexcept;
+
+		/**
+		*	@brief Get the value at the provided percentile of a sorted collection.
+		*
+		*	@param sortedValues	Values sorted in ascending order.
+		*	@param percentile	Percentile in the range [0, 100].
+		*
+		*	@return The value at the provided percentile (nearest rank), or 0 if the collection is empty.
+		*/
+		static double			getPercentile(std::vector<double> const&	sortedValues,
+											  double						percentile)			noexcept;
+};
\ No newline at end of file
@@ -0,0 +1,119 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <Kodgen/Misc/Filesystem.h>
+#include <Kodgen/Misc/FundamentalTypes.h>
+
+/**
+*	Settings describing the shape of a synthetic header corpus.
+*/
+struct CorpusSettings
+{
+	/** Number of headers to generate. */
+	kodgen::uint32	fileCount			= 64u;
+
+	/** Number of reflected classes per header. */
+	kodgen::uint32	classesPerFile		= 4u;
+
+	/** Number of fields per class. */
+	kodgen::uint32	fieldsPerClass		= 8u;
+
+	/** Number of methods per class. */
+	kodgen::uint32	methodsPerClass		= 4u;
+
+	/** Number of reflected enums per header. */
+	kodgen::uint32	enumsPerFile		= 2u;
+
+	/** Number of values per enum. */
+	kodgen::uint32	enumValuesPerEnum	= 8u;
+
+	/** Ratio (between 0 and 1) of fields and methods annotated with a reflection macro. */
+	float			annotationDensity	= 0.5f;
+
+	/** Number of nested namespaces surrounding the entities of each header. */
+	kodgen::uint32	nestingDepth		= 2u;
+
+	/** Number of other corpus headers included by each header. */
+	kodgen::uint32	includeFanOut		= 2u;
+
+	/** Seed of the pseudo-random generator. A same seed and same settings always produce the same corpus. */
+	kodgen::uint64	seed				= 42u;
+};
+
+/**
+*	Generate a deterministic corpus of annotated headers compatible with the CppProperties example modules.
+*	The output doesn't depend on the standard library implementation so that results can be compared across machines.
+*/
+class CorpusGenerator
+{
+	private:
+		/** State of the pseudo-random generator. */
+		kodgen::uint64	_rngState;
+
+		/**
+		*	@brief Get the next pseudo-random number (splitmix64).
+		*
+		*	@return The next pseudo-random number.
+		*/
+		kodgen::uint64	nextRandom()												noexcept;
+
+		/**
+		*	@brief Get a pseudo-random number in the range [0, max[.
+		*
+		*	@param max Upper bound of the range (exclusive). Must not be 0.
+		*
+		*	@return The pseudo-random number.
+		*/
+		kodgen::uint64	nextRandom(kodgen::uint64 max)								noexcept;
+
+		/**
+		*	@brief Roll a pseudo-random boolean.
+		*
+		*	@param probability Probability to return true.
+		*
+		*	@return true with the provided probability, else false.
+		*/
+		bool			nextBool(float probability)									noexcept;
+
+		/**
+		*	@brief Generate the content of a corpus header.
+		*
+		*	@param settings		Corpus settings.
+		*	@param fileIndex	Index of the header in the corpus.
+		*
+		*	@return The header content.
+		*/
+		std::string		generateHeader(CorpusSettings const&	settings,
+									   kodgen::uint32			fileIndex)			noexcept;
+
+	public:
+		/**
+		*	@brief Get the name of a corpus header, without extension.
+		*
+		*	@param fileIndex Index of the header in the corpus.
+		*
+		*	@return The header name.
+		*/
+		static std::string	getFileName(kodgen::uint32 fileIndex)					noexcept;
+
+		/**
+		*	@brief	Generate a corpus in the provided directory.
+		*			The directory is cleared before the corpus is generated.
+		*
+		*	@param settings		Corpus settings.
+		*	@param directory	Directory the headers are written to.
+		*
+		*	@return The paths to all generated headers, or an empty vector if the corpus could not be written.
+		*/
+		std::vector<fs::path>	generate(CorpusSettings const&	settings,
+										 fs::path const&		directory)			noexcept;
+};
\ No newline at end of file
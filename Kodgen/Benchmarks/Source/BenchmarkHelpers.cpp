@@ -0,0 +1,46 @@
+#include "BenchmarkHelpers.h"
+
+#include <algorithm>	//std::min, std::max
+
+bool BenchmarkHelpers::initParsingSettings(kodgen::ParsingSettings& parsingSettings) noexcept
+{
+	//Same settings as the CppProperties example
+	parsingSettings.shouldAbortParsingOnFirstError = true;
+
+	parsingSettings.propertyParsingSettings.propertySeparator		= ',';
+	parsingSettings.propertyParsingSettings.argumentEnclosers[0]	= '[';
+	parsingSettings.propertyParsingSettings.argumentEnclosers[1]	= ']';
+	parsingSettings.propertyParsingSettings.argumentSeparator		= ',';
+
+	parsingSettings.propertyParsingSettings.namespaceMacroName	= "KGNamespace";
+	parsingSettings.propertyParsingSettings.classMacroName		= "KGClass";
+	parsingSettings.propertyParsingSettings.structMacroName		= "KGStruct";
+	parsingSettings.propertyParsingSettings.variableMacroName	= "KGVariable";
+	parsingSettings.propertyParsingSettings.fieldMacroName		= "KGField";
+	parsingSettings.propertyParsingSettings.functionMacroName	= "KGFunction";
+	parsingSettings.propertyParsingSettings.methodMacroName		= "KGMethod";
+	parsingSettings.propertyParsingSettings.enumMacroName		= "KGEnum";
+	parsingSettings.propertyParsingSettings.enumValueMacroName	= "KGEnumVal";
+
+#if defined(__GNUC__)
+	return parsingSettings.setCompilerExeName("g++");
+#elif defined(__clang__)
+	return parsingSettings.setCompilerExeName("clang++");
+#elif defined(_MSC_VER)
+	return parsingSettings.setCompilerExeName("msvc");
+#else
+	return false;	//Unsupported compiler
+#endif
+}
+
+double BenchmarkHelpers::getPercentile(std::vector<double> const& sortedValues, double percentile) noexcept
+{
+	if (sortedValues.empty())
+	{
+		return 0.0;
+	}
+
+	size_t rank = static_cast<size_t>(percentile / 100.0 * sortedValues.size() + 0.999999);
+
+	return sortedValues[std::min(std::max(rank, size_t(1u)), sortedValues.size()) - 1u];
+}
\ No newline at end of file
@@ -0,0 +1,153 @@
+#include "CorpusGenerator.h"
+
+#include <fstream>
+#include <algorithm>	//std::min
+#include <iterator>	//std::size
+
+std::string CorpusGenerator::getFileName(kodgen::uint32 fileIndex) noexcept
+{
+	return "BenchFile" + std::to_string(fileIndex);
+}
+
+kodgen::uint64 CorpusGenerator::nextRandom() noexcept
+{
+	kodgen::uint64 result = (_rngState += 0x9E3779B97F4A7C15u);
+
+	result = (result ^ (result >> 30u)) * 0xBF58476D1CE4E5B9u;
+	result = (result ^ (result >> 27u)) * 0x94D049BB133111EBu;
+
+	return result ^ (result >> 31u);
+}
+
+kodgen::uint64 CorpusGenerator::nextRandom(kodgen::uint64 max) noexcept
+{
+	return nextRandom() % max;
+}
+
+bool CorpusGenerator::nextBool(float probability) noexcept
+{
+	return static_cast<float>(nextRandom(1000000u)) < probability * 1000000.0f;
+}
+
+std::vector<fs::path> CorpusGenerator::generate(CorpusSettings const& settings, fs::path const& directory) noexcept
+{
+	std::vector<fs::path>	result;
+	std::error_code			errorCode;
+
+	_rngState = settings.seed;
+
+	fs::remove_all(directory, errorCode);
+	fs::create_directories(directory, errorCode);
+
+	if (errorCode)
+	{
+		return result;
+	}
+
+	result.reserve(settings.fileCount);
+
+	for (kodgen::uint32 i = 0u; i < settings.fileCount; i++)
+	{
+		fs::path		file = directory / (getFileName(i) + ".h");
+		std::ofstream	stream(file, std::ios::out | std::ios::trunc);
+
+		stream << generateHeader(settings, i);
+
+		if (!stream.good())
+		{
+			result.clear();
+			break;
+		}
+
+		result.emplace_back(std::move(file));
+	}
+
+	return result;
+}
+
+std::string CorpusGenerator::generateHeader(CorpusSettings const& settings, kodgen::uint32 fileIndex) noexcept
+{
+	static constexpr char const* fieldTypes[] = { "int", "float", "double", "unsigned long long", "std::string", "std::vector<int>" };
+	static constexpr char const* getArguments[] = { "", "[const]", "[const, &]", "[explicit]", "[const, *]" };
+
+	std::string	fileName	= getFileName(fileIndex);
+	std::string	result		= "#pragma once\n\n#include <string>\n#include <vector>\n\n";
+
+	//Include previous headers only to avoid cycles
+	kodgen::uint32 includeCount = std::min(settings.includeFanOut, fileIndex);
+
+	for (kodgen::uint32 i = 0u; i < includeCount; i++)
+	{
+		result += "#include \"" + getFileName(static_cast<kodgen::uint32>(nextRandom(fileIndex))) + ".h\"\n";
+	}
+
+	result += "\n#include \"Generated/" + fileName + ".h.h\"\n\n";
+
+	//Namespaces
+	std::string namespacePrefix;
+
+	for (kodgen::uint32 depth = 0u; depth < settings.nestingDepth; depth++)
+	{
+		std::string namespaceName = "bench" + std::to_string(depth);
+
+		result			+= std::string(depth, '\t') + "namespace " + namespaceName + " KGNamespace()\n" + std::string(depth, '\t') + "{\n";
+		namespacePrefix	+= namespaceName + "_";
+	}
+
+	std::string indent(settings.nestingDepth, '\t');
+
+	//Enums
+	for (kodgen::uint32 enumIndex = 0u; enumIndex < settings.enumsPerFile; enumIndex++)
+	{
+		result += indent + "enum class KGEnum() " + fileName + "Enum" + std::to_string(enumIndex) + "\n" + indent + "{\n";
+
+		for (kodgen::uint32 valueIndex = 0u; valueIndex < settings.enumValuesPerEnum; valueIndex++)
+		{
+			result += indent + "\tValue" + std::to_string(valueIndex) + ((nextBool(settings.annotationDensity)) ? " KGEnumVal()" : "") + ",\n";
+		}
+
+		result += indent + "};\n\n";
+	}
+
+	//Classes
+	for (kodgen::uint32 classIndex = 0u; classIndex < settings.classesPerFile; classIndex++)
+	{
+		std::string className = fileName + "Class" + std::to_string(classIndex);
+
+		result += indent + "class KGClass() " + className + "\n" + indent + "{\n" + indent + "\tprivate:\n";
+
+		for (kodgen::uint32 fieldIndex = 0u; fieldIndex < settings.fieldsPerClass; fieldIndex++)
+		{
+			if (nextBool(settings.annotationDensity))
+			{
+				result += indent + "\t\tKGField(Get" + getArguments[nextRandom(std::size(getArguments))] + ((nextBool(0.5f)) ? ", Set)\n" : ")\n");
+			}
+
+			result += indent + "\t\t" + fieldTypes[nextRandom(std::size(fieldTypes))] + " _field" + std::to_string(fieldIndex) + ";\n\n";
+		}
+
+		result += indent + "\tpublic:\n";
+
+		for (kodgen::uint32 methodIndex = 0u; methodIndex < settings.methodsPerClass; methodIndex++)
+		{
+			if (nextBool(settings.annotationDensity))
+			{
+				result += indent + "\t\tKGMethod()\n";
+			}
+
+			result += indent + "\t\tint method" + std::to_string(methodIndex) + "(int value, float const& factor) const;\n\n";
+		}
+
+		result += indent + "\t" + namespacePrefix + className + "_GENERATED\n" + indent + "};\n\n";
+	}
+
+	//Close namespaces
+	for (kodgen::uint32 depth = settings.nestingDepth; depth > 0u; depth--)
+	{
+		result += std::string(depth - 1u, '\t') + "}\n";
+	}
+
+	result += "\nFile_" + fileName + "_GENERATED\n";
+
+	return result;
+}
\ No newline at end of file
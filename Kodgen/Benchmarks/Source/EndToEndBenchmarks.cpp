@@ -0,0 +1,300 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <algorithm>
+#include <unordered_map>
+#include <limits>
+#include <cerrno>
+#include <cmath>	//std::isfinite
+#include <cstdlib>	//std::strtoull, std::strtof
+
+#include <Kodgen/Parsing/FileParser.h>
+#include <Kodgen/CodeGen/CodeGenManager.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnit.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+#include <Kodgen/Misc/DefaultLogger.h>
+
+#include "GetSetCGM.h"
+#include "CorpusGenerator.h"
+#include "BenchmarkHelpers.h"
+
+struct BenchmarkSettings
+{
+	/** Shape of the generated corpus. */
+	CorpusSettings				corpus;
+
+	/** Thread counts to benchmark. */
+	std::vector<kodgen::uint32>	threadCounts	= { 1u, 2u, 4u, 8u };
+
+	/** Number of runs per thread count. */
+	kodgen::uint32				repetitions		= 3u;
+
+	/** Directory the corpus is generated in. */
+	fs::path					workingDirectory	= fs::temp_directory_path() / "KodgenBenchmarkCorpus";
+
+	/** File the results are appended to. Results are printed to the standard output if empty. */
+	fs::path					outputFile;
+};
+
+void printUsage()
+{
+	std::cerr	<< "Usage: KodgenBenchmarks [--files N] [--classes N] [--fields N] [--methods N] [--enums N] [--enum-values N]\n"
+				<< "                        [--annotation-density F] [--nesting N] [--include-fanout N] [--seed N]\n"
+				<< "                        [--threads N,N,...] [--repetitions N] [--working-dir PATH] [--output FILE]" << std::endl;
+}
+
+/**
+*	@brief Parse an unsigned integer argument value.
+*
+*	@param value		Value to parse.
+*	@param maxValue		Largest accepted value.
+*	@param out_value	Parsed value.
+*
+*	@return true if the whole value is a number in [0, maxValue], else false.
+*/
+bool parseUnsigned(std::string const& value, kodgen::uint64 maxValue, kodgen::uint64& out_value)
+{
+	char* end = nullptr;
+
+	errno = 0;
+
+	//strtoull accepts a leading minus sign and wraps the result around, so only digits are accepted
+	if (value.empty() || !std::all_of(value.cbegin(), value.cend(), [](char c) { return c >= '0' && c <= '9'; }))
+	{
+		return false;
+	}
+
+	out_value = std::strtoull(value.c_str(), &end, 10);
+
+	return errno == 0 && *end == '\0' && out_value <= maxValue;
+}
+
+template <typename T>
+bool parseUnsigned(std::string const& value, T& out_value)
+{
+	kodgen::uint64 parsedValue;
+
+	if (!parseUnsigned(value, std::numeric_limits<T>::max(), parsedValue))
+	{
+		return false;
+	}
+
+	out_value = static_cast<T>(parsedValue);
+
+	return true;
+}
+
+/**
+*	@brief Parse a floating point argument value.
+*
+*	@param value		Value to parse.
+*	@param out_value	Parsed value.
+*
+*	@return true if the whole value is a finite number, else false.
+*/
+bool parseFloat(std::string const& value, float& out_value)
+{
+	char* end = nullptr;
+
+	errno = 0;
+	out_value = std::strtof(value.c_str(), &end);
+
+	return !value.empty() && errno == 0 && *end == '\0' && std::isfinite(out_value);
+}
+
+bool parseArguments(int argc, char** argv, BenchmarkSettings& out_settings)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+
+		if (argument == "--help" || i + 1 >= argc)
+		{
+			printUsage();
+
+			return false;
+		}
+
+		std::string	value = argv[++i];
+		bool		isValid	= true;
+
+		if		(argument == "--files")					isValid = parseUnsigned(value, out_settings.corpus.fileCount);
+		else if (argument == "--classes")				isValid = parseUnsigned(value, out_settings.corpus.classesPerFile);
+		else if (argument == "--fields")				isValid = parseUnsigned(value, out_settings.corpus.fieldsPerClass);
+		else if (argument == "--methods")				isValid = parseUnsigned(value, out_settings.corpus.methodsPerClass);
+		else if (argument == "--enums")					isValid = parseUnsigned(value, out_settings.corpus.enumsPerFile);
+		else if (argument == "--enum-values")			isValid = parseUnsigned(value, out_settings.corpus.enumValuesPerEnum);
+		else if (argument == "--annotation-density")	isValid = parseFloat(value, out_settings.corpus.annotationDensity);
+		else if (argument == "--nesting")				isValid = parseUnsigned(value, out_settings.corpus.nestingDepth);
+		else if (argument == "--include-fanout")		isValid = parseUnsigned(value, out_settings.corpus.includeFanOut);
+		else if (argument == "--seed")					isValid = parseUnsigned(value, out_settings.corpus.seed);
+		else if (argument == "--repetitions")			isValid = parseUnsigned(value, out_settings.repetitions) && out_settings.repetitions > 0u;
+		else if (argument == "--working-dir")			out_settings.workingDirectory			= fs::path(value) / "KodgenBenchmarkCorpus";
+		else if (argument == "--output")				out_settings.outputFile					= value;
+		else if (argument == "--threads")
+		{
+			std::stringstream	stream(value);
+			std::string			threadCount;
+
+			out_settings.threadCounts.clear();
+
+			while (isValid && std::getline(stream, threadCount, ','))
+			{
+				out_settings.threadCounts.emplace_back();
+
+				isValid = parseUnsigned(threadCount, out_settings.threadCounts.back());
+			}
+
+			isValid &= !out_settings.threadCounts.empty();
+		}
+		else
+		{
+			std::cerr << "Unknown argument: " << argument << std::endl;
+
+			return false;
+		}
+
+		if (!isValid)
+		{
+			std::cerr << "Invalid value for " << argument << ": " << value << std::endl;
+			printUsage();
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
+kodgen::CodeGenResult runGeneration(BenchmarkSettings const& settings, kodgen::uint32 threadCount)
+{
+	fs::path includeDirectory = settings.workingDirectory / "Include";
+
+	kodgen::FileParser fileParser;
+	BenchmarkHelpers::initParsingSettings(fileParser.getSettings());
+
+	kodgen::MacroCodeGenUnitSettings cguSettings;
+	cguSettings.setOutputDirectory(includeDirectory / "Generated");
+	cguSettings.setGeneratedHeaderFileNamePattern("##FILENAME##.h.h");
+	cguSettings.setGeneratedSourceFileNamePattern("##FILENAME##.src.h");
+	cguSettings.setClassFooterMacroPattern("##CLASSFULLNAME##_GENERATED");
+	cguSettings.setHeaderFileFooterMacroPattern("File_##FILENAME##_GENERATED");
+
+	kodgen::MacroCodeGenUnit codeGenUnit;
+	codeGenUnit.setSettings(cguSettings);
+
+	GetSetCGM getSetCodeGenModule;
+	codeGenUnit.addModule(getSetCodeGenModule);
+
+	kodgen::CodeGenManager codeGenMgr(threadCount);
+	codeGenMgr.settings.addToProcessDirectory(includeDirectory);
+	codeGenMgr.settings.addIgnoredDirectory(includeDirectory / "Generated");
+	codeGenMgr.settings.addSupportedFileExtension(".h");
+
+	//Always regenerate all files so that all runs process the same amount of work
+	return codeGenMgr.run(fileParser, codeGenUnit, true);
+}
+
+std::string runBenchmark(BenchmarkSettings const& settings, kodgen::uint32 threadCount)
+{
+	std::vector<double>	durations;
+	std::vector<double>	fileLatencies;
+	bool				completed					= true;
+	size_t				fileCount					= 0u;
+	kodgen::uint64		peakTranslationUnitsMemory	= 0u;
+
+	for (kodgen::uint32 i = 0u; i < settings.repetitions; i++)
+	{
+		kodgen::CodeGenResult result = runGeneration(settings, threadCount);
+
+		//Per file latency is the cumulated parsing and generation time of a file over all iterations
+		std::unordered_map<std::string, double> latencies;
+
+		for (kodgen::TimingSpan const& span : result.timings.spans)
+		{
+			if (std::strcmp(span.category, "File") == 0)
+			{
+				latencies[span.detail] += span.duration * 0.001;
+			}
+		}
+
+		for (auto const& [file, latency] : latencies)
+		{
+			fileLatencies.push_back(latency);
+		}
+
+		durations.push_back(result.duration);
+		completed	&= result.completed;
+		fileCount	= latencies.size();
+
+		//The process peak RSS would include the previous thread counts, so the memory of this configuration is measured by its translation units
+		peakTranslationUnitsMemory = std::max(peakTranslationUnitsMemory, result.peakTranslationUnitsMemory);
+	}
+
+	std::sort(durations.begin(), durations.end());
+	std::sort(fileLatencies.begin(), fileLatencies.end());
+
+	double medianDuration = BenchmarkHelpers::getPercentile(durations, 50.0);
+
+	std::stringstream stream;
+
+	stream	<< "{\"benchmark\":\"EndToEnd\""
+			<< ",\"threads\":" << threadCount
+			<< ",\"files\":" << fileCount
+			<< ",\"classesPerFile\":" << settings.corpus.classesPerFile
+			<< ",\"fieldsPerClass\":" << settings.corpus.fieldsPerClass
+			<< ",\"seed\":" << settings.corpus.seed
+			<< ",\"repetitions\":" << settings.repetitions
+			<< ",\"completed\":" << (completed ? "true" : "false")
+			<< ",\"medianSeconds\":" << medianDuration
+			<< ",\"filesPerSecond\":" << ((medianDuration > 0.0) ? fileCount / medianDuration : 0.0)
+			<< ",\"p50FileMs\":" << BenchmarkHelpers::getPercentile(fileLatencies, 50.0)
+			<< ",\"p99FileMs\":" << BenchmarkHelpers::getPercentile(fileLatencies, 99.0)
+			<< ",\"peakTranslationUnitsKiB\":" << peakTranslationUnitsMemory / 1024u
+			<< "}";
+
+	return stream.str();
+}
+
+int main(int argc, char** argv)
+{
+	BenchmarkSettings settings;
+
+	if (!parseArguments(argc, argv, settings))
+	{
+		return EXIT_FAILURE;
+	}
+
+	kodgen::DefaultLogger logger;
+
+	if (CorpusGenerator().generate(settings.corpus, settings.workingDirectory / "Include").empty())
+	{
+		logger.log("Failed to generate the corpus in " + settings.workingDirectory.string(), kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_FAILURE;
+	}
+
+	//Warm-up run: generates the files included by the corpus headers and fills the filesystem caches
+	if (!runGeneration(settings, settings.threadCounts.empty() ? 0u : settings.threadCounts.front()).completed)
+	{
+		logger.log("Warm-up generation failed.", kodgen::ILogger::ELogSeverity::Error);
+		return EXIT_FAILURE;
+	}
+
+	std::ofstream outputStream;
+
+	if (!settings.outputFile.empty())
+	{
+		outputStream.open(settings.outputFile, std::ios::out | std::ios::app);
+	}
+
+	//One JSON object per line so that results can be appended to a file and tracked over time
+	for (kodgen::uint32 threadCount : settings.threadCounts)
+	{
+		std::string result = runBenchmark(settings, threadCount);
+
+		(outputStream.is_open() ? static_cast<std::ostream&>(outputStream) : std::cout) << result << std::endl;
+	}
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -0,0 +1,394 @@
+#include <iostream>
+#include <chrono>
+#include <algorithm>
+
+#include <clang-c/Index.h>
+
+#include <Kodgen/Parsing/FileParser.h>
+#include <Kodgen/Parsing/PropertyParser.h>
+#include <Kodgen/InfoStructures/TypeInfo.h>
+#include <Kodgen/InfoStructures/FrozenStructClassTree.h>
+#include <Kodgen/CodeGen/CodeGenUnit.h>
+#include <Kodgen/CodeGen/CodeGenModule.h>
+#include <Kodgen/Threading/ThreadPool.h>
+
+#include "CorpusGenerator.h"
+#include "BenchmarkHelpers.h"
+
+/** Number of timed runs per benchmark, the median run is reported. */
+static constexpr kodgen::uint32 repetitions = 7u;
+
+/** Accumulates benchmark outputs so that the compiler can't discard the measured work. */
+static volatile kodgen::uint64 sink = 0u;
+
+/**
+*	@brief	Run a benchmark and print its result as a JSON line.
+*			The function is run once to warm up, then repetitions times.
+*
+*	@param name				Name of the benchmark.
+*	@param parameters		Value of the benchmark parameter (thread count, generator count...).
+*	@param operationCount	Number of operations performed by a single function call.
+*	@param function			Function to measure.
+*/
+template <typename Function>
+void runMicroBenchmark(char const* name, kodgen::uint64 parameter, kodgen::uint64 operationCount, Function&& function)
+{
+	std::vector<double> nsPerOperation;
+
+	function();
+
+	for (kodgen::uint32 i = 0u; i < repetitions; i++)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		function();
+
+		nsPerOperation.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / operationCount);
+	}
+
+	std::sort(nsPerOperation.begin(), nsPerOperation.end());
+
+	std::cout	<< "{\"benchmark\":\"" << name << "\""
+				<< ",\"parameter\":" << parameter
+				<< ",\"operations\":" << operationCount
+				<< ",\"medianNsPerOp\":" << BenchmarkHelpers::getPercentile(nsPerOperation, 50.0)
+				<< ",\"minNsPerOp\":" << nsPerOperation.front()
+				<< "}" << std::endl;
+}
+
+void benchmarkPropertyParser(kodgen::ParsingSettings const& parsingSettings)
+{
+	static std::string const annotations[] =
+	{
+		"KGF:Get",
+		"KGF:Get[const, &], Set",
+		"KGF:Get[explicit], Set, CustomProperty",
+		"KGF:Range[0, 100], Tooltip[\"Some quite long tooltip, with separators\"], Get[const, *], Set",
+		"KGF:Serialize, Replicate[Reliable, OwnerOnly], Category[Gameplay], DisplayName[\"Field name\"], EditAnywhere"
+	};
+
+	constexpr kodgen::uint64 const callsPerAnnotation = 2000u;
+
+	kodgen::PropertyParser propertyParser;
+	propertyParser.setup(parsingSettings.propertyParsingSettings);
+
+	runMicroBenchmark("PropertyParser.getFieldProperties", std::size(annotations), std::size(annotations) * callsPerAnnotation, [&propertyParser]()
+	{
+		for (kodgen::uint64 i = 0u; i < callsPerAnnotation; i++)
+		{
+			for (std::string const& annotation : annotations)
+			{
+				auto properties = propertyParser.getFieldProperties(annotation);
+
+				sink = sink + (properties.has_value() ? properties->size() : 0u);
+
+				propertyParser.clean();
+			}
+		}
+	});
+}
+
+void benchmarkTypeInfo(kodgen::ParsingSettings const& parsingSettings)
+{
+	static char const* const source =
+		"#include <string>\n"
+		"#include <vector>\n"
+		"#include <map>\n"
+		"#include <memory>\n"
+		"namespace ns { template <typename T> class Wrapper { T value; }; struct Data { int i; }; }\n"
+		"struct Fields\n"
+		"{\n"
+		"	int										a;\n"
+		"	float const*							b;\n"
+		"	double&									c;\n"
+		"	unsigned long long const* const*		d;\n"
+		"	std::string								e;\n"
+		"	std::vector<int>						f;\n"
+		"	std::map<std::string, ns::Data*>		g;\n"
+		"	std::unique_ptr<ns::Wrapper<ns::Data>>	h;\n"
+		"	ns::Wrapper<std::vector<float>> const&	i;\n"
+		"	int										j[16];\n"
+		"};\n";
+
+	static char const* const fileName = "KodgenTypeInfoBenchmark.h";
+
+	CXUnsavedFile	unsavedFile	{ fileName, source, static_cast<unsigned long>(std::char_traits<char>::length(source)) };
+	CXIndex			index		= clang_createIndex(0, 0);
+
+	CXTranslationUnit translationUnit = clang_parseTranslationUnit(index, fileName, parsingSettings.getCompilationArguments().data(), static_cast<int>(parsingSettings.getCompilationArguments().size()),
+																	&unsavedFile, 1u, CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing);
+
+	if (translationUnit == nullptr)
+	{
+		std::cerr << "Failed to parse the TypeInfo benchmark translation unit." << std::endl;
+	}
+	else
+	{
+		//Collect the types of all fields declared in the main file
+		std::vector<CXType> types;
+
+		clang_visitChildren(clang_getTranslationUnitCursor(translationUnit), [](CXCursor cursor, CXCursor, CXClientData clientData)
+		{
+			if (!clang_Location_isFromMainFile(clang_getCursorLocation(cursor)))
+			{
+				return CXChildVisit_Continue;
+			}
+
+			if (cursor.kind == CXCursor_FieldDecl)
+			{
+				reinterpret_cast<std::vector<CXType>*>(clientData)->push_back(clang_getCursorType(cursor));
+			}
+
+			return CXChildVisit_Recurse;
+		}, &types);
+
+		constexpr kodgen::uint64 const passes = 200u;
+
+		runMicroBenchmark("TypeInfo.construct", types.size(), types.size() * passes, [&types]()
+		{
+			for (kodgen::uint64 i = 0u; i < passes; i++)
+			{
+				for (CXType const& type : types)
+				{
+					kodgen::TypeInfo typeInfo(type);
+
+					sink = sink + typeInfo.sizeInBytes;
+				}
+			}
+		});
+
+		clang_disposeTranslationUnit(translationUnit);
+	}
+
+	clang_disposeIndex(index);
+}
+
+void benchmarkThreadPool()
+{
+	constexpr kodgen::uint64 const independentTaskCount	= 20000u;
+	constexpr kodgen::uint64 const dependentTaskCount	= 2000u;
+
+	for (kodgen::uint32 threadCount = 1u; threadCount <= 128u; threadCount *= 2u)
+	{
+		kodgen::ThreadPool threadPool(threadCount);
+
+		//Submission and dispatch overhead of tasks doing nothing
+		runMicroBenchmark("ThreadPool.submitEmptyTask", threadCount, independentTaskCount, [&threadPool]()
+		{
+			for (kodgen::uint64 i = 0u; i < independentTaskCount; i++)
+			{
+				threadPool.submitTask("Empty", [](kodgen::TaskBase*) {});
+			}
+
+			threadPool.joinWorkers();
+		});
+
+		//Same with a chain of tasks, each task depending on the previous one
+		runMicroBenchmark("ThreadPool.submitDependentTask", threadCount, dependentTaskCount, [&threadPool]()
+		{
+			std::shared_ptr<kodgen::TaskBase> previousTask = threadPool.submitTask("Root", [](kodgen::TaskBase*) {});
+
+			for (kodgen::uint64 i = 1u; i < dependentTaskCount; i++)
+			{
+				previousTask = threadPool.submitTask("Dependent", [](kodgen::TaskBase*) {}, { previousTask });
+			}
+
+			threadPool.joinWorkers();
+		});
+
+		//Same amount of empty work items submitted as a single batch
+		runMicroBenchmark("ThreadPool.submitBatch", threadCount, independentTaskCount, [&threadPool]()
+		{
+			threadPool.parallelFor(independentTaskCount, [](kodgen::uint64, kodgen::TaskBase*) {});
+		});
+	}
+}
+
+void benchmarkStructClassTree()
+{
+	constexpr kodgen::uint32 const queryCount = 100000u;
+
+	for (kodgen::uint32 classCount = 64u; classCount <= 4096u; classCount *= 4u)
+	{
+		kodgen::StructClassTree		structClassTree;
+		std::vector<std::string>	classNames;
+
+		classNames.reserve(classCount);
+
+		for (kodgen::uint32 i = 0u; i < classCount; i++)
+		{
+			classNames.emplace_back("ns::Class" + std::to_string(i));
+		}
+
+		//Each class inherits from the class at half its index, and every 8th class also inherits from a second one
+		for (kodgen::uint32 i = 1u; i < classCount; i++)
+		{
+			structClassTree.addInheritanceLink(classNames[i], classNames[i / 2u], kodgen::EAccessSpecifier::Public);
+
+			if (i % 8u == 0u)
+			{
+				structClassTree.addInheritanceLink(classNames[i], classNames[i - 1u], kodgen::EAccessSpecifier::Protected);
+			}
+		}
+
+		kodgen::FrozenStructClassTree frozenStructClassTree(structClassTree);
+
+		runMicroBenchmark("StructClassTree.isBaseOf", classCount, queryCount, [&structClassTree, &classNames, classCount]()
+		{
+			for (kodgen::uint32 i = 0u; i < queryCount; i++)
+			{
+				sink = sink + structClassTree.isBaseOf(classNames[(i * 7u) % classCount], classNames[(i * 13u) % classCount]);
+			}
+		});
+
+		runMicroBenchmark("FrozenStructClassTree.isBaseOf", classCount, queryCount, [&frozenStructClassTree, &classNames, classCount]()
+		{
+			for (kodgen::uint32 i = 0u; i < queryCount; i++)
+			{
+				sink = sink + frozenStructClassTree.isBaseOf(classNames[(i * 7u) % classCount], classNames[(i * 13u) % classCount]);
+			}
+		});
+	}
+}
+
+/**
+*	Code generation module doing nothing, used to measure the traversal overhead only.
+*/
+class EmptyCodeGenModule : public kodgen::CodeGenModule
+{
+	public:
+		virtual kodgen::ICloneable* clone() const noexcept override
+		{
+			return new EmptyCodeGenModule(*this);
+		}
+
+		virtual kodgen::ETraversalBehaviour generateCodeForEntity(kodgen::EntityInfo const&, kodgen::CodeGenEnv&, std::string& inout_result) noexcept override
+		{
+			inout_result += ' ';
+
+			return kodgen::ETraversalBehaviour::Recurse;
+		}
+
+		virtual bool initialGenerateCode(kodgen::CodeGenEnv&, std::string&) noexcept override
+		{
+			return true;
+		}
+
+		virtual bool finalGenerateCode(kodgen::CodeGenEnv&, std::string&) noexcept override
+		{
+			return true;
+		}
+
+		virtual kodgen::int32 getGenerationOrder() const noexcept override
+		{
+			//This module has no property code generator to get the order from
+			return 0;
+		}
+};
+
+/**
+*	Code generation unit writing nothing, used to measure the traversal overhead only.
+*/
+class TraversalCodeGenUnit : public kodgen::CodeGenUnit
+{
+	private:
+		std::string _result;
+
+	protected:
+		virtual void generateCodeForEntity(kodgen::EntityInfo const& entity, kodgen::CodeGenEnv& env, std::function<void(kodgen::EntityInfo const&, kodgen::CodeGenEnv&, std::string&)> generate) noexcept override
+		{
+			generate(entity, env, _result);
+		}
+
+		virtual void initialGenerateCode(kodgen::CodeGenEnv& env, std::function<void(kodgen::CodeGenEnv&, std::string&)> generate) noexcept override
+		{
+			generate(env, _result);
+		}
+
+		virtual void finalGenerateCode(kodgen::CodeGenEnv& env, std::function<void(kodgen::CodeGenEnv&, std::string&)> generate) noexcept override
+		{
+			generate(env, _result);
+		}
+
+	public:
+		virtual bool isUpToDate(fs::path const&) const noexcept override
+		{
+			return false;
+		}
+
+		size_t consumeResult() noexcept
+		{
+			size_t size = _result.size();
+
+			_result.clear();
+
+			return size;
+		}
+};
+
+void benchmarkCodeGenUnitTraversal(kodgen::FileParser& fileParser)
+{
+	CorpusSettings corpusSettings;
+	corpusSettings.fileCount			= 1u;
+	corpusSettings.classesPerFile		= 32u;
+	corpusSettings.fieldsPerClass		= 16u;
+	corpusSettings.methodsPerClass		= 8u;
+	corpusSettings.enumsPerFile			= 8u;
+	corpusSettings.annotationDensity	= 1.0f;
+	corpusSettings.nestingDepth			= 3u;
+	corpusSettings.includeFanOut		= 0u;
+
+	std::vector<fs::path> files = CorpusGenerator().generate(corpusSettings, fs::temp_directory_path() / "KodgenMicroBenchmarkCorpus");
+
+	kodgen::FileParsingResult parsingResult;
+
+	if (files.empty() || !fileParser.parse(files.front(), parsingResult))
+	{
+		std::cerr << "Failed to parse the traversal benchmark file." << std::endl;
+		return;
+	}
+
+	constexpr kodgen::uint64 const passes = 100u;
+
+	for (kodgen::uint32 generatorCount : { 1u, 8u, 32u })
+	{
+		std::vector<EmptyCodeGenModule>	modules(generatorCount);
+		TraversalCodeGenUnit			codeGenUnit;
+
+		for (EmptyCodeGenModule& codeGenModule : modules)
+		{
+			codeGenUnit.addModule(codeGenModule);
+		}
+
+		runMicroBenchmark("CodeGenUnit.generateCode", generatorCount, passes, [&codeGenUnit, &parsingResult]()
+		{
+			for (kodgen::uint64 i = 0u; i < passes; i++)
+			{
+				codeGenUnit.generateCode(parsingResult);
+
+				sink = sink + codeGenUnit.consumeResult();
+			}
+		});
+	}
+}
+
+int main()
+{
+	kodgen::FileParser fileParser;
+
+	if (!BenchmarkHelpers::initParsingSettings(fileParser.getSettings()))
+	{
+		std::cerr << "Compiler could not be set because it is not supported on the current machine." << std::endl;
+		return EXIT_FAILURE;
+	}
+
+	fileParser.getSettings().init(nullptr);
+
+	benchmarkPropertyParser(fileParser.getSettings());
+	benchmarkTypeInfo(fileParser.getSettings());
+	benchmarkThreadPool();
+	benchmarkStructClassTree();
+	benchmarkCodeGenUnitTraversal(fileParser);
+
+	return EXIT_SUCCESS;
+}
\ No newline at end of file
@@ -18,6 +18,12 @@ class GetPropertyCodeGen : public kodgen::MacroPropertyCodeGen
 			kodgen::MacroPropertyCodeGen("Get", kodgen::EEntityType::Field)
 		{}
 
+		virtual kodgen::uint64 getCacheFingerprint() const noexcept override
+		{
+			//The generated code only depends on the field, increment when the generated code changes
+			return 1u;
+		}
+
 		virtual bool preGenerateCodeForEntity(kodgen::EntityInfo const& /* entity */, kodgen::Property const& property, kodgen::uint8 /* propertyIndex */, kodgen::MacroCodeGenEnv& env) noexcept override
 		{
 			std::string errorMessage;
@@ -23,6 +23,12 @@ class GetSetCGM : public kodgen::MacroCodeGenModule
 		{
 		}
 
+		virtual kodgen::uint64 getCacheFingerprint() const noexcept override
+		{
+			//The module doesn't generate code itself, increment when it starts to
+			return 1u;
+		}
+
 		virtual GetSetCGM* clone() const noexcept override
 		{
 			return new GetSetCGM(*this);
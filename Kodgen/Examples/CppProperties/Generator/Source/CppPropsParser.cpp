@@ -2,7 +2,7 @@
 
 void CppPropsParser::preParse(fs::path const& parseFile) noexcept
 {
-	if (logger != nullptr)
+	if (logger != nullptr && logger->isLogged(kodgen::ILogger::ELogSeverity::Info))
 	{
 		logger->log("Start parsing: " + parseFile.string(), kodgen::ILogger::ELogSeverity::Info);
 	}
@@ -17,6 +17,9 @@ void CppPropsParser::postParse(fs::path const&, kodgen::FileParsingResult const&
 			logger->log(parsingError.toString(), kodgen::ILogger::ELogSeverity::Error);
 		}
 
-		logger->log("Found " + std::to_string(result.namespaces.size()) + " namespaces, " + std::to_string(result.classes.size()) + " classes and " + std::to_string(result.enums.size()) + " enums.", kodgen::ILogger::ELogSeverity::Info);
+		if (logger->isLogged(kodgen::ILogger::ELogSeverity::Info))
+		{
+			logger->log("Found " + std::to_string(result.namespaces.size()) + " namespaces, " + std::to_string(result.classes.size()) + " classes and " + std::to_string(result.enums.size()) + " enums.", kodgen::ILogger::ELogSeverity::Info);
+		}
 	}
 }
\ No newline at end of file
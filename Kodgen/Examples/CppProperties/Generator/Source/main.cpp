@@ -4,6 +4,7 @@
 #include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
 #include <Kodgen/Misc/Filesystem.h>
 #include <Kodgen/Misc/DefaultLogger.h>
+#include <Kodgen/Misc/AsyncLogger.h>
 
 #include "GetSetCGM.h"
 
@@ -32,6 +33,9 @@ void initCodeGenManagerSettings(fs::path const& workingDirectory, kodgen::CodeGe
 
 	//Only parse .h files
 	out_generatorSettings.addSupportedFileExtension(".h");
+
+	//Reuse the code generated for unchanged fields
+	out_generatorSettings.setEntityCodeCache(true);
 }
 
 bool initParsingSettings(kodgen::ParsingSettings& parsingSettings)
@@ -94,9 +98,12 @@ int main(int argc, char** argv)
 
 	logger.log("Working Directory: " + workingDirectory.string());
 
+	//Generation threads log through a background thread instead of waiting for the output streams
+	kodgen::AsyncLogger asyncLogger(logger);
+
 	//Setup FileParser
 	kodgen::FileParser fileParser;
-	fileParser.logger = &logger;
+	fileParser.logger = &asyncLogger;
 
 	if (!initParsingSettings(fileParser.getSettings()))
 	{
@@ -106,7 +113,7 @@ int main(int argc, char** argv)
 
 	//Setup code generation unit
 	kodgen::MacroCodeGenUnit codeGenUnit;
-	codeGenUnit.logger = &logger;
+	codeGenUnit.logger = &asyncLogger;
 
 	kodgen::MacroCodeGenUnitSettings cguSettings;
 	initCodeGenUnitSettings(workingDirectory, cguSettings);
@@ -118,16 +125,21 @@ int main(int argc, char** argv)
 
 	//Setup CodeGenManager
 	kodgen::CodeGenManager codeGenMgr;
-	codeGenMgr.logger = &logger;
+	codeGenMgr.logger = &asyncLogger;
 
 	initCodeGenManagerSettings(workingDirectory, codeGenMgr.settings);
 
 	//Kick-off code generation
 	kodgen::CodeGenResult genResult = codeGenMgr.run(fileParser, codeGenUnit, true);
 
+	//Write the generation logs before the summary
+	asyncLogger.flush();
+
 	if (genResult.completed)
 	{
 		logger.log("Generation completed successfully in " + std::to_string(genResult.duration) + " seconds.");
+		logger.log("Timings:\n" + genResult.timings.getSummary());
+		logger.log("Peak translation units memory: " + std::to_string(genResult.peakTranslationUnitsMemory / 1024u) + " KiB, peak resident set size: " + std::to_string(genResult.peakResidentSetSize / 1024u) + " KiB.");
 	}
 	else
 	{
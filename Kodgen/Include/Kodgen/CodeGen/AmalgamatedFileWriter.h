@@ -0,0 +1,123 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <map>
+#include <set>
+#include <mutex>
+#include <string>
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/ILogger.h"
+
+namespace kodgen
+{
+	/**
+	*	Collect the code generated for many source files and write it in a few amalgamation files.
+	*	Fragments can be added concurrently from multiple generation threads, and all amalgamation files
+	*	are written once at the end of the generation process.
+	*	Fragments of source files which were not regenerated during the current run are retrieved from
+	*	the existing amalgamation file so that incremental generation keeps a complete amalgamation.
+	*	Fragments of source files which are not processed anymore are removed explicitly with removeFragment.
+	*/
+	class AmalgamatedFileWriter
+	{
+		private:
+			/** Fragments of a single amalgamation file, sorted by source file path to keep a stable output order. */
+			using Fragments = std::map<std::string, std::string>;
+
+			/** Changes to a single amalgamation file. */
+			struct Amalgamation
+			{
+				/** Fragments added during the current generation process. */
+				Fragments				fragments;
+
+				/** Fragments removed during the current generation process. */
+				std::set<std::string>	removedFragments;
+			};
+
+			/** Marker written before each fragment, followed by the fragment source file path. */
+			static constexpr char const*	_fragmentBeginMarker	= "//KODGEN_FRAGMENT_BEGIN ";
+
+			/** Marker written after each fragment. */
+			static constexpr char const*	_fragmentEndMarker		= "//KODGEN_FRAGMENT_END";
+
+			/** Changes made during the current generation process, per amalgamation file. */
+			std::map<fs::path, Amalgamation>	_amalgamations;
+
+			/** Mutex used to synchronize fragments insertion. */
+			std::mutex							_mutex;
+
+			/**
+			*	@brief Get the name identifying the fragment of a source file in an amalgamation file.
+			*
+			*	@param amalgamationFile	Path to the amalgamation file.
+			*	@param sourceFile		Path to the source file.
+			*
+			*	@return The source file path relative to the amalgamation file, so that the output doesn't depend on the machine.
+			*/
+			static std::string	getFragmentName(fs::path const&	amalgamationFile,
+												fs::path const&	sourceFile)			noexcept;
+
+			/**
+			*	@brief	Load the fragments of an existing amalgamation file.
+			*			Fragments which were removed or which source file doesn't exist anymore are discarded.
+			*
+			*	@param amalgamationFile		Path to the amalgamation file to read.
+			*	@param inout_amalgamation	Changes to the amalgamation file. Already added fragments are not overwritten.
+			*/
+			static void	loadExistingFragments(fs::path const&	amalgamationFile,
+											  Amalgamation&		inout_amalgamation)	noexcept;
+
+			/**
+			*	@brief Write an amalgamation file.
+			*
+			*	@param amalgamationFile	Path to the amalgamation file to write.
+			*	@param fragments		Fragments to write in the file.
+			*/
+			static void	writeAmalgamationFile(fs::path const&	amalgamationFile,
+											  Fragments const&	fragments)			noexcept;
+
+		public:
+			/**
+			*	@brief	Add the code generated for a source file to an amalgamation file.
+			*			This method is thread-safe.
+			*
+			*	@param amalgamationFile	Path to the amalgamation file the fragment belongs to.
+			*	@param sourceFile		Path to the source file the fragment was generated from.
+			*	@param code				Generated code.
+			*/
+			void	addFragment(fs::path const&	amalgamationFile,
+								fs::path const&	sourceFile,
+								std::string&&	code)								noexcept;
+
+			/**
+			*	@brief	Remove the code generated for a source file from an amalgamation file, which is written again even if no fragment is added to it.
+			*			This method is thread-safe.
+			*
+			*	@param amalgamationFile	Path to the amalgamation file the fragment belongs to.
+			*	@param sourceFile		Path to the source file the fragment was generated from.
+			*/
+			void	removeFragment(fs::path const&	amalgamationFile,
+								   fs::path const&	sourceFile)							noexcept;
+
+			/**
+			*	@brief Write all amalgamation files which had at least one fragment added or removed since the last call to clear.
+			*
+			*	@param logger Optional logger used to issue logs. Can be nullptr.
+			*
+			*	@return true if all files have been written successfully, else false.
+			*/
+			bool	writeFiles(ILogger* logger)										noexcept;
+
+			/**
+			*	@brief Discard all added and removed fragments.
+			*/
+			void	clear()															noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,228 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/Optional.h"
+
+namespace kodgen
+{
+	/**
+	*	Content-addressed cache of the files generated from each source file, stored in a directory which can be shared between machines (local or NFS).
+	*	An artifact is keyed by the content of the source file and of the files it includes, the compilation arguments,
+	*	the generated file paths and the cache fingerprint of the code generation unit (see CodeGenUnit::getCacheFingerprint).
+	*	Included files are found by scanning #include directives and resolving them against the include directories of the compilation arguments,
+	*	without evaluating the preprocessor: conditional includes are always followed, and includes using a macro are ignored.
+	*	Artifacts are written to a temporary file then renamed, so that concurrent readers only ever see complete artifacts.
+	*	Paths in the keys and artifacts are relative to a root directory, so checkouts of the project at different locations share the same artifacts.
+	*/
+	class ArtifactCache
+	{
+		private:
+			/** #include directive found in a file. */
+			struct IncludeDirective
+			{
+				/** Included file name, as written between the quotes or angle brackets. */
+				std::string	name;
+
+				/** Is the file name written between quotes. */
+				bool		isQuoted		= false;
+
+				/** Is the directive an #include_next. */
+				bool		isIncludeNext	= false;
+			};
+
+			/** Content hash and #include directives of a file. */
+			struct FileDigest
+			{
+				/** Hash of the file content. */
+				uint64							contentHash	= 0u;
+
+				/** #include directives of the file, in order. */
+				std::vector<IncludeDirective>	includeDirectives;
+			};
+
+			/** Version written at the top of each artifact. Artifacts with a different version are ignored. */
+			static constexpr char const*								_header	= "KODGEN_ARTIFACT 2";
+
+			/** Directory containing the artifacts. */
+			fs::path													_directory;
+
+			/** Directory the paths of the keys and artifacts are relative to. */
+			fs::path													_rootDirectory;
+
+			/** Digest of each file read since the last clearFileDigests call. */
+			std::unordered_map<fs::path, FileDigest, PathHash>			_fileDigests;
+
+			/** Files found for each include directive resolved since the last clearFileDigests call, by include directories, including directory and directive. */
+			std::unordered_map<std::string, std::vector<fs::path>>		_resolvedIncludes;
+
+			/** Mutex used to synchronize the digests and resolved includes. */
+			std::mutex													_mutex;
+
+			/**
+			*	@brief Read a file and compute its digest.
+			*
+			*	@param file				Path to the file.
+			*	@param out_fileDigest	Digest of the file.
+			*
+			*	@return true if the file could be read, else false.
+			*/
+			static bool					computeFileDigest(fs::path const&	file,
+														  FileDigest&		out_fileDigest)							noexcept;
+
+			/**
+			*	@brief Find the files an include directive refers to.
+			*
+			*	@param directive			Include directive to resolve.
+			*	@param includingDirectory	Directory of the file containing the directive.
+			*	@param quoteDirectories		Directories searched for quoted includes only, in search order.
+			*	@param includeDirectories	Directories searched for all includes, in search order.
+			*
+			*	@return The first file found, or all the files found in the include directories for an #include_next. Empty if the file was not found.
+			*/
+			static std::vector<fs::path>	resolveIncludeDirective(IncludeDirective const&			directive,
+																	fs::path const&					includingDirectory,
+																	std::vector<fs::path> const&	quoteDirectories,
+																	std::vector<fs::path> const&	includeDirectories)		noexcept;
+
+			/**
+			*	@brief Get the path of the artifact stored with a key.
+			*
+			*	@param key Key of the artifact.
+			*
+			*	@return The path of the artifact.
+			*/
+			fs::path					getArtifactPath(uint64 key)													const	noexcept;
+
+			/**
+			*	@brief Get the form of a path stored in keys and artifacts.
+			*
+			*	@param path Absolute path.
+			*
+			*	@return The path relative to _rootDirectory if it is located in it, else the absolute path, with / separators.
+			*/
+			std::string					getKeyPath(fs::path const& path)											const	noexcept;
+
+			/**
+			*	@brief	Get the digest of a file, computing it if it was not read yet.
+			*			This method is thread-safe.
+			*
+			*	@param file Path to the file.
+			*
+			*	@return The digest of the file, valid until the next clearFileDigests call, or nullptr if the file could not be read.
+			*/
+			FileDigest const*			getFileDigest(fs::path const& file)											noexcept;
+
+			/**
+			*	@brief	Get the files an include directive refers to, resolving the directive if it was not resolved yet.
+			*			This method is thread-safe.
+			*
+			*	@param directive			Include directive to resolve.
+			*	@param includingDirectory	Directory of the file containing the directive.
+			*	@param quoteDirectories		Directories searched for quoted includes only, in search order.
+			*	@param includeDirectories	Directories searched for all includes, in search order.
+			*	@param directoriesKey		Key identifying quoteDirectories and includeDirectories.
+			*
+			*	@return The files the directive refers to.
+			*/
+			std::vector<fs::path>		getIncludedFiles(IncludeDirective const&		directive,
+														 fs::path const&				includingDirectory,
+														 std::vector<fs::path> const&	quoteDirectories,
+														 std::vector<fs::path> const&	includeDirectories,
+														 std::string const&				directoriesKey)						noexcept;
+
+		public:
+			/**
+			*	@brief	Compute the key of the artifact generated from a source file.
+			*			This method is thread-safe.
+			*
+			*	@param sourceFile				Path to the source file.
+			*	@param compilationArguments		Arguments used to parse the source file.
+			*	@param generatedFiles			Paths of the files generated from the source file.
+			*	@param codeGenUnitFingerprint	Cache fingerprint of the code generation unit. Must not be 0.
+			*	@param outputDirectory			Directory containing the generated files. Included files located in this directory are not part of the key,
+			*									since they are generated from their own source file.
+			*
+			*	@return The key of the artifact, or an empty optional if the source file or one of the files it includes could not be read.
+			*/
+			opt::optional<uint64>		computeKey(fs::path const&					sourceFile,
+												   std::vector<char const*> const&	compilationArguments,
+												   std::vector<fs::path> const&		generatedFiles,
+												   uint64							codeGenUnitFingerprint,
+												   fs::path const&					outputDirectory)						noexcept;
+
+			/**
+			*	@brief	Write the files generated from a source file from the artifact stored with a key.
+			*			This method is thread-safe.
+			*
+			*	@param key				Key of the artifact.
+			*	@param sourceFile		Path to the source file.
+			*	@param generatedFiles	Paths of the files generated from the source file.
+			*
+			*	@return true if the artifact was found and all the generated files were written, else false.
+			*/
+			bool						restore(uint64							key,
+												fs::path const&					sourceFile,
+												std::vector<fs::path> const&	generatedFiles)						const	noexcept;
+
+			/**
+			*	@brief	Store the files generated from a source file in an artifact. Nothing is written if the artifact already exists.
+			*			This method is thread-safe, and can be called concurrently by several processes sharing the cache directory.
+			*
+			*	@param key				Key of the artifact.
+			*	@param sourceFile		Path to the source file.
+			*	@param generatedFiles	Paths of the files generated from the source file.
+			*
+			*	@return true if the artifact exists once the method returns, else false.
+			*/
+			bool						publish(uint64							key,
+												fs::path const&					sourceFile,
+												std::vector<fs::path> const&	generatedFiles)						const	noexcept;
+
+			/**
+			*	@brief	Forget the digests of the files read so far, so that modified files are read again.
+			*			This method must not be called while keys are being computed.
+			*/
+			void						clearFileDigests()															noexcept;
+
+			/**
+			*	@brief Setter for _directory field.
+			*
+			*	@param directory Directory containing the artifacts. It is created when the first artifact is published.
+			*/
+			void						setDirectory(fs::path const& directory)										noexcept;
+
+			/**
+			*	@brief Getter for _directory field.
+			*
+			*	@return _directory.
+			*/
+			fs::path const&				getDirectory()														const	noexcept;
+
+			/**
+			*	@brief Setter for _rootDirectory field.
+			*
+			*	@param rootDirectory Directory the paths of the keys and artifacts are relative to.
+			*/
+			void						setRootDirectory(fs::path const& rootDirectory)								noexcept;
+
+			/**
+			*	@brief Getter for _rootDirectory field.
+			*
+			*	@return _rootDirectory.
+			*/
+			fs::path const&				getRootDirectory()													const	noexcept;
+	};
+}
\ No newline at end of file
@@ -8,7 +8,9 @@
 #pragma once
 
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+#include "Kodgen/InfoStructures/ProjectStructClassTree.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/TimingReport.h"
 
 namespace kodgen
 {
@@ -27,6 +29,12 @@ namespace kodgen
 
 			/** Logger used to log during the code generation process. Can be nullptr. */
 			ILogger*					_logger				= nullptr;
+
+			/** Report timing spans should be added to during the code generation process. Can be nullptr. */
+			TimingReport*				_timingReport		= nullptr;
+
+			/** Inheritance links of all the files of the run. nullptr if the CodeGenManager doesn't build it. */
+			ProjectStructClassTree const*	_projectStructClassTree	= nullptr;
 		
 		public:
 			virtual ~CodeGenEnv() = default;
@@ -44,6 +52,22 @@ namespace kodgen
 			*	@return _logger.
 			*/
 			inline ILogger*					getLogger()				const	noexcept;
+
+			/**
+			*	@brief Getter for the _timingReport field.
+			* 
+			*	@return _timingReport.
+			*/
+			inline TimingReport*			getTimingReport()		const	noexcept;
+
+			/**
+			*	@brief	Getter for the _projectStructClassTree field.
+			*			Unlike FileParsingResult::structClassTree, the project tree also knows the structs/classes of the other parsed files.
+			*			The tree is frozen before generation starts, so ProjectStructClassTree::getFrozenTree answers isBaseOf queries in constant time.
+			* 
+			*	@return _projectStructClassTree, nullptr if CodeGenManagerSettings::setProjectStructClassTree was not enabled.
+			*/
+			inline ProjectStructClassTree const*	getProjectStructClassTree()	const	noexcept;
 	};
 
 	#include "Kodgen/CodeGen/CodeGenEnv.inl"
@@ -13,4 +13,14 @@ inline FileParsingResult const* CodeGenEnv::getFileParsingResult() const noexcep
 inline ILogger* CodeGenEnv::getLogger() const noexcept
 {
 	return _logger;
+}
+
+inline TimingReport* CodeGenEnv::getTimingReport() const noexcept
+{
+	return _timingReport;
+}
+
+inline ProjectStructClassTree const* CodeGenEnv::getProjectStructClassTree() const noexcept
+{
+	return _projectStructClassTree;
 }
\ No newline at end of file
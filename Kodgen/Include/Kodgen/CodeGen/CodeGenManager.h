@@ -8,39 +8,161 @@
 #pragma once
 
 #include <set>
+#include <memory>		//std::unique_ptr
+#include <vector>
+#include <mutex>
+#include <unordered_map>
 #include <cassert>
 #include <type_traits>	//std::is_base_of
 #include <chrono>		//std::chrono::high_resolution_clock
+#include <functional>	//std::function
 
 #include "Kodgen/Misc/ILogger.h"
 #include "Kodgen/CodeGen/CodeGenResult.h"
+#include "Kodgen/CodeGen/CodeGenRunHandle.h"
+#include "Kodgen/CodeGen/EFileProcessingStep.h"
 #include "Kodgen/CodeGen/CodeGenUnit.h"
 #include <Kodgen/CodeGen/CodeGenManagerSettings.h>
+#include "Kodgen/CodeGen/FileManifest.h"
+#include "Kodgen/CodeGen/EntityCodeCache.h"
+#include "Kodgen/CodeGen/ArtifactCache.h"
+#include "Kodgen/InfoStructures/ProjectStructClassTree.h"
+#include "Kodgen/Misc/FileStatus.h"
+#include "Kodgen/Misc/ScopedTimingSpan.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 #include "Kodgen/Parsing/FileParser.h"
+#include "Kodgen/Parsing/ParsingWorkerPool.h"
+#include "Kodgen/Threading/IExecutor.h"
 #include "Kodgen/Threading/ThreadPool.h"
 #include "Kodgen/Threading/TaskHelper.h"
+#include "Kodgen/Threading/CancellationToken.h"
+#include "Kodgen/Threading/MemoryBudget.h"
 
 namespace kodgen
 {
 	class CodeGenManager
 	{
+		public:
+			/**
+			*	Function called each time a processing step of a file completes, with the file, the completed step and whether it succeeded.
+			*	It is called concurrently from the executor threads, so it must be thread-safe.
+			*/
+			using FileProcessedCallback = std::function<void(fs::path const&, EFileProcessingStep, bool)>;
+
 		private:
-			/** Thread pool used for files processing. */
-			ThreadPool	_threadPool;
+			/** Files collected during a directory scan. */
+			struct FileScanResult
+			{
+				/** Files which must be processed. */
+				std::vector<fs::path>	toProcessFiles;
+
+				/** Files which are up-to-date. */
+				std::vector<fs::path>	upToDateFiles;
+
+				/** Up-to-date files which entry in the file manifest must be refreshed. */
+				std::vector<fs::path>	toRefreshFiles;
+
+				/** Tasks scanning a directory. A task adds the tasks scanning its subdirectories before it finishes. */
+				std::vector<std::shared_ptr<TaskBase>>	scanTasks;
+			};
+
+			/** Resources used to process a file over all iterations. */
+			struct FileProcessingStats
+			{
+				/** Parsing duration in microseconds, accumulated over all iterations. */
+				uint64	parseDuration			= 0u;
+
+				/** Code generation duration in microseconds, accumulated over all iterations. */
+				uint64	generationDuration		= 0u;
+
+				/** Highest memory used by the translation unit of the file, in bytes. */
+				uint64	translationUnitMemory	= 0u;
+
+				/** Highest memory used by the parsing result of the file, in bytes. */
+				uint64	parsingResultMemory		= 0u;
+			};
+
+			/** Memory used by a translation unit during a parsing task. */
+			struct TranslationUnitUsage
+			{
+				/** Start of the parsing task. */
+				TimingReport::Clock::time_point	start;
+
+				/** End of the parsing task. */
+				TimingReport::Clock::time_point	end;
+
+				/** Memory used by the translation unit, in bytes. */
+				uint64							memory	= 0u;
+			};
+
+			/** Thread pool owned by the manager when it is not given an executor. */
+			std::unique_ptr<ThreadPool>								_ownedThreadPool;
+
+			/** Executor used for files processing. */
+			IExecutor*												_executor		= nullptr;
+
+			/** Persisted status of the processed files used to quickly detect up-to-date files. */
+			FileManifest											_fileManifest;
+
+			/** Inheritance links of all the files of the run, built if CodeGenManagerSettings::shouldBuildProjectStructClassTree. */
+			ProjectStructClassTree									_projectStructClassTree;
+
+			/** Code generated for each entity by the previous runs, reused for unchanged entities. */
+			EntityCodeCache											_entityCodeCache;
+
+			/** Files generated from each source file by the previous runs of all machines sharing the artifact cache directory. */
+			ArtifactCache											_artifactCache;
+
+			/** Status of all files identified during the last scan. */
+			std::unordered_map<fs::path, FileStatus, PathHash>		_scannedFileStatuses;
+
+			/** Mutex used to synchronize scan results between scanning threads. */
+			std::mutex												_scanMutex;
+
+			/** Source of the cancellation token of the current run. */
+			CancellationSource										_cancellationSource;
+
+			/** Mutex used to synchronize the replacement of _cancellationSource with CodeGenManager::cancel calls. */
+			std::mutex												_cancellationMutex;
+
+			/** Budget limiting the memory of the translation units parsed at the same time, used when CodeGenManagerSettings::getMemoryBudget is not 0. */
+			MemoryBudget											_ownedMemoryBudget;
 
 			/**
 			*	@brief Process all provided files on multiple threads.
 			*	
 			*	@param fileParser		Original file parser to use to parse registered files. A copy of this parser will be used for each generation thread.
 			*	@param codeGenUnit		Generation unit used to generate files. It must have a clean state when this method is called.
-			*	@param toProcessFiles	Collection of all files to process.
-			*	@param out_genResult	Reference to the generation result to fill during file generation.
+			*	@param toProcessFiles		Collection of all files to process, in submission order.
+			*	@param cancellationToken	Token which cancels all the tasks of the run which have not started yet.
+			*	@param onFileProcessed		Function called when a file processing step completes. Can be nullptr.
+			*	@param out_genResult		Reference to the generation result to fill during file generation.
 			*/
 			template <typename FileParserType, typename CodeGenUnitType>
-			void	processFiles(FileParserType&			fileParser,
-								 CodeGenUnitType&			codeGenUnit,
-								 std::set<fs::path> const&	toProcessFiles,
-								 CodeGenResult&				out_genResult)										noexcept;
+			void	processFiles(FileParserType&				fileParser,
+								 CodeGenUnitType&				codeGenUnit,
+								 std::vector<fs::path> const&	toProcessFiles,
+								 CancellationToken const&		cancellationToken,
+								 FileProcessedCallback const&	onFileProcessed,
+								 CodeGenResult&					out_genResult)									noexcept;
+
+			/**
+			*	@brief Run the generation. See CodeGenManager::run.
+			*
+			*	@param fileParser			Original file parser to use to parse registered files.
+			*	@param codeGenUnit			Generation unit used to generate code.
+			*	@param forceRegenerateAll	Ignore the last write time check and reparse / regenerate all files.
+			*	@param onFileProcessed		Function called when a file processing step completes. Can be nullptr.
+			*	@param cancellationToken	Token which cancels the run.
+			*
+			*	@return Structure containing file generation report.
+			*/
+			template <typename FileParserType, typename CodeGenUnitType>
+			CodeGenResult	runInternal(FileParserType&					fileParser,
+										CodeGenUnitType&				codeGenUnit,
+										bool							forceRegenerateAll,
+										FileProcessedCallback const&	onFileProcessed,
+										CancellationToken const&		cancellationToken)						noexcept;
 
 			/**
 			*	@brief Identify all files which will be parsed & regenerated.
@@ -55,9 +177,234 @@ namespace kodgen
 														   CodeGenResult&		out_genResult,
 														   bool					forceRegenerateAll)				noexcept;
 
+			/**
+			*	@brief Submit a task scanning a directory and add it to the scan result. This method can be called concurrently.
+			*
+			*	@param directory			Directory to scan.
+			*	@param codeGenUnit			Generation unit used to determine whether a file should be reparsed/regenerated or not.
+			*	@param forceRegenerateAll	Should all files be regenerated or not.
+			*	@param out_scanResult		Scan result to fill.
+			*/
+			void					submitScanDirectory(fs::path const&		directory,
+														CodeGenUnit const&	codeGenUnit,
+														bool				forceRegenerateAll,
+														FileScanResult&		out_scanResult)						noexcept;
+
+			/**
+			*	@brief	Scan the content of a directory. Each nested directory is scanned in a new executor task.
+			*
+			*	@param directory			Directory to scan.
+			*	@param codeGenUnit			Generation unit used to determine whether a file should be reparsed/regenerated or not.
+			*	@param forceRegenerateAll	Should all files be regenerated or not.
+			*	@param out_scanResult		Scan result to fill.
+			*/
+			void					scanDirectory(fs::path const&		directory,
+												  CodeGenUnit const&	codeGenUnit,
+												  bool					forceRegenerateAll,
+												  FileScanResult&		out_scanResult)							noexcept;
+
+			/**
+			*	@brief	Check whether a file must be processed and add it to the scan result.
+			*			A file is up-to-date if its entry in the file manifest is unchanged, else CodeGenUnit::isUpToDate is called.
+			*			This method can be called concurrently.
+			*
+			*	@param file					File to check.
+			*	@param codeGenUnit			Generation unit used to determine whether a file should be reparsed/regenerated or not.
+			*	@param forceRegenerateAll	Should all files be regenerated or not.
+			*	@param out_scanResult		Scan result to fill.
+			*/
+			void					scanFile(fs::path const&	file,
+											 CodeGenUnit const&	codeGenUnit,
+											 bool				forceRegenerateAll,
+											 FileScanResult&	out_scanResult)									noexcept;
+
+			/**
+			*	@brief	Select the files of the current shard and sort them by descending expected processing cost (longest processing time first).
+			*			If sharding is enabled, the shard of a file is given by the hash of its path, so that all shards agree on it
+			*			whatever their file manifests.
+			*			The cost of a file is the duration of its last processing recorded in the file manifest.
+			*			Files without recorded durations get an estimate derived from their size.
+			*
+			*	@param files			Files to schedule.
+			*	@param outputDirectory	Directory the file paths are made relative to before being hashed.
+			*
+			*	@return The files of the current shard, sorted.
+			*/
+			std::vector<fs::path>	scheduleFiles(std::set<fs::path> const&	files,
+												  fs::path const&			outputDirectory)			const	noexcept;
+
+			/**
+			*	@brief	Compute a hash of a file path which doesn't depend on the machine or on the process.
+			*			The path is made relative to a directory so that the hash is the same for all checkouts of a project.
+			*
+			*	@param file				Path to hash.
+			*	@param rootDirectory	Directory the path is made relative to.
+			*
+			*	@return The hash of the path.
+			*/
+			static uint64			getStablePathHash(fs::path const&	file,
+													  fs::path const&	rootDirectory)							noexcept;
+
+			/**
+			*	@brief	Estimate the processing cost of a file which was never processed.
+			*			The estimate is the file size retrieved during the last scan, so that estimating a file doesn't read it.
+			*
+			*	@param file Path to the file.
+			*
+			*	@return The estimated cost of the file, 0 if it was not scanned.
+			*/
+			uint64					estimateFileCost(fs::path const& file)								const	noexcept;
+
+			/**
+			*	@brief	Estimate the memory used by the translation unit of each file, to admit parsings in the memory budget.
+			*			The estimate of a file is the translation unit memory recorded in the file manifest.
+			*			Files without recorded memory get an estimate proportional to their size retrieved during the last scan, using the memory per byte observed on the other files,
+			*			or a default amount if no memory is recorded at all.
+			*
+			*	@param files Files to estimate.
+			*
+			*	@return The estimated translation unit memory of each file, in bytes.
+			*/
+			std::vector<uint64>		estimateTranslationUnitsMemory(std::vector<fs::path> const& files)	const	noexcept;
+
+			/**
+			*	@brief	Get the budget limiting the memory of the translation units parsed during the run:
+			*			a budget of CodeGenManagerSettings::getMemoryBudget owned by this manager, or the process budget if no budget is set.
+			*			Managers using the process budget share it, so that they don't exceed the cgroup memory limit together.
+			*
+			*	@return The memory budget of the run.
+			*/
+			MemoryBudget&			initMemoryBudget()													noexcept;
+
+			/**
+			*	@brief Update the file manifest entry of a processed file.
+			*
+			*	@param codeGenUnit	Generation unit used to generate the file.
+			*	@param file			Processed file.
+			*	@param succeeded	Whether the code was successfully generated for this file.
+			*	@param stats		Resources used to process the file.
+			*/
+			void					recordProcessedFile(CodeGenUnit const&			codeGenUnit,
+														fs::path const&				file,
+														bool						succeeded,
+														FileProcessingStats const&	stats)						noexcept;
+
+			/**
+			*	@brief Compute the highest memory used at the same time by translation units.
+			*
+			*	@param usages Memory used by each translation unit over time.
+			*
+			*	@return The highest memory used at the same time, in bytes.
+			*/
+			static uint64			computePeakTranslationUnitsMemory(std::vector<TranslationUnitUsage> const& usages)	noexcept;
+
+			/**
+			*	@brief Write the file manifest in the output directory.
+			*
+			*	@param codeGenUnit Generation unit which settings contain the output directory.
+			*/
+			void					saveFileManifest(CodeGenUnit const& codeGenUnit)							noexcept;
+
+			/**
+			*	@brief	Load the project struct/class tree saved by the previous run if it is persisted,
+			*			and discard the links of the files which are about to be processed or which don't exist anymore.
+			*
+			*	@param codeGenUnit		Generation unit which settings contain the output directory.
+			*	@param toProcessFiles	Files which are about to be processed.
+			*/
+			void					prepareProjectStructClassTree(CodeGenUnit const&			codeGenUnit,
+																  std::vector<fs::path> const&	toProcessFiles)		noexcept;
+
+			/**
+			*	@brief Write the project struct/class tree in the output directory.
+			*
+			*	@param codeGenUnit Generation unit which settings contain the output directory.
+			*/
+			void					saveProjectStructClassTree(CodeGenUnit const& codeGenUnit)					noexcept;
+
+			/**
+			*	@brief	Check whether the code generated for each entity is cached.
+			*			Code generators can check inheritance across files through the project struct class tree, which is not part of the entity hashes,
+			*			so the cache is not used when the tree is built.
+			*
+			*	@return true if the entity code cache is used, else false.
+			*/
+			bool					shouldUseEntityCodeCache()											const	noexcept;
+
+			/**
+			*	@brief	Load the entity code cache saved by the previous run, and discard the snippets of the files which don't exist anymore.
+			*
+			*	@param codeGenUnit Generation unit which settings contain the output directory.
+			*/
+			void					prepareEntityCodeCache(CodeGenUnit const& codeGenUnit)						noexcept;
+
+			/**
+			*	@brief Write the entity code cache in the output directory.
+			*
+			*	@param codeGenUnit Generation unit which settings contain the output directory.
+			*/
+			void					saveEntityCodeCache(CodeGenUnit const& codeGenUnit)							noexcept;
+
+			/**
+			*	@brief	Compute the artifact key of each file to process, and restore the generated files of the files which have an artifact in the artifact cache.
+			*			Restored files are recorded in the file manifest and removed from the files to process.
+			*
+			*	@param parsingSettings			Settings providing the compilation arguments of each file.
+			*	@param codeGenUnit				Generation unit generating the files.
+			*	@param forceRegenerateAll		Should all files be generated again. Keys are still computed so that the generated files are stored in the artifact cache.
+			*	@param inout_toProcessFiles		Files to process. Restored files are removed.
+			*	@param onFileProcessed			Callback called for each restored file.
+			*	@param out_genResult			Result the restored files are added to.
+			*
+			*	@return The artifact key of each remaining file to process (empty optional if the file can't be cached),
+			*			or an empty vector if the artifact cache can't be used.
+			*/
+			std::vector<opt::optional<uint64>>	restoreArtifacts(ParsingSettings const&		parsingSettings,
+																 CodeGenUnit const&			codeGenUnit,
+																 bool						forceRegenerateAll,
+																 std::vector<fs::path>&		inout_toProcessFiles,
+																 FileProcessedCallback const&	onFileProcessed,
+																 CodeGenResult&				out_genResult)				noexcept;
+
+			/**
+			*	@brief	Get the directory the paths stored in the artifact cache are relative to:
+			*			the artifactCacheRootDirectory setting, or the deepest directory containing the output directory and the files and directories to process.
+			*
+			*	@param outputDirectory Output directory of the generation unit.
+			*
+			*	@return The root directory of the artifact cache.
+			*/
+			fs::path				getArtifactCacheRootDirectory(fs::path const& outputDirectory)		const	noexcept;
+
+			/**
+			*	@brief Store the generated files of the processed files in the artifact cache, unless their generation failed or their source file changed since the scan.
+			*
+			*	@param codeGenUnit		Generation unit which generated the files.
+			*	@param processedFiles	Processed files.
+			*	@param artifactKeys		Artifact key of each processed file, as returned by restoreArtifacts.
+			*/
+			void					publishArtifacts(CodeGenUnit const&							codeGenUnit,
+													 std::vector<fs::path> const&				processedFiles,
+													 std::vector<opt::optional<uint64>> const&	artifactKeys)				noexcept;
+
+			/**
+			*	@brief Replace the cancellation source by a new one which is not cancelled, so that a cancelled run doesn't affect the next one.
+			*
+			*	@return A token of the new cancellation source.
+			*/
+			CancellationToken		resetCancellation()															noexcept;
+
+			/**
+			*	@brief Cancel the run after a failure when CodeGenManagerSettings::shouldFailFast is set. Only the first failure is logged.
+			*
+			*	@param failure Description of the failure.
+			*/
+			void					failFast(std::string const& failure)										noexcept;
+
 			/**
 			*	@brief	Get the number of threads to use based on the provided thread count.
 			*			If 0 is provided, std::thread::hardware_concurrency is used, or 8 if std::thread::hardware_concurrency returns 0.
+			*			This number is then limited to the CPU quota of the process cgroup, if any.
 			*			For all other initial thread count values, the function returns immediately this number.
 			* 
 			*	@param initialThreadCount The number of threads to use.
@@ -90,6 +437,13 @@ namespace kodgen
 			/** Logger used to issue logs from the CodeGenManager. */
 			ILogger*				logger		= nullptr;
 
+			/**
+			*	Worker processes parsing the files instead of the generation threads, or nullptr. Only used once started (see ParsingWorkerPool::start),
+			*	which must happen before the CodeGenManager is constructed since its thread pool is started by the constructor.
+			*	Each parsing task waits for its worker on a generation thread, so the executor should have at least as many threads as workers.
+			*/
+			ParsingWorkerPool*		parsingWorkerPool	= nullptr;
+
 			/** Struct containing all generation settings. */
 			CodeGenManagerSettings	settings;
 
@@ -97,11 +451,35 @@ namespace kodgen
 			*	@brief Construct a CodeGenManager that will work with the specified number of threads.
 			* 
 			*	@param threadCount	Number of threads to use for file parsing and generation.
-			*							If 0 is provided, the number of concurrent threads supported by the implementation will be used (std::thread::hardware_concurrency(), and 8 if std::thread::hardware_concurrency() returns 0).
+			*							If 0 is provided, the number of concurrent threads supported by the implementation will be used (std::thread::hardware_concurrency(), and 8 if std::thread::hardware_concurrency() returns 0),
+			*							limited to the CPU quota of the process cgroup if any.
 			*							If 1 is provided, all the process will be handled by the main thread.
 			*/
 			CodeGenManager(uint32 threadCount = 0u)	noexcept;
 
+			/**
+			*	@brief	Construct a CodeGenManager that will submit its tasks to the provided executor.
+			*			The executor can be shared with other CodeGenManagers and any other code: the manager only waits for its own tasks.
+			*
+			*	@param executor Executor used for file parsing and generation. It must outlive the CodeGenManager.
+			*/
+			CodeGenManager(IExecutor& executor)		noexcept;
+
+			/**
+			*	@brief	Getter for _projectStructClassTree field.
+			*			The tree is only filled if CodeGenManagerSettings::shouldBuildProjectStructClassTree is set.
+			* 
+			*	@return _projectStructClassTree.
+			*/
+			ProjectStructClassTree const&	getProjectStructClassTree()	const	noexcept;
+
+			/**
+			*	@brief	Cancel the run in progress. Tasks which have not started yet are skipped, files being parsed by worker processes are aborted,
+			*			and the files which were not generated are reported in CodeGenResult::skippedFiles.
+			*			This method is thread-safe.
+			*/
+			void							cancel()							noexcept;
+
 			/**
 			*	@brief	Parse registered files if they were modified since last generation (or don't exist)
 			*			and forward them to individual file generation unit for code generation.
@@ -109,13 +487,35 @@ namespace kodgen
 			*	@param fileParser			Original file parser to use to parse registered files. A copy of this parser will be used for each generation thread.
 			*	@param codeGenUnit			Generation unit used to generate code. It must have a clean state when this method is called.
 			*	@param forceRegenerateAll	Ignore the last write time check and reparse / regenerate all files.
+			*	@param onFileProcessed		Function called each time a file is parsed, generated or skipped. Can be nullptr.
+			*								It is called concurrently from the executor threads, so it must be thread-safe.
 			*
 			*	@return Structure containing file generation report.
 			*/
 			template <typename FileParserType, typename CodeGenUnitType>
-			CodeGenResult run(FileParserType&	fileParser,
-							  CodeGenUnitType&	codeGenUnit,
-							  bool				forceRegenerateAll	= false)	noexcept;
+			CodeGenResult		run(FileParserType&			fileParser,
+									CodeGenUnitType&		codeGenUnit,
+									bool					forceRegenerateAll	= false,
+									FileProcessedCallback	onFileProcessed		= nullptr)	noexcept;
+
+			/**
+			*	@brief	Start CodeGenManager::run in a task of the executor and return immediately.
+			*			onFileProcessed is called as soon as each file is generated, so that the generated files can be used before the end of the run.
+			*			The manager, fileParser and codeGenUnit must outlive the run, and the manager must not be used by another run until the handle is joined.
+			*
+			*	@param fileParser			Original file parser to use to parse registered files. A copy of this parser will be used for each generation thread.
+			*	@param codeGenUnit			Generation unit used to generate code. It must have a clean state when this method is called.
+			*	@param forceRegenerateAll	Ignore the last write time check and reparse / regenerate all files.
+			*	@param onFileProcessed		Function called each time a file is parsed, generated or skipped. Can be nullptr.
+			*								It is called concurrently from the executor threads, so it must be thread-safe.
+			*
+			*	@return A handle used to wait for the end of the run and get its result.
+			*/
+			template <typename FileParserType, typename CodeGenUnitType>
+			CodeGenRunHandle	runAsync(FileParserType&		fileParser,
+										 CodeGenUnitType&		codeGenUnit,
+										 bool					forceRegenerateAll	= false,
+										 FileProcessedCallback	onFileProcessed		= nullptr)	noexcept;
 	};
 
 	#include "Kodgen/CodeGen/CodeGenManager.inl"
@@ -6,37 +6,129 @@
 */
 
 template <typename FileParserType, typename CodeGenUnitType>
-void CodeGenManager::processFiles(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, std::set<fs::path> const& toProcessFiles, CodeGenResult& out_genResult) noexcept
+void CodeGenManager::processFiles(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, std::vector<fs::path> const& toProcessFiles, CancellationToken const& cancellationToken, FileProcessedCallback const& onFileProcessed, CodeGenResult& out_genResult) noexcept
 {
 	std::vector<std::shared_ptr<TaskBase>>	generationTasks;
+	std::vector<FileProcessingStats>		stats(toProcessFiles.size());
 	uint8									iterationCount = codeGenUnit.getIterationCount();
+	std::vector<TranslationUnitUsage>		translationUnitUsages(toProcessFiles.size() * iterationCount);
+	bool									useParsingWorkers = parsingWorkerPool != nullptr && parsingWorkerPool->isRunning();
+	bool									buildProjectStructClassTree = settings.shouldBuildProjectStructClassTree();
+	ProjectStructClassTree const*			projectStructClassTree = buildProjectStructClassTree ? &_projectStructClassTree : nullptr;
+	std::vector<std::shared_ptr<TaskBase>>	parsingTasks(toProcessFiles.size());
+	bool									shouldFailFast = settings.shouldFailFast();
+	uint32									parsingTimeout = fileParser.getSettings().parsingTimeout;
+	EntityCodeCache*						entityCodeCache = shouldUseEntityCodeCache() ? &_entityCodeCache : nullptr;
+
+	MemoryBudget&							memoryBudget = initMemoryBudget();
+	std::vector<uint64>						translationUnitsMemory = (memoryBudget.getCapacity() != 0u) ? estimateTranslationUnitsMemory(toProcessFiles) : std::vector<uint64>(toProcessFiles.size(), 0u);
 
 	//Reserve enough space for all tasks
 	generationTasks.reserve(toProcessFiles.size() * iterationCount);
 
 	//Launch all parsing -> generation processes
-	std::shared_ptr<TaskBase> parsingTask;
-	
+	//Files keep their own parsing and generation tasks instead of a batch: each parse is submitted once its translation unit fits in the memory budget,
+	//and each generation starts as soon as its own parse has finished. The 2 tasks of a file cost 8 to 17 us (ThreadPool.submitEmptyTask and
+	//ThreadPool.submitDependentTask micro-benchmarks, 1 to 32 workers) while parsing a file of the CppProperties example takes 240 to 400 ms,
+	//so the task overhead is below 0.01% of the processing of a file.
 	for (int i = 0; i < iterationCount; i++)
 	{
-		//Lock the thread pool until all tasks have been pushed to avoid competing for the tasks mutex
-		_threadPool.setIsRunning(false);
-
-		for (fs::path const& file : toProcessFiles)
+		//Files are sorted by descending expected cost so that the most expensive files start first
+		for (size_t fileIndex = 0u; fileIndex < toProcessFiles.size(); fileIndex++)
 		{
-			auto parsingTaskLambda = [&fileParser, &file](TaskBase*) -> FileParsingResult
+			fs::path const&			file					= toProcessFiles[fileIndex];
+			FileProcessingStats&	fileStats				= stats[fileIndex];
+			TranslationUnitUsage&	translationUnitUsage	= translationUnitUsages[i * toProcessFiles.size() + fileIndex];
+			bool					isLastIteration			= i == iterationCount - 1;
+
+			//Memory of the translation unit, also released if the parsing task is skipped
+			std::shared_ptr<MemoryBudget::Admission> admission = std::make_shared<MemoryBudget::Admission>();
+
+			auto parsingTaskLambda = [this, &fileParser, &file, &fileStats, &translationUnitUsage, &cancellationToken, &onFileProcessed, useParsingWorkers, buildProjectStructClassTree, shouldFailFast, parsingTimeout, isLastIteration, admission](TaskBase*) -> FileParsingResult
 			{
-				//Copy a parser for this task
-				FileParserType		fileParserCopy = fileParser;
-				FileParsingResult	parsingResult;
+				FileParsingResult parsingResult;
+
+				TimingReport::Clock::time_point start = TimingReport::Clock::now();
+
+				if (useParsingWorkers)
+				{
+					parsingWorkerPool->parse(file, parsingResult, parsingTimeout, cancellationToken);
+
+					//The entity index references entities, so it is rebuilt on the deserialized result
+					if (fileParser.getSettings().shouldBuildEntityIndex)
+					{
+						parsingResult.buildEntityIndex();
+					}
+				}
+				else
+				{
+					//Copy a parser for this task
+					FileParserType fileParserCopy = fileParser;
+
+					fileParserCopy.parse(file, parsingResult, cancellationToken);
+				}
+
+				//The translation unit is disposed once parsed
+				admission->release();
+
+				if (shouldFailFast && !parsingResult.errors.empty())
+				{
+					failFast("Failed to parse " + file.string() + ": " + parsingResult.errors.front().getDescription());
+				}
 
-				fileParserCopy.parse(file, parsingResult);
+				TimingReport::Clock::time_point end = TimingReport::Clock::now();
+
+				parsingResult.timings.addSpan("File", "Parse", file.string(), start, end);
+				fileStats.parseDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+				//Memory accounting
+				translationUnitUsage			= TranslationUnitUsage{ start, end, parsingResult.translationUnitMemory };
+				fileStats.translationUnitMemory	= std::max(fileStats.translationUnitMemory, parsingResult.translationUnitMemory);
+				fileStats.parsingResultMemory	= std::max(fileStats.parsingResultMemory, parsingResult.getMemorySize());
+
+				if (buildProjectStructClassTree)
+				{
+					_projectStructClassTree.addInheritanceLinks(file, parsingResult.structClassTree);
+				}
+
+				if (isLastIteration && onFileProcessed)
+				{
+					onFileProcessed(file, EFileProcessingStep::Parsed, parsingResult.errors.empty());
+				}
 
 				return parsingResult;
 			};
 
-			auto generationTaskLambda = [&codeGenUnit](TaskBase* parsingTask) -> CodeGenResult
+			//Add file to the list of parsed files before starting the task to avoid having to synchronize threads
+			out_genResult.parsedFiles.push_back(file);
+
+			std::shared_ptr<TaskBase> parsingTask = std::make_shared<Task<FileParsingResult>>("Parsing", std::move(parsingTaskLambda), std::vector<std::shared_ptr<TaskBase>>(), cancellationToken);
+
+			parsingTasks[fileIndex] = parsingTask;
+
+			//The parsing task is submitted once its translation unit fits in the memory budget, so that no worker waits for memory
+			memoryBudget.admit(admission, translationUnitsMemory[fileIndex], [executor = _executor, parsingTask]() { executor->enqueueTask(parsingTask, ETaskPriority::Normal); });
+		}
+
+		//The project struct/class tree is complete once all files of the iteration have been parsed
+		std::shared_ptr<TaskBase> projectStructClassTreeTask;
+
+		if (buildProjectStructClassTree)
+		{
+			projectStructClassTreeTask = _executor->submitTask("Project tree", [this](TaskBase*) { _projectStructClassTree.freeze(); },
+																std::vector<std::shared_ptr<TaskBase>>(parsingTasks), cancellationToken, ETaskPriority::High);
+		}
+
+		for (size_t fileIndex = 0u; fileIndex < toProcessFiles.size(); fileIndex++)
+		{
+			fs::path const&			file		= toProcessFiles[fileIndex];
+			FileProcessingStats&	fileStats	= stats[fileIndex];
+			bool					isLastIteration	= i == iterationCount - 1;
+
+			auto generationTaskLambda = [this, &codeGenUnit, &file, &fileStats, &onFileProcessed, projectStructClassTree, entityCodeCache, shouldFailFast, isLastIteration](TaskBase* parsingTask) -> CodeGenResult
 			{
+				TimingReport::Clock::time_point start = TimingReport::Clock::now();
+
 				CodeGenResult out_generationResult;
 
 				//Copy the generation unit model to have a fresh one for this generation unit
@@ -48,38 +140,123 @@ void CodeGenManager::processFiles(FileParserType& fileParser, CodeGenUnitType& c
 				//Generate the file if no errors occured during parsing
 				if (parsingResult.errors.empty())
 				{
-					out_generationResult.completed = generationUnit.generateCode(parsingResult);
+					out_generationResult.completed = generationUnit.generateCode(parsingResult, &out_generationResult.timings, projectStructClassTree, entityCodeCache);
+
+					if (shouldFailFast && !out_generationResult.completed)
+					{
+						failFast("Failed to generate code for " + file.string() + ".");
+					}
+				}
+
+				//Forward the parsing spans to the generation result so that they are collected with the other results
+				out_generationResult.timings.mergeReport(std::move(parsingResult.timings));
+
+				TimingReport::Clock::time_point end = TimingReport::Clock::now();
+
+				out_generationResult.timings.addSpan("File", "Generate", file.string(), start, end);
+				fileStats.generationDuration += std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+				if (isLastIteration && onFileProcessed)
+				{
+					onFileProcessed(file, EFileProcessingStep::Generated, out_generationResult.completed);
 				}
 
 				return out_generationResult;
 			};
 
-			//Add file to the list of parsed files before starting the task to avoid having to synchronize threads
-			out_genResult.parsedFiles.push_back(file);
+			std::vector<std::shared_ptr<TaskBase>> dependencies{ parsingTasks[fileIndex] };
 
-			//Parse files
-			//For multiple iterations on a same file, the parsing task depends on the previous generation task for the same file
-			parsingTask = _threadPool.submitTask(std::string("Parsing ") + std::to_string(i), parsingTaskLambda);
+			if (projectStructClassTreeTask != nullptr)
+			{
+				dependencies.push_back(projectStructClassTreeTask);
+			}
 
-			//Generate code
-			generationTasks.emplace_back(_threadPool.submitTask(std::string("Generation ") + std::to_string(i), generationTaskLambda, { parsingTask }));
+			//Generate code before starting new parsings, so that parsing results are released as soon as possible
+			generationTasks.emplace_back(_executor->submitTask("Generation", generationTaskLambda, std::move(dependencies), cancellationToken, ETaskPriority::High));
 		}
 
 		//Wait for this iteration to complete before continuing any further
 		//(an iteration N depends on the iteration N - 1)
-		_threadPool.setIsRunning(true);
-		_threadPool.joinWorkers();
+		//A generation task finishes after all its dependencies, so waiting for generation tasks is enough
+		for (size_t taskIndex = generationTasks.size() - toProcessFiles.size(); taskIndex < generationTasks.size(); taskIndex++)
+		{
+			_executor->waitTask(*generationTasks[taskIndex]);
+		}
 	}
 
 	//Merge all generation results together
-	for (std::shared_ptr<TaskBase>& task : generationTasks)
+	size_t lastIterationFirstTask = generationTasks.size() - toProcessFiles.size();
+
+	for (size_t i = 0u; i < generationTasks.size(); i++)
+	{
+		//Cancelled files are invalidated in the file manifest so that they are processed by the next run
+		if (generationTasks[i]->wasCancelled())
+		{
+			if (i >= lastIterationFirstTask)
+			{
+				out_genResult.skippedFiles.push_back(toProcessFiles[i - lastIterationFirstTask]);
+				_fileManifest.invalidate(out_genResult.skippedFiles.back());
+
+				if (onFileProcessed)
+				{
+					onFileProcessed(out_genResult.skippedFiles.back(), EFileProcessingStep::Skipped, false);
+				}
+			}
+
+			out_genResult.completed = false;
+
+			continue;
+		}
+
+		CodeGenResult generationResult = TaskHelper::getResult<CodeGenResult>(generationTasks[i].get());
+
+		//Files are recorded in the file manifest after their last iteration
+		if (i >= lastIterationFirstTask)
+		{
+			size_t fileIndex = i - lastIterationFirstTask;
+
+			recordProcessedFile(codeGenUnit, toProcessFiles[fileIndex], generationResult.completed, stats[fileIndex]);
+		}
+
+		out_genResult.mergeResult(std::move(generationResult));
+	}
+
+	//Report memory usage
+	out_genResult.filesMemoryUsage.reserve(out_genResult.filesMemoryUsage.size() + toProcessFiles.size());
+
+	for (size_t fileIndex = 0u; fileIndex < toProcessFiles.size(); fileIndex++)
 	{
-		out_genResult.mergeResult(TaskHelper::getResult<CodeGenResult>(task.get()));
+		out_genResult.filesMemoryUsage.push_back(FileMemoryUsage{ toProcessFiles[fileIndex], stats[fileIndex].translationUnitMemory, stats[fileIndex].parsingResultMemory });
 	}
+
+	out_genResult.peakTranslationUnitsMemory = std::max(out_genResult.peakTranslationUnitsMemory, computePeakTranslationUnitsMemory(translationUnitUsages));
+
+	if (!out_genResult.skippedFiles.empty() && logger != nullptr)
+	{
+		logger->log(std::to_string(out_genResult.skippedFiles.size()) + " file(s) skipped since the generation was cancelled.", ILogger::ELogSeverity::Warning);
+	}
+}
+
+template <typename FileParserType, typename CodeGenUnitType>
+CodeGenResult CodeGenManager::run(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, bool forceRegenerateAll, FileProcessedCallback onFileProcessed) noexcept
+{
+	return runInternal(fileParser, codeGenUnit, forceRegenerateAll, onFileProcessed, resetCancellation());
+}
+
+template <typename FileParserType, typename CodeGenUnitType>
+CodeGenRunHandle CodeGenManager::runAsync(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, bool forceRegenerateAll, FileProcessedCallback onFileProcessed) noexcept
+{
+	//Reset the cancellation before submitting the run so that the returned handle can cancel it right away
+	std::shared_ptr<TaskBase> runTask = _executor->submitTask("Run", [this, &fileParser, &codeGenUnit, forceRegenerateAll, onFileProcessed = std::move(onFileProcessed), cancellationToken = resetCancellation()](TaskBase*)
+	{
+		return runInternal(fileParser, codeGenUnit, forceRegenerateAll, onFileProcessed, cancellationToken);
+	}, {}, CancellationToken(), ETaskPriority::High);
+
+	return CodeGenRunHandle(*this, *_executor, std::move(runTask));
 }
 
 template <typename FileParserType, typename CodeGenUnitType>
-CodeGenResult CodeGenManager::run(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, bool forceRegenerateAll) noexcept
+CodeGenResult CodeGenManager::runInternal(FileParserType& fileParser, CodeGenUnitType& codeGenUnit, bool forceRegenerateAll, FileProcessedCallback const& onFileProcessed, CancellationToken const& cancellationToken) noexcept
 {
 	//Check FileParser validity
 	static_assert(std::is_base_of_v<FileParser, FileParserType>, "fileParser type must be a derived class of kodgen::FileParser.");
@@ -99,23 +276,129 @@ CodeGenResult CodeGenManager::run(FileParserType& fileParser, CodeGenUnitType& c
 	else
 	{
 		//Start timer here
-		auto				start			= std::chrono::high_resolution_clock::now();
-		std::set<fs::path>	filesToProcess	= identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
+		auto					start			= std::chrono::high_resolution_clock::now();
+		TimingReport&			timings			= genResult.timings;
+		std::set<fs::path>		identifiedFiles;
+		std::vector<fs::path>	filesToProcess;
 
-		//Don't setup anything if there are no files to generate
-		if (filesToProcess.size() > 0u)
 		{
-			//Initialize the parsing settings to setup parser compilation arguments.
-			//parsingSettings can't be nullptr since it has been checked in the checkGenerationSetup call.
-			fileParser.getSettings().init(logger);
+			ScopedTimingSpan span(&timings, "Phase", "Identify files");
 
-			generateMacrosFile(fileParser.getSettings(), codeGenUnit.getSettings()->getOutputDirectory());
+			identifiedFiles	= identifyFilesToProcess(codeGenUnit, genResult, forceRegenerateAll);
+			filesToProcess	= scheduleFiles(identifiedFiles, codeGenUnit.getSettings()->getOutputDirectory());
+		}
+
+		if (settings.getShardCount() > 1u && logger != nullptr)
+		{
+			logger->log("Shard " + std::to_string(settings.getShardIndex()) + "/" + std::to_string(settings.getShardCount()) + ": process " +
+						std::to_string(filesToProcess.size()) + " of " + std::to_string(identifiedFiles.size()) + " files.");
+		}
+
+		//Don't setup anything if there are no files to generate in any shard
+		if (!identifiedFiles.empty())
+		{
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Init parsing settings");
+
+				//Initialize the parsing settings to setup parser compilation arguments.
+				//parsingSettings can't be nullptr since it has been checked in the checkGenerationSetup call.
+				fileParser.getSettings().init(logger);
+			}
+
+			//The macros file is shared by all shards, so it is written by a single one
+			if (settings.getShardIndex() == 0u)
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Generate macros file");
+
+				generateMacrosFile(fileParser.getSettings(), codeGenUnit.getSettings()->getOutputDirectory());
+			}
+		}
+
+		//Files restored from the artifact cache are neither parsed nor generated
+		std::vector<opt::optional<uint64>> artifactKeys;
+
+		if (!settings.getArtifactCacheDirectory().empty() && !filesToProcess.empty())
+		{
+			ScopedTimingSpan span(&timings, "Phase", "Restore artifacts");
+
+			artifactKeys = restoreArtifacts(fileParser.getSettings(), codeGenUnit, forceRegenerateAll, filesToProcess, onFileProcessed, genResult);
+		}
+
+		//Links of up-to-date files are loaded even if no file is processed, so that the tree is always complete after a run
+		if (settings.shouldBuildProjectStructClassTree())
+		{
+			ScopedTimingSpan span(&timings, "Phase", "Load project struct class tree");
+
+			prepareProjectStructClassTree(codeGenUnit, filesToProcess);
+		}
+
+		//Code generators can check inheritance across files, which is not part of the entity hashes
+		if (settings.shouldCacheEntityCode() && settings.shouldBuildProjectStructClassTree() && logger != nullptr)
+		{
+			logger->log("The entity code cache is not used since the project struct class tree is built.", ILogger::ELogSeverity::Warning);
+		}
+
+		//Run-wide files are also written again when files are only removed
+		if (!filesToProcess.empty() || !genResult.removedFiles.empty())
+		{
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Pre-process files");
+
+				codeGenUnit.preProcessFiles(genResult.removedFiles);
+			}
+
+			if (shouldUseEntityCodeCache())
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Load entity code cache");
+
+				prepareEntityCodeCache(codeGenUnit);
+			}
+
+			if (!filesToProcess.empty())
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Process files");
+
+				//Start files processing
+				processFiles(fileParser, codeGenUnit, filesToProcess, cancellationToken, onFileProcessed, genResult);
+			}
+
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Post-process files");
+
+				//Write run-wide files once all files have been processed
+				genResult.completed &= codeGenUnit.postProcessFiles();
+			}
+
+			if (shouldUseEntityCodeCache())
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Save entity code cache");
+
+				saveEntityCodeCache(codeGenUnit);
+			}
+
+			if (!artifactKeys.empty())
+			{
+				ScopedTimingSpan span(&timings, "Phase", "Publish artifacts");
+
+				publishArtifacts(codeGenUnit, filesToProcess, artifactKeys);
+			}
+		}
+
+		if (settings.shouldBuildProjectStructClassTree() && settings.shouldPersistProjectStructClassTree())
+		{
+			ScopedTimingSpan span(&timings, "Phase", "Save project struct class tree");
+
+			saveProjectStructClassTree(codeGenUnit);
+		}
+
+		{
+			ScopedTimingSpan span(&timings, "Phase", "Save file manifest");
 
-			//Start files processing
-			processFiles(fileParser, codeGenUnit, filesToProcess, genResult);
+			saveFileManifest(codeGenUnit);
 		}
 
-		genResult.duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count() * 0.001f;
+		genResult.peakResidentSetSize	= MemoryHelpers::getPeakResidentSetSize();
+		genResult.duration				= std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - start).count() * 0.001f;
 	}
 	
 	return genResult;
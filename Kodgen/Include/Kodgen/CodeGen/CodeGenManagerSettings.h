@@ -12,6 +12,7 @@
 
 #include "Kodgen/Misc/Settings.h"
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
 {
@@ -50,6 +51,33 @@ namespace kodgen
 			/** Extensions of files that should be considered for code generation. */
 			std::unordered_set<std::string>			_supportedFileExtensions;
 
+			/** Index of the shard processed by the generation, in [0, _shardCount[. */
+			uint32									_shardIndex						= 0u;
+
+			/** Number of shards the files to process are split into. */
+			uint32									_shardCount						= 1u;
+
+			/** Should the inheritance links of all parsed files be gathered in a ProjectStructClassTree before generating code. */
+			bool									_buildProjectStructClassTree	= false;
+
+			/** Should the ProjectStructClassTree be saved in the output directory and reloaded by the next run. */
+			bool									_persistProjectStructClassTree	= false;
+
+			/** Should the generation stop scheduling new work as soon as a file fails to be parsed or generated. */
+			bool									_failFast						= false;
+
+			/** Memory (in MiB) the translation units parsed at the same time can use. 0 to share the process budget deduced from the cgroup memory limit. */
+			uint64									_memoryBudget					= 0u;
+
+			/** Should the code generated for each entity be saved in the output directory and reused by the next generations while the entity is unchanged. */
+			bool									_cacheEntityCode				= false;
+
+			/** Directory, possibly shared between machines, storing the files generated from each source file. Empty to disable the artifact cache. */
+			fs::path								_artifactCacheDirectory;
+
+			/** Directory the paths stored in the artifact cache are relative to. Empty to use the deepest directory containing the output directory and the processed files. */
+			fs::path								_artifactCacheRootDirectory;
+
 			/** Dirty flag set if _toProcessFiles hasn't been refreshed since last modification. */
 			bool									_toProcessFilesDirtyFlag		= false;
 
@@ -132,6 +160,70 @@ namespace kodgen
 			void			loadIgnoredDirectories(toml::value const&	generationSettings,
 												   ILogger*				logger)					noexcept;
 
+			/**
+			*	@brief	Load the _shardIndex and _shardCount settings from toml.
+			*			The settings are left unchanged if the loaded values are invalid.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadShard(toml::value const&	generationSettings,
+									  ILogger*				logger)								noexcept;
+
+			/**
+			*	@brief Load the _buildProjectStructClassTree and _persistProjectStructClassTree settings from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadProjectStructClassTree(toml::value const&	generationSettings,
+													   ILogger*				logger)				noexcept;
+
+			/**
+			*	@brief Load the _failFast setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadFailFast(toml::value const&	generationSettings,
+										 ILogger*			logger)								noexcept;
+
+			/**
+			*	@brief Load the _memoryBudget setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadMemoryBudget(toml::value const&	generationSettings,
+											 ILogger*			logger)							noexcept;
+
+			/**
+			*	@brief Load the _cacheEntityCode setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadEntityCodeCache(toml::value const&	generationSettings,
+												ILogger*			logger)						noexcept;
+
+			/**
+			*	@brief Load the _artifactCacheDirectory setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadArtifactCacheDirectory(toml::value const&	generationSettings,
+													   ILogger*				logger)				noexcept;
+
+			/**
+			*	@brief Load the _artifactCacheRootDirectory setting from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadArtifactCacheRootDirectory(toml::value const&	generationSettings,
+														   ILogger*				logger)			noexcept;
+
 		public:
 			/**
 			*	@brief	Add a file to the list of processed files.
@@ -243,6 +335,80 @@ namespace kodgen
 			*/
 			void clearSupportedFileExtensions()								noexcept;
 
+			/**
+			*	@brief	Split the files to process into shardCount shards and only process the shard shardIndex.
+			*			Each generation run (possibly in different processes or on different machines) processes one shard
+			*			so that the parsing work is spread between runs. The entity macros file is written by the shard 0 only.
+			*			Files are assigned to shards by a hash of their path relative to the output directory, so every file belongs
+			*			to exactly one shard, whatever the file manifest of each run. Each shard only processes its files which are out of date.
+			*
+			*	@param shardIndex Index of the shard to process. Must be less than shardCount.
+			*	@param shardCount Number of shards. 1 disables sharding.
+			*
+			*	@return true if the shard has been set successfully, else false.
+			*/
+			bool setShard(uint32 shardIndex,
+						  uint32 shardCount)									noexcept;
+
+			/**
+			*	@brief	Gather the inheritance links of all parsed files in a ProjectStructClassTree, available to the code generators through
+			*			CodeGenEnv::getProjectStructClassTree. Code generation then starts once all files of an iteration have been parsed,
+			*			so all parsing results are kept in memory at the same time.
+			*
+			*	@param build	Should the tree be built.
+			*	@param persist	Should the tree be saved in the output directory and reloaded by the next run,
+			*					so that incremental runs know the links of the up-to-date files.
+			*/
+			void setProjectStructClassTree(bool build,
+										   bool persist = true)							noexcept;
+
+			/**
+			*	@brief	Stop the generation as soon as a file fails to be parsed or generated.
+			*			Files which were not processed yet are skipped and reported in CodeGenResult::skippedFiles.
+			*
+			*	@param failFast Should the generation stop on the first failure.
+			*/
+			void setFailFast(bool failFast)												noexcept;
+
+			/**
+			*	@brief	Limit the memory used by the translation units parsed at the same time. A file is parsed once the expected memory
+			*			of its translation unit (recorded by the previous run, or estimated from its size) fits in the budget.
+			*			If 0, the managers of the process share a single budget of 3/4 of the memory left by the cgroup v2 memory limit
+			*			when the first generation starts, which is unlimited if there is no such limit.
+			*
+			*	@param memoryBudget Memory budget in MiB, or 0 to share the budget deduced from the cgroup memory limit.
+			*/
+			void setMemoryBudget(uint64 memoryBudget)									noexcept;
+
+			/**
+			*	@brief	Save the code generated for each entity by the generators returning a cache fingerprint (see ICodeGenerator::getCacheFingerprint)
+			*			in the output directory. When a file is generated again, the code of its unchanged entities is reused instead of being generated.
+			*			The entity code cache is not used when the project struct class tree is built.
+			*
+			*	@param cacheEntityCode Should the generated code be cached per entity.
+			*/
+			void setEntityCodeCache(bool cacheEntityCode)								noexcept;
+
+			/**
+			*	@brief	Store the files generated from each source file in a directory which can be shared between machines.
+			*			A file whose source code, included files, compilation arguments and code generators (see CodeGenUnit::getCacheFingerprint)
+			*			match a stored artifact gets its generated files restored from the artifact instead of being parsed and generated.
+			*			The artifact cache is not used when the project struct class tree is built, nor for units which can't be cached.
+			*
+			*	@param artifactCacheDirectory Directory containing the artifacts, or an empty path to disable the artifact cache.
+			*/
+			void setArtifactCacheDirectory(fs::path const& artifactCacheDirectory)		noexcept;
+
+			/**
+			*	@brief	Set the directory the paths stored in the artifact cache are relative to.
+			*			Machines sharing the artifact cache get the same keys as long as the project has the same layout under this directory,
+			*			wherever it is located. Paths outside of this directory, like the system headers, stay absolute.
+			*
+			*	@param artifactCacheRootDirectory	Root directory of the project, or an empty path to use the deepest directory
+			*										containing the output directory and the processed files and directories.
+			*/
+			void setArtifactCacheRootDirectory(fs::path const& artifactCacheRootDirectory)	noexcept;
+
 			/**
 			*	@brief	Check whether the provided extension is a supported file extension or not.
 			* 
@@ -254,7 +420,7 @@ namespace kodgen
 
 			/**
 			*	@brief	Check whether the provided path is an ignored file or not.
-			*			The method is not const to allow the path sanitizer to run if the _ignoredFilesDirtyFlag is set.
+			*			The method is not const to allow the path sanitizer to run if the _ignoredFilesDirtyFlag is set (see sanitizeIgnoredPaths).
 			* 
 			*	@param file Path to the file.
 			* 
@@ -264,7 +430,7 @@ namespace kodgen
 
 			/**
 			*	@brief	Check whether the provided path is an ignored directory or not.
-			*			The method is not const to allow the path sanitizer to run if the _ignoredDirectoriesDirtyFlag is set.
+			*			The method is not const to allow the path sanitizer to run if the _ignoredDirectoriesDirtyFlag is set (see sanitizeIgnoredPaths).
 			* 
 			*	@param directory Path to the directory.
 			* 
@@ -272,6 +438,13 @@ namespace kodgen
 			*/
 			bool isIgnoredDirectory(fs::path const& directory)					noexcept;
 
+			/**
+			*	@brief	Sanitize the ignored files and directories added since the last sanitization.
+			*			isIgnoredFile and isIgnoredDirectory don't modify the settings once this method has been called,
+			*			so they can be called concurrently until an ignored path is added again.
+			*/
+			void sanitizeIgnoredPaths()											noexcept;
+
 
 			/**
 			*	@brief Getter for _toProcessFiles.
@@ -307,5 +480,68 @@ namespace kodgen
 			*	@return _supportedExtensions.
 			*/
 			std::unordered_set<std::string> const&			getSupportedExtensions()	const	noexcept;
+
+			/**
+			*	@brief Getter for _shardIndex.
+			*	
+			*	@return _shardIndex.
+			*/
+			uint32											getShardIndex()				const	noexcept;
+
+			/**
+			*	@brief Getter for _shardCount.
+			*	
+			*	@return _shardCount.
+			*/
+			uint32											getShardCount()				const	noexcept;
+
+			/**
+			*	@brief Getter for _buildProjectStructClassTree field.
+			*
+			*	@return _buildProjectStructClassTree.
+			*/
+			bool											shouldBuildProjectStructClassTree()		const	noexcept;
+
+			/**
+			*	@brief Getter for _persistProjectStructClassTree field.
+			*
+			*	@return _persistProjectStructClassTree.
+			*/
+			bool											shouldPersistProjectStructClassTree()	const	noexcept;
+
+			/**
+			*	@brief Getter for _failFast field.
+			*
+			*	@return _failFast.
+			*/
+			bool											shouldFailFast()						const	noexcept;
+
+			/**
+			*	@brief Getter for _memoryBudget field.
+			*
+			*	@return _memoryBudget.
+			*/
+			uint64											getMemoryBudget()						const	noexcept;
+
+			/**
+			*	@brief Getter for _cacheEntityCode field.
+			*
+			*	@return _cacheEntityCode.
+			*/
+			bool											shouldCacheEntityCode()					const	noexcept;
+
+			/**
+			*	@brief Getter for _artifactCacheDirectory field.
+			*
+			*	@return _artifactCacheDirectory.
+			*/
+			fs::path const&									getArtifactCacheDirectory()				const	noexcept;
+
+			/**
+			*	@brief Getter for _artifactCacheRootDirectory field.
+			*
+			*	@return _artifactCacheRootDirectory.
+			*/
+			fs::path const&									getArtifactCacheRootDirectory()			const	noexcept;
 	};
 }
\ No newline at end of file
@@ -10,26 +10,59 @@
 #include <vector>
 
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/TimingReport.h"
+#include "Kodgen/CodeGen/FileMemoryUsage.h"
 
 namespace kodgen
 {
 	class CodeGenResult
 	{
+		private:
+			/** Version written at the top of a saved result file. Files with a different version are not loaded. */
+			static constexpr char const*	_header						= "KODGEN_RESULT 2";
+
 		public:
 			/**
 			*	This boolean is set to true if the whole generation process has been completed successfully,
 			*	and false otherwise. Make sure to check the logs to get some hints about the failure cause.
 			*/
-			bool					completed	= false;
+			bool							completed					= false;
 
 			/** Time elapsed (in seconds) to discover files to parse, parse, generate and collect results of all files. */
-			float					duration	= 0.0f;
+			float							duration					= 0.0f;
 
 			/** List of paths to files that have been parsed and got their metadata regenerated. */
-			std::vector<fs::path>	parsedFiles;
+			std::vector<fs::path>			parsedFiles;
 
 			/** List of paths to files which metadata are up-to-date. */
-			std::vector<fs::path>	upToDateFiles;
+			std::vector<fs::path>			upToDateFiles;
+
+			/** List of paths to files which generated files have been restored from the artifact cache instead of being parsed and generated. */
+			std::vector<fs::path>			restoredFiles;
+
+			/** List of paths to files which were not generated because the generation was cancelled, or stopped by the fail-fast policy. */
+			std::vector<fs::path>			skippedFiles;
+
+			/** List of paths to files processed by a previous run which have been deleted, ignored or moved out of the processed directories since. */
+			std::vector<fs::path>			removedFiles;
+
+			/**
+			*	Timing spans recorded during the generation process:
+			*	run phases, parsing and generation of each file, and time spent in each code generator.
+			*/
+			TimingReport					timings;
+
+			/** Memory used to process each parsed file. If a file is processed over multiple iterations, the highest values are kept. */
+			std::vector<FileMemoryUsage>	filesMemoryUsage;
+
+			/**
+			*	Highest memory used at the same time by the translation units of the files parsed concurrently, in bytes.
+			*	It is an upper bound: a translation unit is considered alive during the whole parsing task of its file.
+			*/
+			uint64							peakTranslationUnitsMemory	= 0u;
+
+			/** Highest resident set size reached by the process at the end of the generation, in bytes. */
+			uint64							peakResidentSetSize			= 0u;
 
 			/**
 			*	@brief Merge a result to this result.
@@ -37,6 +70,35 @@ namespace kodgen
 			*	@param otherResult	The result to merge with this result.
 			*						After the call, otherResult state is UB.
 			*/
-			void mergeResult(CodeGenResult&& otherResult)	noexcept;
+			void							mergeResult(CodeGenResult&& otherResult)	noexcept;
+
+			/**
+			*	@brief	Write the result to a file so that it can be merged with the results of the other shards of a generation.
+			*			Timing spans are not written.
+			*
+			*	@param resultFile Path to the file to write.
+			*
+			*	@return true if the result was written successfully, else false.
+			*/
+			bool							save(fs::path const& resultFile)	const	noexcept;
+
+			/**
+			*	@brief Load a result previously written with CodeGenResult::save. The current content of the result is replaced.
+			*
+			*	@param resultFile Path to the file to read.
+			*
+			*	@return true if the result was loaded successfully, else false.
+			*/
+			bool							load(fs::path const& resultFile)			noexcept;
+
+			/**
+			*	@brief	Combine the results of all shards of a generation into a single result.
+			*			Shards run concurrently, so the merged duration is the duration of the slowest shard.
+			*
+			*	@param shardResults	Results of all shards. After the call, the results state is UB.
+			*
+			*	@return The merged result. It is completed only if all shards completed.
+			*/
+			static CodeGenResult			mergeShardResults(std::vector<CodeGenResult>&& shardResults)	noexcept;
 	};
 }
\ No newline at end of file
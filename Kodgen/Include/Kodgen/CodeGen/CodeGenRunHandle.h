@@ -0,0 +1,68 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <memory>	//std::shared_ptr
+
+#include "Kodgen/CodeGen/CodeGenResult.h"
+#include "Kodgen/Threading/IExecutor.h"
+
+namespace kodgen
+{
+	//Forward declaration
+	class CodeGenManager;
+
+	/**
+	*	Handle on a run started with CodeGenManager::runAsync.
+	*/
+	class CodeGenRunHandle
+	{
+		private:
+			/** Manager running the generation. */
+			CodeGenManager*				_manager	= nullptr;
+
+			/** Executor running the task of the run. */
+			IExecutor*					_executor	= nullptr;
+
+			/** Task running the generation. Its result is the CodeGenResult of the run. */
+			std::shared_ptr<TaskBase>	_task;
+
+		public:
+			CodeGenRunHandle()	= default;
+			CodeGenRunHandle(CodeGenManager&			manager,
+							 IExecutor&					executor,
+							 std::shared_ptr<TaskBase>	task)				noexcept;
+
+			/**
+			*	@brief Check whether the handle refers to a run which has not been joined yet.
+			*
+			*	@return true if the handle can be joined, else false.
+			*/
+			bool			isValid()						const	noexcept;
+
+			/**
+			*	@brief Check whether the run has finished. The handle must be valid.
+			*
+			*	@return true if the run has finished, else false.
+			*/
+			bool			isFinished()					const	noexcept;
+
+			/**
+			*	@brief Cancel the run. See CodeGenManager::cancel. The handle must be valid.
+			*/
+			void			cancel()								noexcept;
+
+			/**
+			*	@brief	Wait for the run to finish and get its result. The handle must be valid, and is invalid after the call.
+			*			Calling it from a task of the executor is supported (see IExecutor::waitTask).
+			*
+			*	@return The result of the run.
+			*/
+			CodeGenResult	join()									noexcept;
+	};
+}
\ No newline at end of file
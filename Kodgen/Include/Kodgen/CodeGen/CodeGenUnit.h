@@ -8,6 +8,7 @@
 #pragma once
 
 #include <vector>
+#include <unordered_map>
 #include <functional>	//std::function
 
 #include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
@@ -15,6 +16,7 @@
 #include "Kodgen/CodeGen/CodeGenEnv.h"
 #include "Kodgen/CodeGen/CodeGenUnitSettings.h"
 #include "Kodgen/CodeGen/CodeGenModule.h"
+#include "Kodgen/CodeGen/EntityCodeCache.h"
 #include "Kodgen/Misc/ILogger.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
@@ -32,6 +34,29 @@ namespace kodgen
 			*/
 			bool						_isCopy	= false;
 
+			/** State of the entity code cache during a CodeGenUnit::generateCode call. */
+			struct EntityCodeCacheState
+			{
+				/** Cache the snippets are taken from and stored to. nullptr if the generated code is not cached. */
+				EntityCodeCache*								cache					= nullptr;
+
+				/** Snippets stored by the previous generation of the file, moved to snippets as they are reused. */
+				EntityCodeCache::FileSnippets					previousSnippets;
+
+				/** Snippets generated or reused by the current generation of the file. */
+				EntityCodeCache::FileSnippets					snippets;
+
+				/** Structural hash of the entities hashed so far. */
+				std::unordered_map<EntityInfo const*, uint64>	entityHashes;
+
+				/** Last visited generator/entity pair, used to number the consecutive visits of an entity by a property code generator. */
+				ICodeGenerator const*							lastVisitedCodeGenerator	= nullptr;
+				EntityInfo const*								lastVisitedEntity			= nullptr;
+
+				/** Index of the current visit of lastVisitedEntity by lastVisitedCodeGenerator. */
+				uint32											visitIndex					= 0u;
+			}							_entityCodeCacheState;
+
 			/**
 			*	@brief Insert a code generator to a sorted vector ordered by generation order.
 			* 
@@ -159,6 +184,22 @@ namespace kodgen
 																  CodeGenEnv&		env,
 																  void const*		data)														noexcept;
 
+			/**
+			*	@brief	Same as CodeGenUnit::generateCodeForEntityInternal, but reuse the code generated by the previous generation of the file
+			*			if neither the entity nor the code generator cache fingerprint changed, and record the generated code otherwise.
+			* 
+			*	@param codeGenerator	The code generator to run for the entity. Its cache fingerprint must not be 0.
+			*	@param entity			The entity for which the generate generates code.
+			*	@param env				The environment structure.
+			*	@param data				Opaque data forwarded to the codeGenerator.generateCode call.
+			* 
+			*	@return A combined value of all the codeGenerator.generateCode calls, or the cached value if the code was reused.
+			*/
+			ETraversalBehaviour		generateCachedCodeForEntityInternal(ICodeGenerator&		codeGenerator,
+																		EntityInfo const&	entity,
+																		CodeGenEnv&			env,
+																		void const*			data)												noexcept;
+
 		protected:
 			/** Settings used for code generation. */
 			CodeGenUnitSettings const*	settings = nullptr;
@@ -272,6 +313,27 @@ namespace kodgen
 			*/
 			virtual bool				isUpToDate(fs::path const& sourceFile)			const	noexcept = 0;
 
+			/**
+			*	@brief	Get the paths of all files generated from the given source file.
+			*			The CodeGenManager uses them to detect up-to-date files from its persisted file manifest
+			*			without calling CodeGenUnit::isUpToDate. If no path is returned, the manifest is not used.
+			* 
+			*	@param sourceFile Path to the source file.
+			* 
+			*	@return The paths of all files generated from the source file.
+			*/
+			virtual std::vector<fs::path>	getGeneratedFilePaths(fs::path const& sourceFile)	const	noexcept;
+
+			/**
+			*	@brief	Get a fingerprint of everything, except the parsed source code, the files generated by this unit depend on.
+			*			The CodeGenManager uses it to key the generated files stored in the artifact cache.
+			*			The default implementation combines the types and cache fingerprints of all registered code generators
+			*			(see ICodeGenerator::getCacheFingerprint). Units with settings affecting the generated code must add them to the fingerprint.
+			* 
+			*	@return The fingerprint of this unit, or 0 if the generated files can't be cached (at least one code generator has no cache fingerprint).
+			*/
+			virtual uint64					getCacheFingerprint()								const	noexcept;
+
 			/**
 			*	@brief	Check whether all settings are setup correctly for this unit to work.
 			*			If output directory path is valid but doesn't exist yet, it is created.
@@ -282,6 +344,23 @@ namespace kodgen
 			*/
 			virtual bool				checkSettings()									const	noexcept;
 
+			/**
+			*	@brief	Called once by the CodeGenManager on the original (non-copied) unit before any file is processed.
+			*			Can be used to reset run-wide data shared between all copies of this unit.
+			* 
+			*	@param removedFiles	Files processed by a previous run which are not processed anymore (see CodeGenResult::removedFiles).
+			*						Their code should be removed from the run-wide files written by postProcessFiles.
+			*/
+			virtual void				preProcessFiles(std::vector<fs::path> const& removedFiles)	noexcept;
+
+			/**
+			*	@brief	Called once by the CodeGenManager on the original (non-copied) unit after all files have been processed.
+			*			Can be used to write run-wide files from data shared between all copies of this unit.
+			* 
+			*	@return true if the method completed successfully, else false.
+			*/
+			virtual bool				postProcessFiles()										noexcept;
+
 			/**
 			*	@brief	Calls preGenerateCode, foreachModuleEntityPair, and postGenerateCode in that order.
 			*			If any of the previously mentioned method returns false, the generation aborts (next methods
@@ -289,11 +368,17 @@ namespace kodgen
 			*
 			*			ex: If preGenerateCode returns false, both foreachModuleEntityPair and postGenerateCode calls will be skipped.
 			*			
-			*	@param parsingResult	Result of a file parsing used to generate code.
+			*	@param parsingResult			Result of a file parsing used to generate code.
+			*	@param timingReport				Report the generation steps durations are added to. Can be nullptr.
+			*	@param projectStructClassTree	Inheritance links of all the files of the run, forwarded to the CodeGenEnv. Can be nullptr.
+			*	@param entityCodeCache			Cache the code generated by generators with a cache fingerprint is reused from and stored to. Can be nullptr.
 			* 
 			*	@return true if preGenerateCode, foreachModuleEntityPair and postGenerateCode calls have succeeded, else false.
 			*/
-			bool						generateCode(FileParsingResult const& parsingResult)	noexcept;
+			bool						generateCode(FileParsingResult const&		parsingResult,
+													 TimingReport*					timingReport			= nullptr,
+													 ProjectStructClassTree const*	projectStructClassTree	= nullptr,
+													 EntityCodeCache*				entityCodeCache			= nullptr)	noexcept;
 
 			/**
 			*	@brief Add a module to the internal list of generation modules.
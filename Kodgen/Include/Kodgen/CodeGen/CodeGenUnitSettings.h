@@ -48,6 +48,15 @@ namespace kodgen
 			/** Name of the header containing all entity macro definitions. */
 			static inline fs::path const entityMacrosFilename	= "EntityMacros.h";
 
+			/** Name of the file recording the status of processed files, used to quickly detect up-to-date files. */
+			static inline fs::path const fileManifestFilename	= "KodgenManifest.txt";
+
+			/** Name of the file recording the inheritance links of the project, used by incremental runs. */
+			static inline fs::path const projectStructClassTreeFilename	= "KodgenStructClassTree.txt";
+
+			/** Name of the file recording the code generated for each entity, used by incremental runs. */
+			static inline fs::path const entityCodeCacheFilename		= "KodgenEntityCodeCache.txt";
+
 			/**
 			*	@brief	Setter for _outputDirectory.
 			*			If the path exists check that it is a directory.
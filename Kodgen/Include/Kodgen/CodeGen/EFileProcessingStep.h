@@ -0,0 +1,28 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	enum class EFileProcessingStep : uint8
+	{
+		/** The file has been parsed. */
+		Parsed		= 0,
+
+		/** The code of the file has been generated and written. */
+		Generated,
+
+		/** The file was not generated because the run was cancelled. */
+		Skipped,
+
+		/** The generated files have been restored from the artifact cache, the file was neither parsed nor generated. */
+		Restored
+	};
+}
\ No newline at end of file
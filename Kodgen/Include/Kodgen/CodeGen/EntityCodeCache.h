@@ -0,0 +1,170 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <unordered_map>
+#include <functional>	//std::function
+
+#include "Kodgen/CodeGen/ETraversalBehaviour.h"
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	//Forward declarations
+	class EntityInfo;
+	class TypeInfo;
+	class ICodeGenerator;
+
+	/**
+	*	Persisted cache of the code generated for each entity by each code generator, used to only regenerate the code of modified entities.
+	*	Snippets are keyed by a structural hash of the entity (including its properties, types, nested entities and outer entities properties)
+	*	and by the cache fingerprint of the generator (see ICodeGenerator::getCacheFingerprint), and are grouped by source file.
+	*/
+	class EntityCodeCache
+	{
+		public:
+			/** Code generated during one visit of an entity by a code generator. */
+			struct Snippet
+			{
+				/** Code appended by each generation call of the visit, in call order. */
+				std::vector<std::string>	codes;
+
+				/** Traversal behaviour returned by the visit. */
+				ETraversalBehaviour			traversalBehaviour	= ETraversalBehaviour::Recurse;
+			};
+
+			/** Snippets of a source file, by snippet key. */
+			using FileSnippets = std::unordered_map<uint64, Snippet>;
+
+		private:
+			/** Version written at the top of the cache file. Caches with a different version are discarded. */
+			static constexpr char const*							_header	= "KODGEN_ENTITY_CODE_CACHE 1";
+
+			/** Snippets of each source file. */
+			std::unordered_map<fs::path, FileSnippets, PathHash>	_fileSnippets;
+
+			/** Mutex used to synchronize the snippets of different source files. */
+			std::mutex												_mutex;
+
+			/**
+			*	@brief Add a type to a hash.
+			*
+			*	@param hash Hash to update.
+			*	@param type	Type to add.
+			*
+			*	@return The updated hash.
+			*/
+			static uint64	hashType(uint64				hash,
+									 TypeInfo const&	type)							noexcept;
+
+			/**
+			*	@brief Add the properties of an entity to a hash.
+			*
+			*	@param hash		Hash to update.
+			*	@param entity	Entity which properties are added.
+			*
+			*	@return The updated hash.
+			*/
+			static uint64	hashProperties(uint64				hash,
+										   EntityInfo const&	entity)					noexcept;
+
+			/**
+			*	@brief Add the data of an entity which is not an entity itself (types, qualifiers, values...) to a hash.
+			*
+			*	@param hash		Hash to update.
+			*	@param entity	Entity to add.
+			*
+			*	@return The updated hash.
+			*/
+			static uint64	hashEntityData(uint64				hash,
+										   EntityInfo const&	entity)					noexcept;
+
+		public:
+			/**
+			*	@brief	Compute the structural hash of an entity, which changes whenever the entity, its properties, its types, one of its nested entities
+			*			or the name or properties of one of its outer entities change.
+			*			The hashes of nested entities are computed as well and stored in the provided map, so that each entity is only hashed once.
+			*
+			*	@param entity			Entity to hash.
+			*	@param inout_hashes		Hashes of the entities hashed so far.
+			*
+			*	@return The hash of the entity.
+			*/
+			static uint64	computeEntityHash(EntityInfo const&								entity,
+											  std::unordered_map<EntityInfo const*, uint64>&	inout_hashes)	noexcept;
+
+			/**
+			*	@brief Compute the key of the snippet generated during a visit of an entity by a code generator.
+			*
+			*	@param entityHash		Structural hash of the entity.
+			*	@param codeGenerator	Code generator visiting the entity. Its cache fingerprint must not be 0.
+			*	@param visitIndex		Index of the visit among the consecutive visits of the entity by the code generator
+			*							(property code generators visit an entity once per property).
+			*
+			*	@return The snippet key.
+			*/
+			static uint64	computeSnippetKey(uint64				entityHash,
+											  ICodeGenerator const&	codeGenerator,
+											  uint32				visitIndex)			noexcept;
+
+			/**
+			*	@brief Load the cache from a file. Previously loaded snippets are discarded.
+			*
+			*	@param cacheFile Path to the cache file.
+			*
+			*	@return true if the cache was loaded successfully, else false.
+			*/
+			bool			load(fs::path const& cacheFile)										noexcept;
+
+			/**
+			*	@brief Write the cache to a file.
+			*
+			*	@param cacheFile Path to the cache file.
+			*
+			*	@return true if the cache was written successfully, else false.
+			*/
+			bool			save(fs::path const& cacheFile)								const	noexcept;
+
+			/**
+			*	@brief	Remove the snippets of a source file from the cache and return them.
+			*			This method is thread-safe.
+			*
+			*	@param sourceFile Path to the source file.
+			*
+			*	@return The snippets of the source file, empty if there are none.
+			*/
+			FileSnippets	takeFileSnippets(fs::path const& sourceFile)						noexcept;
+
+			/**
+			*	@brief	Replace the snippets of a source file.
+			*			This method is thread-safe.
+			*
+			*	@param sourceFile	Path to the source file.
+			*	@param snippets		New snippets of the source file.
+			*/
+			void			storeFileSnippets(fs::path const&	sourceFile,
+											  FileSnippets&&	snippets)						noexcept;
+
+			/**
+			*	@brief	Remove the snippets of the source files rejected by the predicate.
+			*			This method must not be called while snippets are being taken or stored.
+			*
+			*	@param shouldKeep Predicate returning true if the snippets of a source file must be kept.
+			*/
+			void			prune(std::function<bool(fs::path const&)> const& shouldKeep)		noexcept;
+
+			/**
+			*	@brief Remove all snippets.
+			*/
+			void			clear()																noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,183 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <utility>	//std::pair
+#include <mutex>
+#include <unordered_map>
+#include <functional>	//std::function
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FileStatus.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Persisted record of the status of each processed source file and of the files generated from it.
+	*	A source file whose status and generated files statuses didn't change since the last run
+	*	is up-to-date without having to query the CodeGenUnit.
+	*/
+	class FileManifest
+	{
+		private:
+			struct Entry
+			{
+				/** Status of the source file when its code was generated. */
+				FileStatus									sourceStatus;
+
+				/** Path and status of each file generated from the source file. */
+				std::vector<std::pair<fs::path, FileStatus>>	generatedFiles;
+
+				/** Duration (in microseconds) of the last parsing of the source file. */
+				uint64										parseDuration		= 0u;
+
+				/** Duration (in microseconds) of the last code generation for the source file. */
+				uint64										generationDuration	= 0u;
+
+				/** Memory (in bytes) used by the translation unit of the source file during its last parsing. */
+				uint64										translationUnitMemory	= 0u;
+			};
+
+			/** Version written at the top of the manifest file. Manifests with a different version are discarded. */
+			static constexpr char const*					_header	= "KODGEN_MANIFEST 2";
+
+			/** Entry of each source file. */
+			std::unordered_map<fs::path, Entry, PathHash>	_entries;
+
+			/** Mutex used to synchronize entries update. */
+			std::mutex										_mutex;
+
+		public:
+			/**
+			*	@brief Load the manifest from a file. Previously loaded entries are discarded.
+			* 
+			*	@param manifestFile Path to the manifest file.
+			* 
+			*	@return true if the manifest was loaded successfully, else false.
+			*/
+			bool					load(fs::path const& manifestFile)									noexcept;
+
+			/**
+			*	@brief Write the manifest to a file. The file is replaced atomically, so it is never left partially written.
+			* 
+			*	@param manifestFile Path to the manifest file.
+			* 
+			*	@return true if the manifest was written successfully, else false.
+			*/
+			bool					save(fs::path const& manifestFile)							const	noexcept;
+
+			/**
+			*	@brief	Check whether a source file and the files generated from it are unchanged since they were recorded.
+			*			This method doesn't modify the manifest and can be called concurrently.
+			* 
+			*	@param sourceFile		Path to the source file.
+			*	@param sourceStatus		Current status of the source file.
+			*	@param generatedFiles	Paths of the files which should be generated from the source file.
+			* 
+			*	@return true if the recorded entry matches the current state, else false.
+			*/
+			bool					isUpToDate(fs::path const&				sourceFile,
+											   FileStatus const&			sourceStatus,
+											   std::vector<fs::path> const&	generatedFiles)				const	noexcept;
+
+			/**
+			*	@brief	Check whether the entry of a source file has been invalidated (see invalidate).
+			*			The files generated from an invalidated source file can't be trusted, even if they are more recent than it.
+			*			This method doesn't modify the manifest and can be called concurrently.
+			* 
+			*	@param sourceFile Path to the source file.
+			* 
+			*	@return true if the source file has an invalidated entry, else false.
+			*/
+			bool					isInvalidated(fs::path const& sourceFile)						const	noexcept;
+
+			/**
+			*	@brief	Record the status of a source file and of the files generated from it.
+			*			Durations previously recorded for the source file are kept.
+			*			This method is thread-safe.
+			* 
+			*	@param sourceFile		Path to the source file.
+			*	@param sourceStatus		Status of the source file.
+			*	@param generatedFiles	Paths of the files generated from the source file.
+			*/
+			void					update(fs::path const&				sourceFile,
+										   FileStatus const&			sourceStatus,
+										   std::vector<fs::path> const&	generatedFiles)						noexcept;
+
+			/**
+			*	@brief	Record the durations of the last processing of a source file.
+			*			Nothing happens if the source file has no entry.
+			*			This method is thread-safe.
+			* 
+			*	@param sourceFile			Path to the source file.
+			*	@param parseDuration		Parsing duration in microseconds.
+			*	@param generationDuration	Code generation duration in microseconds.
+			*/
+			void					setDurations(fs::path const&	sourceFile,
+												 uint64				parseDuration,
+												 uint64				generationDuration)							noexcept;
+
+			/**
+			*	@brief Get the durations recorded during the last processing of a source file.
+			* 
+			*	@param sourceFile				Path to the source file.
+			*	@param out_parseDuration		Parsing duration in microseconds.
+			*	@param out_generationDuration	Code generation duration in microseconds.
+			* 
+			*	@return true if durations were recorded for the source file, else false.
+			*/
+			bool					getDurations(fs::path const&	sourceFile,
+												 uint64&			out_parseDuration,
+												 uint64&			out_generationDuration)				const	noexcept;
+
+			/**
+			*	@brief	Record the memory used by the translation unit of a source file during its last parsing.
+			*			Nothing happens if the source file has no entry.
+			*			This method is thread-safe.
+			* 
+			*	@param sourceFile				Path to the source file.
+			*	@param translationUnitMemory	Memory used by the translation unit in bytes.
+			*/
+			void					setTranslationUnitMemory(fs::path const&	sourceFile,
+															 uint64				translationUnitMemory)			noexcept;
+
+			/**
+			*	@brief Get the memory used by the translation unit of a source file during its last parsing.
+			* 
+			*	@param sourceFile Path to the source file.
+			* 
+			*	@return The memory used by the translation unit in bytes, or 0 if none was recorded.
+			*/
+			uint64					getTranslationUnitMemory(fs::path const& sourceFile)				const	noexcept;
+
+			/**
+			*	@brief	Invalidate the entry of a source file so that it is not considered up-to-date anymore.
+			*			Recorded durations are kept.
+			*			This method is thread-safe.
+			* 
+			*	@param sourceFile Path to the source file.
+			*/
+			void					invalidate(fs::path const& sourceFile)								noexcept;
+
+			/**
+			*	@brief Remove the entries of all source files which don't satisfy the provided predicate.
+			* 
+			*	@param shouldKeep Predicate returning true if the entry of the provided source file should be kept.
+			* 
+			*	@return The source files which entries have been removed, sorted by path.
+			*/
+			std::vector<fs::path>	prune(std::function<bool(fs::path const&)> const& shouldKeep)		noexcept;
+
+			/**
+			*	@brief Remove all entries from the manifest.
+			*/
+			void					clear()																noexcept;
+	};
+}
\ No newline at end of file
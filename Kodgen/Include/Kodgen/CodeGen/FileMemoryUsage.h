@@ -0,0 +1,26 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	struct FileMemoryUsage
+	{
+		/** Path to the processed file. */
+		fs::path	file;
+
+		/** Memory used by the libclang translation unit of the file, in bytes. */
+		uint64		translationUnitMemory	= 0u;
+
+		/** Memory used by the FileParsingResult produced for the file, in bytes. */
+		uint64		parsingResultMemory		= 0u;
+	};
+}
\ No newline at end of file
@@ -106,6 +106,19 @@ namespace kodgen
 			*/
 			virtual uint8				getIterationCount()															const	noexcept;
 
+			/**
+			*	@brief	The cache fingerprint allows the CodeGenUnit to reuse the code this generator generated for an entity during a previous generation
+			*			(see CodeGenManagerSettings::setEntityCodeCache), as long as neither the entity nor the fingerprint changed.
+			*			A generator returning a non-zero fingerprint guarantees that the code it generates for an entity only depends on
+			*			the entity, its outer entities names and properties and its nested entities, and that its pre/post generation hooks have no other effect.
+			*			The fingerprint must change whenever the generator implementation or settings change.
+			*			It is also part of the key of the files stored in the artifact cache (see CodeGenManagerSettings::setArtifactCacheDirectory).
+			*			Default fingerprint is 0, which disables caching for this generator.
+			* 
+			*	@return The cache fingerprint.
+			*/
+			virtual uint64				getCacheFingerprint()														const	noexcept;
+
 			ICodeGenerator& operator=(ICodeGenerator const&)	= default;
 			ICodeGenerator& operator=(ICodeGenerator&&)			= default;
 	};
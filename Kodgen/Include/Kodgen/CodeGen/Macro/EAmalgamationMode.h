@@ -0,0 +1,40 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	enum class EAmalgamationMode : uint8
+	{
+		/**
+		*	A generated source file is written for each parsed file (default behaviour).
+		*/
+		None = 0u,
+
+		/**
+		*	The generated source code of all parsed files located in the same directory
+		*	is gathered in a single amalgamation file named after the directory.
+		*/
+		PerDirectory,
+
+		/**
+		*	The generated source code of all parsed files is gathered in a single amalgamation file
+		*	named after the output directory.
+		*/
+		Single,
+
+		/**
+		*	The generated source code of all parsed files located in the same module directory (see MacroCodeGenUnitSettings::addAmalgamationModuleDirectory),
+		*	directly or not, is gathered in a single amalgamation file named after the module directory.
+		*	Parsed files located in no module directory are gathered per directory.
+		*/
+		PerModule
+	};
+}
\ No newline at end of file
@@ -10,9 +10,11 @@
 #include <string>
 #include <array>
 #include <unordered_map>
+#include <memory>	//std::shared_ptr
 
 #include "Kodgen/CodeGen/CodeGenUnit.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenEnv.h"
+#include "Kodgen/CodeGen/AmalgamatedFileWriter.h"
 
 namespace kodgen
 {
@@ -34,6 +36,9 @@ namespace kodgen
 
 			/** Map containing the class footer generated code for each struct/class. */
 			std::unordered_map<StructClassInfo const*, std::string>					_classFooterGeneratedCode;
+
+			/** Writer collecting the generated source code when amalgamation is enabled. Shared by all copies of this unit. */
+			std::shared_ptr<AmalgamatedFileWriter>									_amalgamatedFileWriter = std::make_shared<AmalgamatedFileWriter>();
 			
 			//Make the addModule method taking a CodeGenModule private to replace it with a more restrictive method accepting MacroCodeGenModule only.
 			using CodeGenUnit::addModule;
@@ -60,6 +65,7 @@ namespace kodgen
 
 			/**
 			*	@brief	(Re)generate the source file.
+			*			If amalgamation is enabled, the generated code is added to the amalgamation file instead.
 			* 
 			*	@param env Generation environment.
 			*/
@@ -75,7 +81,8 @@ namespace kodgen
 			fs::path	getGeneratedHeaderFilePath(fs::path const& sourceFile)					const	noexcept;
 
 			/**
-			*	@brief Compute the path of the source file generated from the provided source file.
+			*	@brief	Compute the path of the source file generated from the provided source file.
+			*			If amalgamation is enabled, this is the path of the amalgamation file.
 			* 
 			*	@param sourceFile Path to the source file.
 			* 
@@ -162,6 +169,36 @@ namespace kodgen
 			*/
 			virtual bool					isUpToDate(fs::path const& sourceFile)				const	noexcept	override;
 
+			/**
+			*	@brief Get the paths of the generated header and source (or amalgamation) files of the provided source file.
+			* 
+			*	@param sourceFile Path to the source file.
+			* 
+			*	@return The paths of the generated header and source files.
+			*/
+			virtual std::vector<fs::path>	getGeneratedFilePaths(fs::path const& sourceFile)	const	noexcept	override;
+
+			/**
+			*	@brief Combine the fingerprint of the registered code generators with the file name and macro patterns of the settings.
+			* 
+			*	@return The fingerprint of this unit, or 0 if the generated files can't be cached (amalgamation is enabled, or a code generator has no cache fingerprint).
+			*/
+			virtual uint64					getCacheFingerprint()								const	noexcept	override;
+
+			/**
+			*	@brief Discard the amalgamated code collected during a previous run, and remove the code of the removed files from their amalgamation files.
+			* 
+			*	@param removedFiles Files processed by a previous run which are not processed anymore.
+			*/
+			virtual void					preProcessFiles(std::vector<fs::path> const& removedFiles)	noexcept	override;
+
+			/**
+			*	@brief Write all amalgamation files if amalgamation is enabled.
+			* 
+			*	@return true if the amalgamation files have been written successfully, else false.
+			*/
+			virtual bool					postProcessFiles()									noexcept	override;
+
 			/**
 			*	@brief	Add a module to the internal list of generation modules.
 			*			This method is a more restrictive replacement for the CodeGenUnit::addModule(CodeGenModule&) method.
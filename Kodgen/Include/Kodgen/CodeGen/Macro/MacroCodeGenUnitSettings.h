@@ -7,9 +7,11 @@
 
 #pragma once
 
+#include <vector>
 #include <string_view>
 
 #include "Kodgen/CodeGen/CodeGenUnitSettings.h"
+#include "Kodgen/CodeGen/Macro/EAmalgamationMode.h"
 
 namespace kodgen
 {
@@ -37,6 +39,12 @@ namespace kodgen
 			*/
 			static constexpr std::string_view const classFullNameTag	= "##CLASSFULLNAME##";
 
+			/**
+			*	Tag usable in _amalgamationFileNamePattern.
+			*	All instances of this tag will be replaced by the name of the amalgamated directory.
+			*/
+			static constexpr std::string_view const dirNameTag			= "##DIRNAME##";
+
 			/**
 			*	Pattern to use to generate header files.
 			*	##FILENAME## will be replaced by the target file name.
@@ -49,6 +57,25 @@ namespace kodgen
 			*/
 			std::string		_generatedSourceFileNamePattern	= "##FILENAME##.src.h";
 
+			/**
+			*	Pattern to use to generate amalgamation files when _amalgamationMode is not EAmalgamationMode::None.
+			*	##DIRNAME## will be replaced by the parsed file directory name (EAmalgamationMode::PerDirectory), by its module directory name
+			*	(EAmalgamationMode::PerModule) or by the output directory name (EAmalgamationMode::Single).
+			*	Directory names are followed by a hash of the directory path relative to the output directory, so that directories with the same name
+			*	don't share an amalgamation file.
+			*/
+			std::string		_amalgamationFileNamePattern	= "##DIRNAME##.amalgamation.src.h";
+
+			/**
+			*	Defines how generated source files are written.
+			*	When amalgamation is enabled, the generated source code is gathered in amalgamation files instead of one file per parsed file.
+			*	Generated header files are not affected by this setting.
+			*/
+			EAmalgamationMode	_amalgamationMode			= EAmalgamationMode::None;
+
+			/** Directories which parsed files are gathered in a single amalgamation file each when _amalgamationMode is EAmalgamationMode::PerModule. */
+			std::vector<fs::path>	_amalgamationModuleDirectories;
+
 			/**
 			*	Pattern to use to generate class footer macro.
 			*	##CLASSNAME## and ##CLASSFULLNAME## will be replaced by the class name and full name respectively.
@@ -155,6 +182,24 @@ namespace kodgen
 			void			loadInternalSymbolMacroName(toml::value const&	generationSettings,
 														ILogger*			logger)					noexcept;
 
+			/**
+			*	@brief Get the name of the amalgamation file of a directory, made of the directory name and of a hash of its path relative to the output directory.
+			*
+			*	@param directory Full path to the directory.
+			*
+			*	@return The name replacing ##DIRNAME## in _amalgamationFileNamePattern.
+			*/
+			std::string		getAmalgamationDirectoryName(fs::path const& directory)				const	noexcept;
+
+			/**
+			*	@brief Load the _amalgamationMode, _amalgamationFileNamePattern and _amalgamationModuleDirectories fields from toml.
+			*
+			*	@param generationSettings	Toml content.
+			*	@param logger				Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void			loadAmalgamationSettings(toml::value const&	generationSettings,
+													 ILogger*			logger)						noexcept;
+
 		public:
 			/**
 			*	@brief Setter for _generatedHeaderFileNamePattern.
@@ -198,6 +243,34 @@ namespace kodgen
 			*/
 			void				setInternalSymbolMacroName(std::string const& internalSymbolMacroName)					noexcept;
 
+			/**
+			*	@brief Setter for the field _amalgamationMode.
+			* 
+			*	@param amalgamationMode New _amalgamationMode value.
+			*/
+			void				setAmalgamationMode(EAmalgamationMode amalgamationMode)									noexcept;
+
+			/**
+			*	@brief Setter for the field _amalgamationFileNamePattern.
+			* 
+			*	@param amalgamationFileNamePattern Amalgamation file name pattern.
+			*/
+			void				setAmalgamationFileNamePattern(std::string const& amalgamationFileNamePattern)			noexcept;
+
+			/**
+			*	@brief Add a module directory to the list of module directories used by EAmalgamationMode::PerModule.
+			* 
+			*	@param directory Path to the module directory.
+			* 
+			*	@return true if the directory exists and has been added to the list, else false.
+			*/
+			bool				addAmalgamationModuleDirectory(fs::path const& directory)								noexcept;
+
+			/**
+			*	@brief Clear the list of module directories used by EAmalgamationMode::PerModule.
+			*/
+			void				clearAmalgamationModuleDirectories()													noexcept;
+
 			/**
 			*	@brief Getter for _generatedHeaderFileNamePattern.
 			*
@@ -279,5 +352,36 @@ namespace kodgen
 			*	@return _internalSymbolMacroName.
 			*/
 			std::string const&	getInternalSymbolMacroName()	const	noexcept;
+
+			/**
+			*	@brief Getter for the field _amalgamationMode.
+			* 
+			*	@return _amalgamationMode.
+			*/
+			EAmalgamationMode	getAmalgamationMode()			const	noexcept;
+
+			/**
+			*	@brief Getter for the field _amalgamationFileNamePattern.
+			* 
+			*	@return _amalgamationFileNamePattern.
+			*/
+			std::string const&	getAmalgamationFileNamePattern()	const	noexcept;
+
+			/**
+			*	@brief Getter for the field _amalgamationModuleDirectories.
+			* 
+			*	@return _amalgamationModuleDirectories.
+			*/
+			std::vector<fs::path> const&	getAmalgamationModuleDirectories()	const	noexcept;
+
+			/**
+			*	@brief	Get the amalgamation file name the code generated for the given file is written to.
+			*			This actually returns the amalgamation file name pattern by replacing all ##DIRNAME## instances.
+			* 
+			*	@param targetFile Full path to the target file.
+			* 
+			*	@return The amalgamation file name (not full path, only file name + extension), or an empty path if amalgamation is disabled.
+			*/
+			fs::path			getAmalgamationFileName(fs::path const& targetFile)		const	noexcept;
 	};
 }
\ No newline at end of file
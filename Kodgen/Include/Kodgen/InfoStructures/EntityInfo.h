@@ -57,6 +57,13 @@ namespace kodgen
 			*	@return The full name of the entity.
 			*/
 			std::string getFullName()						const	noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this entity (name, id and properties).
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64		getAllocatedMemory()				const	noexcept;
 	};
 
 	std::ostream& operator<<(std::ostream& out_stream, EntityInfo const&) noexcept;
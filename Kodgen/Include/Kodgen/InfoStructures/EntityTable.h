@@ -0,0 +1,123 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <type_traits>	//std::enable_if_t, std::is_invocable_v, std::underlying_type_t
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/InfoStructures/EEntityType.h"
+#include "Kodgen/InfoStructures/EntityInfo.h"
+
+namespace kodgen
+{
+	/**
+	*	Flat table of the entities of a parsing result, in pre-order: an entity is followed by all the entities it contains.
+	*	Entity types, depths and parent indices are stored in arrays parallel to the entities,
+	*	so that filtering entities by type is a linear scan over the types array instead of a recursive walk.
+	*	The table references the entities, which must outlive it.
+	*/
+	class EntityTable
+	{
+		public:
+			/** Parent index of the entities declared at file level. */
+			static constexpr uint32	invalidIndex	= 0xFFFFFFFFu;
+
+		private:
+			/** Entities of the table, in pre-order. */
+			std::vector<EntityInfo const*>	_entities;
+
+			/** Type of each entity. */
+			std::vector<EEntityType>		_entityTypes;
+
+			/** Number of entities containing each entity. */
+			std::vector<uint32>				_depths;
+
+			/** Index of the entity containing each entity, invalidIndex for entities declared at file level. */
+			std::vector<uint32>				_parentIndices;
+
+		public:
+			/**
+			*	@brief	Append an entity to the table.
+			*			Entities must be added in pre-order, after the entity containing them.
+			*
+			*	@param entity		Entity to add.
+			*	@param parentIndex	Index of the entity containing the added entity, invalidIndex if declared at file level.
+			*
+			*	@return The index of the added entity.
+			*/
+			uint32					addEntity(EntityInfo const&	entity,
+											  uint32			parentIndex)					noexcept;
+
+			/**
+			*	@brief Remove all entities from the table.
+			*/
+			void					clear()														noexcept;
+
+			/**
+			*	@brief Call a visitor function on each entity of the provided type(s), in pre-order.
+			*
+			*	@param entityMask	All types of entities the visitor function should be called on.
+			*	@param visitor		Function to call on entities.
+			*/
+			template <typename Functor, typename = std::enable_if_t<std::is_invocable_v<Functor, EntityInfo const&>>>
+			void					foreachEntityOfType(EEntityType	entityMask,
+														Functor		visitor)			const	noexcept;
+
+			/**
+			*	@brief Get the number of entities in the table.
+			*
+			*	@return The number of entities.
+			*/
+			inline uint32			size()												const	noexcept;
+
+			/**
+			*	@brief Check whether the table contains any entity.
+			*
+			*	@return true if the table is empty, else false.
+			*/
+			inline bool				empty()												const	noexcept;
+
+			/**
+			*	@param index Index of the entity, must be lower than size().
+			*
+			*	@return The entity at the provided index.
+			*/
+			inline EntityInfo const&	getEntity(uint32 index)							const	noexcept;
+
+			/**
+			*	@param index Index of the entity, must be lower than size().
+			*
+			*	@return The depth of the entity at the provided index, 0 for entities declared at file level.
+			*/
+			inline uint32			getDepth(uint32 index)								const	noexcept;
+
+			/**
+			*	@param index Index of the entity, must be lower than size().
+			*
+			*	@return The index of the entity containing the entity at the provided index, invalidIndex if declared at file level.
+			*/
+			inline uint32			getParentIndex(uint32 index)						const	noexcept;
+
+			/**
+			*	@brief Getter for _entityTypes field.
+			*
+			*	@return _entityTypes.
+			*/
+			inline std::vector<EEntityType> const&	getEntityTypes()					const	noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this table.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64					getAllocatedMemory()								const	noexcept;
+	};
+
+	#include "Kodgen/InfoStructures/EntityTable.inl"
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Functor, typename>
+void EntityTable::foreachEntityOfType(EEntityType entityMask, Functor visitor) const noexcept
+{
+	using UnderlyingType = std::underlying_type_t<EEntityType>;
+
+	UnderlyingType		mask		= static_cast<UnderlyingType>(entityMask);
+	EEntityType const*	entityTypes	= _entityTypes.data();
+	size_t				entityCount	= _entityTypes.size();
+
+	for (size_t i = 0u; i < entityCount; i++)
+	{
+		if ((static_cast<UnderlyingType>(entityTypes[i]) & mask) != 0u)
+		{
+			visitor(*_entities[i]);
+		}
+	}
+}
+
+inline uint32 EntityTable::size() const noexcept
+{
+	return static_cast<uint32>(_entities.size());
+}
+
+inline bool EntityTable::empty() const noexcept
+{
+	return _entities.empty();
+}
+
+inline EntityInfo const& EntityTable::getEntity(uint32 index) const noexcept
+{
+	return *_entities[index];
+}
+
+inline uint32 EntityTable::getDepth(uint32 index) const noexcept
+{
+	return _depths[index];
+}
+
+inline uint32 EntityTable::getParentIndex(uint32 index) const noexcept
+{
+	return _parentIndices[index];
+}
+
+inline std::vector<EEntityType> const& EntityTable::getEntityTypes() const noexcept
+{
+	return _entityTypes;
+}
\ No newline at end of file
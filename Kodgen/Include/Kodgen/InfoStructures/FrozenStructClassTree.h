@@ -0,0 +1,135 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include "Kodgen/InfoStructures/StructClassTree.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Read-only form of a StructClassTree answering isBaseOf queries in constant time.
+	*
+	*	Each struct/class is given an integer id. Structs/classes which have a single chain of bases
+	*	form a forest labelled with the intervals of an Euler tour: a base contains the interval of all its children.
+	*	The other structs/classes (multiple inheritance somewhere in their bases) store a row of the transitive closure
+	*	of the inheritance graph: one bit per struct/class telling whether it is a base, and 2 bits for the inheritance access.
+	*/
+	class FrozenStructClassTree
+	{
+		public:
+			/** Id of the structs/classes which are not in the tree. */
+			static constexpr uint32	invalidId	= 0xFFFFFFFFu;
+
+		private:
+			struct Node
+			{
+				/** Position of the node in the Euler tour of the single inheritance forest, invalidId if the node is not in the forest. */
+				uint32	enter				= invalidId;
+				uint32	exit				= invalidId;
+
+				/** Number of bases of the node in the forest. */
+				uint32	depth				= 0u;
+
+				/** Offset in _ancestorAccesses of the inheritance accesses of the node, one per base in the forest. */
+				uint32	ancestorAccesses	= 0u;
+
+				/** Row of the node in the transitive closure, invalidId if the node is in the forest. */
+				uint32	closureRow			= invalidId;
+			};
+
+			/** Collection mapping a struct/class name to its id. */
+			std::unordered_map<std::string, uint32>	_ids;
+
+			/** All nodes, indexed by id. */
+			std::vector<Node>						_nodes;
+
+			/**
+			*	Inheritance accesses of the forest nodes. The accesses of a node are indexed by the depth of the base,
+			*	and contain the access of the link inheriting directly from that base.
+			*/
+			std::vector<EAccessSpecifier>			_ancestorAccesses;
+
+			/** Number of 64-bit words of a closure row. */
+			uint32									_closureRowSize			= 0u;
+
+			/** Bit set of the bases of the nodes which are not in the forest, one row per node. */
+			std::vector<uint64>						_closure;
+
+			/** Inheritance accesses of the bases of the nodes which are not in the forest, 2 bits per base. */
+			std::vector<uint64>						_closureAccesses;
+
+			/**
+			*	@brief Build the indexed form of an inheritance graph.
+			*
+			*	@param entries Collection mapping a struct/class name to its inherited structs/classes.
+			*/
+			void	build(std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> const& entries)	noexcept;
+
+		public:
+			FrozenStructClassTree()											= default;
+			FrozenStructClassTree(StructClassTree const& structClassTree)	noexcept;
+			FrozenStructClassTree(std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> const& entries)	noexcept;
+
+			/**
+			*	@brief Get the id of a struct/class, to be used with isBaseOf.
+			*
+			*	@param structClassName Canonical name of the struct/class.
+			*
+			*	@return The id of the struct/class, or invalidId if it is not in the tree.
+			*/
+			uint32	getId(std::string const& structClassName)								const	noexcept;
+
+			/**
+			*	@brief Check whether baseStructClass is a base of childStructClass (parent class or the class itself) in constant time.
+			*
+			*	@param baseStructClassId	Id of the base class.
+			*	@param childStructClassId	Id of the child class.
+			*	@param inheritanceAccess	Optional inheritance access filled if true is returned. In the case baseStruct is childStruct, EAccessSpecifier::Invalid is used.
+			*
+			*	@return true if baseClass is a parent of childClass, or if baseClass is childClass, else false.
+			*			If an id is invalidId, return false.
+			*/
+			bool	isBaseOf(uint32				baseStructClassId,
+							 uint32				childStructClassId,
+							 EAccessSpecifier*	out_inheritanceAccess = nullptr)					const	noexcept;
+
+			/**
+			*	@brief	Check whether baseStructClass is a base of childStructClass (parent class or the class itself).
+			*			Same as StructClassTree::isBaseOf, but only hashes the 2 names.
+			*
+			*	@param baseStructClassName	Canonical name of the base class.
+			*	@param childStructClassName	Canonical name of the child class.
+			*	@param inheritanceAccess	Optional inheritance access filled if true is returned. In the case baseStruct is childStruct, EAccessSpecifier::Invalid is used.
+			*
+			*	@return true if baseClass is a parent of childClass, or if baseClass is childClass, else false.
+			*			If names are not in the tree, return false.
+			*/
+			bool	isBaseOf(std::string const&	baseStructClassName,
+							 std::string const&	childStructClassName,
+							 EAccessSpecifier*	out_inheritanceAccess = nullptr)					const	noexcept;
+
+			/**
+			*	@brief Get the number of structs/classes in the tree.
+			*
+			*	@return The number of structs/classes.
+			*/
+			uint32	getNodeCount()																const	noexcept;
+
+			/**
+			*	@brief Get an approximation of the number of bytes allocated on the heap by this tree.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64	getAllocatedMemory()														const	noexcept;
+	};
+}
\ No newline at end of file
@@ -51,6 +51,7 @@ namespace kodgen
 			/** Is this function static or not. */
 			bool isStatic	: 1;
 
+			FunctionInfo()									= default;
 			FunctionInfo(CXCursor const&			cursor,
 						 std::vector<Property>&&	properties)	noexcept;
 
@@ -72,5 +73,12 @@ namespace kodgen
 			*	@return The parameter types of the function.
 			*/
 			std::string getParameterTypes()								const noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this function.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64		getAllocatedMemory()							const noexcept;
 	};
 }
\ No newline at end of file
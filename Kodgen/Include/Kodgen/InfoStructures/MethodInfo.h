@@ -40,6 +40,7 @@ namespace kodgen
 			/** Is this method const or not. */
 			bool							isConst			: 1;
 
+			MethodInfo()									= default;
 			MethodInfo(CXCursor const&			cursor,
 					   std::vector<Property>&&	properties)	noexcept;
 	};
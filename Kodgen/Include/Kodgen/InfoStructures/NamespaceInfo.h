@@ -42,6 +42,7 @@ namespace kodgen
 			/** Nested variables. */
 			std::vector<VariableInfo>		variables;
 
+			NamespaceInfo()										= default;
 			NamespaceInfo(CXCursor const&			cursor,
 						  std::vector<Property>&&	properties)	noexcept;
 
@@ -58,6 +59,13 @@ namespace kodgen
 			*	@brief Refresh the outerEntity field of all nested entities. Internal use only.
 			*/
 			void	refreshOuterEntity()													noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this namespace and all its nested entities.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64	getAllocatedMemory()											const	noexcept;
 	};
 
 	#include "Kodgen/InfoStructures/NamespaceInfo.inl"
@@ -0,0 +1,163 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <shared_mutex>
+#include <functional>	//std::function
+
+#include "Kodgen/InfoStructures/StructClassTree.h"
+#include "Kodgen/InfoStructures/FrozenStructClassTree.h"
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Inheritance links of all the structs/classes found during a generation run, whatever the file they were parsed from.
+	*	Links are added concurrently by the parsing tasks: entries are split into shards, each protected by its own lock,
+	*	so that concurrent insertions only contend when they hit the same shard.
+	*	Each struct/class entry belongs to the last file which reported its inheritance links,
+	*	so that the entries of a file can be discarded before it is parsed again in an incremental run.
+	*/
+	class ProjectStructClassTree
+	{
+		private:
+			struct Entry
+			{
+				/** File whose parsing reported the inheritance links. */
+				fs::path										sourceFile;
+
+				/** Inherited structs/classes. */
+				std::vector<StructClassTree::InheritanceLink>	inheritanceLinks;
+			};
+
+			struct Shard
+			{
+				/** Mutex used to synchronize the shard entries access. */
+				mutable std::shared_mutex						mutex;
+
+				/** Collection mapping a struct/class name to its inherited structs/classes. */
+				std::unordered_map<std::string, Entry>			entries;
+			};
+
+			/** Number of shards. Must be a power of 2. */
+			static constexpr size_t					_shardCount	= 64u;
+
+			/** Version written at the top of the saved file. Files with a different version are discarded. */
+			static constexpr char const*			_header		= "KODGEN_STRUCT_CLASS_TREE 1";
+
+			/** All shards of the tree. */
+			std::array<Shard, _shardCount>			_shards;
+
+			/** Snapshot of the tree taken by the last freeze call. */
+			FrozenStructClassTree					_frozenTree;
+
+			/**
+			*	@brief Get the shard containing the entry of a struct/class.
+			*
+			*	@param structClassName Name of the struct/class.
+			*
+			*	@return The shard containing the entry.
+			*/
+			Shard&					getShard(std::string const& structClassName)						noexcept;
+			Shard const&			getShard(std::string const& structClassName)				const	noexcept;
+
+		public:
+			/**
+			*	@brief	Add the inheritance links found while parsing a file. The links already recorded for the same structs/classes are replaced.
+			*			This method is thread-safe.
+			*
+			*	@param sourceFile		Parsed file.
+			*	@param structClassTree	Inheritance links found while parsing the file.
+			*/
+			void	addInheritanceLinks(fs::path const&			sourceFile,
+										StructClassTree const&	structClassTree)							noexcept;
+
+			/**
+			*	@brief	Check whether baseStructClass is a base of childStructClass (parent class or the class itself).
+			*			Canonical names must be used, as with StructClassTree::isBaseOf.
+			*			This method is thread-safe.
+			*
+			*	@param baseStructClassName	Canonical name of the base class.
+			*	@param childStructClassName	Canonical name of the child class.
+			*	@param inheritanceAccess	Optional inheritance access filled if true is returned. In the case baseStruct is childStruct, EAccessSpecifier::Invalid is used.
+			*
+			*	@return true if baseClass is a direct or indirect parent of childClass, or if baseClass is childClass, else false.
+			*/
+			bool	isBaseOf(std::string const&	baseStructClassName,
+							 std::string const&	childStructClassName,
+							 EAccessSpecifier*	out_inheritanceAccess = nullptr)				const	noexcept;
+
+			/**
+			*	@brief	Get the structs/classes directly inherited by a struct/class.
+			*			This method is thread-safe.
+			*
+			*	@param structClassName Canonical name of the struct/class.
+			*
+			*	@return The inheritance links of the struct/class.
+			*/
+			std::vector<StructClassTree::InheritanceLink>	getInheritanceLinks(std::string const& structClassName)	const	noexcept;
+
+			/**
+			*	@brief	Take a snapshot of the tree in a form answering isBaseOf queries in constant time.
+			*			This method must not be called while links are being added.
+			*/
+			void	freeze()																			noexcept;
+
+			/**
+			*	@brief	Getter for _frozenTree field.
+			*			Links added after the last freeze call are not in the returned tree.
+			*
+			*	@return _frozenTree.
+			*/
+			FrozenStructClassTree const&	getFrozenTree()										const	noexcept;
+
+			/**
+			*	@brief	Remove the entries which belong to the files rejected by the predicate.
+			*			This method must not be called while links are being added.
+			*
+			*	@param shouldKeep Predicate returning true if the entries of a file must be kept.
+			*/
+			void	prune(std::function<bool(fs::path const&)> const& shouldKeep)							noexcept;
+
+			/**
+			*	@brief Remove all entries. This method must not be called while links are being added.
+			*/
+			void	clear()																				noexcept;
+
+			/**
+			*	@brief Get the number of structs/classes having at least one inheritance link.
+			*
+			*	@return The number of entries of the tree.
+			*/
+			size_t	getEntryCount()																const	noexcept;
+
+			/**
+			*	@brief Load a tree saved by a previous run. The current entries are replaced.
+			*
+			*	@param treeFile Path to the saved tree.
+			*
+			*	@return true if the tree was loaded, else false (in which case the tree is empty).
+			*/
+			bool	load(fs::path const& treeFile)															noexcept;
+
+			/**
+			*	@brief	Save the tree to a file so that the next run can load it.
+			*			This method must not be called while links are being added.
+			*
+			*	@param treeFile Path to the file to write.
+			*
+			*	@return true if the tree was saved successfully, else false.
+			*/
+			bool	save(fs::path const& treeFile)													const	noexcept;
+	};
+}
\ No newline at end of file
@@ -112,6 +112,13 @@ namespace kodgen
 			*	@brief Refresh the outerEntity field of all nested entities. Internal use only.
 			*/
 			void		refreshOuterEntity()													noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this struct/class and all its nested entities.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64		getAllocatedMemory()											const	noexcept;
 	};
 
 	#include "Kodgen/InfoStructures/StructClassInfo.inl"
@@ -42,9 +42,9 @@ void StructClassInfo::foreachEntityOfType(EEntityType entityMask, Functor visito
 
 	if (entityMask && EEntityType::Field)
 	{
-		for (MethodInfo const& method : methods)
+		for (FieldInfo const& field : fields)
 		{
-			visitor(method);
+			visitor(field);
 		}
 	}
 
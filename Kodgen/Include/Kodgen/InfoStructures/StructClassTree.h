@@ -5,6 +5,8 @@
 *	See the LICENSE.md file for full license details.
 */
 
+#pragma once
+
 #include <functional>	//std::hash
 #include <string>
 #include <unordered_map>
@@ -68,5 +70,12 @@ namespace kodgen
 			*	@return entries.
 			*/
 			std::unordered_map<std::string, std::vector<InheritanceLink>> const&	getEntries()	const	noexcept;
+
+			/**
+			*	@brief Get an approximation of the number of bytes allocated on the heap by this tree.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64																	getAllocatedMemory()	const	noexcept;
 	};
 }
\ No newline at end of file
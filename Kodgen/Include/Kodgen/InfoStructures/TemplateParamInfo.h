@@ -42,6 +42,14 @@ namespace kodgen
 			*/
 			std::string					name;
 
+			TemplateParamInfo()					= default;
 			TemplateParamInfo(CXCursor cursor)	noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this template parameter.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64	getAllocatedMemory()		const	noexcept;
 	};
 }
\ No newline at end of file
@@ -20,6 +20,9 @@ namespace kodgen
 {
 	class TypeInfo
 	{
+		//Restores private members when a type is decoded
+		friend class FileParsingResultSerializer;
+
 		private:
 			/** Internal keywords used for type splitting. */
 			static constexpr char const*	_classQualifier		= "class ";
@@ -194,6 +197,13 @@ namespace kodgen
 			*/
 			bool									isTemplateType()															const	noexcept;
 
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this type.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64									getAllocatedMemory()														const	noexcept;
+
 
 			TypeInfo& operator=(TypeInfo const&)	= delete;
 			TypeInfo& operator=(TypeInfo&&)			= default;
@@ -28,7 +28,15 @@ namespace kodgen
 			/** Type of this variable. */
 			TypeInfo			type;
 
+			VariableInfo()									= default;
 			VariableInfo(CXCursor const&			cursor,
 						 std::vector<Property>&&	properties)	noexcept;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by this variable.
+			*
+			*	@return The number of allocated bytes, sizeof(*this) excluded.
+			*/
+			uint64	getAllocatedMemory()						const	noexcept;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+
+#include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Logger forwarding messages to another logger from a background thread.
+	*	Messages are pushed in a lock-free ring buffer, so logging threads never wait for the output stream.
+	*	When the ring buffer is full, messages are dropped and the number of dropped messages is reported.
+	*	The flusher thread only runs in the process which created the logger: messages logged from parsing worker processes are lost,
+	*	so parsers used by a ParsingWorkerPool should keep a synchronous logger.
+	*/
+	class AsyncLogger : public ILogger
+	{
+		private:
+			/**
+			*	Longest time the flusher thread sleeps before checking for new messages.
+			*	Logging threads wake it up without locking, so a wake up can be missed.
+			*/
+			static constexpr uint32		_maxSleepDuration	= 5u;	//In milliseconds
+
+			struct Slot
+			{
+				/** Position the slot is ready for: the slot can be written for position p when sequence == p, and read when sequence == p + 1. */
+				std::atomic<uint64>	sequence;
+
+				/** Logged message. Its buffer is reused by the next messages written in this slot. */
+				std::string			message;
+
+				/** Severity of the logged message. */
+				ELogSeverity		severity;
+			};
+
+			/** Logger the messages are forwarded to. Only used by the flusher thread. */
+			ILogger&					_sink;
+
+			/** Ring buffer of logged messages. Its size is a power of 2. */
+			std::vector<Slot>			_slots;
+
+			/** Mask applied to a position to get its slot index. */
+			uint64						_positionMask;
+
+			/** Position of the next logged message. */
+			std::atomic<uint64>			_enqueuePosition	= 0u;
+
+			/** Position of the next message forwarded to the sink. Only used by the flusher thread. */
+			uint64						_dequeuePosition	= 0u;
+
+			/** Position up to which messages have been forwarded to the sink and flushed. Protected by _mutex. */
+			uint64						_flushedPosition	= 0u;
+
+			/** Number of messages dropped since the ring buffer was full. */
+			std::atomic<uint64>			_droppedCount		= 0u;
+
+			/** Set while the flusher thread waits for new messages. */
+			std::atomic_bool			_flusherSleeping	= false;
+
+			/** Set when the flusher thread must exit once all messages are forwarded. */
+			bool						_stopRequested		= false;
+
+			/** Mutex and conditions used to wake up the flusher thread and the threads waiting for a flush. */
+			std::mutex					_mutex;
+			std::condition_variable		_messageCondition;
+			std::condition_variable		_flushedCondition;
+
+			/** Thread forwarding the messages to the sink. */
+			std::thread					_flusher;
+
+			/**
+			*	@brief Routine of the flusher thread.
+			*/
+			void	flusherRoutine()		noexcept;
+
+			/**
+			*	@brief Forward all published messages to the sink.
+			*
+			*	@return true if at least one message was forwarded, else false.
+			*/
+			bool	forwardMessages()		noexcept;
+
+		public:
+			/**
+			*	@param sink		Logger the messages are forwarded to. It must outlive this logger.
+			*	@param capacity	Number of messages the ring buffer can hold. It is rounded up to a power of 2.
+			*/
+			AsyncLogger(ILogger&	sink,
+						uint32		capacity = 4096u)	noexcept;
+			AsyncLogger(AsyncLogger const&)				= delete;
+			AsyncLogger(AsyncLogger&&)					= delete;
+
+			/**
+			*	@brief Forward the remaining messages and stop the flusher thread.
+			*/
+			virtual ~AsyncLogger()						noexcept;
+
+			/**
+			*	@brief	Push a message in the ring buffer without blocking. Can be called from any thread.
+			*			The message is dropped if the ring buffer is full.
+			*
+			*	@param message		Message to log.
+			*	@param logSeverity	Severity level of the message.
+			*/
+			virtual void log(std::string const&	message,
+							 ELogSeverity		logSeverity = ELogSeverity::Info)	noexcept override;
+
+			/**
+			*	@brief Block until all messages logged before this call are forwarded to the sink, then flush the sink.
+			*/
+			virtual void flush()													noexcept override;
+
+			AsyncLogger& operator=(AsyncLogger const&)	= delete;
+			AsyncLogger& operator=(AsyncLogger&&)		= delete;
+	};
+}
\ No newline at end of file
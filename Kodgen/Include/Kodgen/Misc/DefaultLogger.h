@@ -38,5 +38,6 @@ namespace kodgen
 		public:
 			virtual void log(std::string const&	message,
 							 ELogSeverity		logSeverity = ELogSeverity::Info)	noexcept override;
+			virtual void flush()													noexcept override;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,44 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Compact status of a regular file, retrieved with a single system call when possible.
+	*/
+	struct FileStatus
+	{
+		public:
+			/** Size of the file in bytes. */
+			uint64	size			= 0u;
+
+			/** Last write time of the file, in platform specific ticks. */
+			int64	lastWriteTime	= 0;
+
+			/** Inode (file serial number) of the file. Always 0 on platforms which don't provide it. */
+			uint64	inode			= 0u;
+
+			/**
+			*	@brief Retrieve the status of a regular file.
+			* 
+			*	@param path			Path to the file.
+			*	@param out_status	Status to fill on success.
+			* 
+			*	@return true if the file exists and is a regular file, else false.
+			*/
+			static bool	query(fs::path const&	path,
+							  FileStatus&		out_status)		noexcept;
+
+			bool operator==(FileStatus const& other)	const	noexcept;
+			bool operator!=(FileStatus const& other)	const	noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	64-bit FNV-1a hashing helpers.
+	*	Unlike std::hash, the hashes are the same across implementations and runs, so they can be persisted or shared between machines.
+	*/
+	class HashHelpers
+	{
+		public:
+			/** Initial value of a hash. */
+			static constexpr uint64	initialHash	= 14695981039346656037u;
+
+			HashHelpers()	= delete;
+			~HashHelpers()	= delete;
+
+			/**
+			*	@brief Add bytes to a hash.
+			*
+			*	@param hash Hash to update.
+			*	@param data	Bytes to add.
+			*	@param size	Number of bytes to add.
+			*
+			*	@return The updated hash.
+			*/
+			static uint64	hashBytes(uint64		hash,
+									  void const*	data,
+									  size_t		size)				noexcept;
+
+			/**
+			*	@brief Add a string, prefixed by its size, to a hash.
+			*
+			*	@param hash		Hash to update.
+			*	@param value	String to add.
+			*
+			*	@return The updated hash.
+			*/
+			static uint64	hashString(uint64				hash,
+									   std::string const&	value)		noexcept;
+
+			/**
+			*	@brief Add a value to a hash.
+			*
+			*	@param hash		Hash to update.
+			*	@param value	Value to add.
+			*
+			*	@return The updated hash.
+			*/
+			static uint64	hashValue(uint64	hash,
+									  uint64	value)					noexcept;
+	};
+}
\ No newline at end of file
@@ -28,6 +28,11 @@ namespace kodgen
 				Error
 			};
 
+		private:
+			/** Messages with a lower severity are discarded. */
+			ELogSeverity	_minSeverity	= ELogSeverity::Info;
+
+		public:
 			ILogger()					= default;
 			ILogger(ILogger const&)		= default;
 			ILogger(ILogger&&)			= default;
@@ -42,7 +47,33 @@ namespace kodgen
 			virtual void log(std::string const&	message,
 							 ELogSeverity		logSeverity = ELogSeverity::Info) noexcept = 0;
 
+			/**
+			*	@brief	Write the messages logged so far to their destination.
+			*			Loggers buffering messages must override it, it does nothing by default.
+			*/
+			virtual void flush()											noexcept;
+
+			/**
+			*	@brief	Check whether messages of a given severity are logged.
+			*			Callers should check it before formatting expensive messages.
+			*	
+			*	@param logSeverity Severity level to check.
+			*	
+			*	@return true if messages of this severity are logged, else false.
+			*/
+			inline bool	isLogged(ELogSeverity logSeverity)			const	noexcept;
+
+			/**
+			*	@brief	Setter for _minSeverity field. Messages with a lower severity are discarded by the callers checking isLogged.
+			*			Must not be called while other threads are logging.
+			*	
+			*	@param minSeverity The lowest logged severity.
+			*/
+			inline void	setMinSeverity(ELogSeverity minSeverity)			noexcept;
+
 			ILogger& operator=(ILogger const&)	= default;
 			ILogger& operator=(ILogger&&)		= default;
 	};
+
+	#include "Kodgen/Misc/ILogger.inl"
 }
\ No newline at end of file
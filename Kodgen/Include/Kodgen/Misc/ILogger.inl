@@ -0,0 +1,20 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+inline void ILogger::flush() noexcept
+{
+}
+
+inline bool ILogger::isLogged(ELogSeverity logSeverity) const noexcept
+{
+	return logSeverity >= _minSeverity;
+}
+
+inline void ILogger::setMinSeverity(ELogSeverity minSeverity) noexcept
+{
+	_minSeverity = minSeverity;
+}
\ No newline at end of file
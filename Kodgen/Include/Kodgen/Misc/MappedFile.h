@@ -0,0 +1,66 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	/**
+	*	Read-only memory mapping of a whole file.
+	*	The mapped data is page-aligned, so it satisfies the alignment requirements of in-place binary formats.
+	*/
+	class MappedFile
+	{
+		private:
+			/** Mapped data, nullptr if no file is mapped. */
+			uint8 const*	_data	= nullptr;
+
+			/** Size of the mapped data in bytes. */
+			size_t			_size	= 0u;
+
+#if _WIN32
+			/** Handle of the file mapping object. */
+			void*			_mappingHandle	= nullptr;
+#endif
+
+		public:
+			MappedFile()					= default;
+			MappedFile(MappedFile const&)	= delete;
+			MappedFile(MappedFile&& other)	noexcept;
+			~MappedFile()					noexcept;
+
+			MappedFile& operator=(MappedFile const&)	= delete;
+			MappedFile& operator=(MappedFile&& other)	noexcept;
+
+			/**
+			*	@brief Map a file in memory. The previously mapped file, if any, is unmapped.
+			*
+			*	@param file Path of the file to map.
+			*
+			*	@return true if the file was mapped successfully, else false. Empty files can't be mapped.
+			*/
+			bool			open(fs::path const& file)	noexcept;
+
+			/**
+			*	@brief Unmap the mapped file, if any.
+			*/
+			void			close()						noexcept;
+
+			/**
+			*	@return The mapped data, nullptr if no file is mapped.
+			*/
+			uint8 const*	getData()			const	noexcept;
+
+			/**
+			*	@return The size of the mapped data in bytes.
+			*/
+			size_t			getSize()			const	noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <clang-c/Index.h>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	class MemoryHelpers
+	{
+		public:
+			MemoryHelpers()		= delete;
+			~MemoryHelpers()	= delete;
+
+			/**
+			*	@brief Get the number of bytes allocated on the heap by a string.
+			*
+			*	@param string The string.
+			*
+			*	@return The number of allocated bytes, 0 if the string fits in the small string buffer.
+			*/
+			template <typename CharType>
+			static inline uint64	getAllocatedMemory(std::basic_string<CharType> const& string)	noexcept;
+
+			/**
+			*	@brief	Get the number of bytes allocated on the heap by a vector buffer.
+			*			Memory allocated by the elements themselves is not included.
+			*
+			*	@param vector The vector.
+			*
+			*	@return The number of allocated bytes.
+			*/
+			template <typename T>
+			static inline uint64	getAllocatedMemory(std::vector<T> const& vector)				noexcept;
+
+			/**
+			*	@brief Get the memory used by a translation unit, as reported by libclang.
+			*
+			*	@param translationUnit The translation unit.
+			*
+			*	@return The number of bytes used by the translation unit.
+			*/
+			static uint64			getTranslationUnitMemory(CXTranslationUnit translationUnit)	noexcept;
+
+			/**
+			*	@brief Get the highest resident set size reached by the current process.
+			*
+			*	@return The peak resident set size in bytes, or 0 if it could not be retrieved.
+			*/
+			static uint64			getPeakResidentSetSize()										noexcept;
+	};
+
+	#include "Kodgen/Misc/MemoryHelpers.inl"
+}
\ No newline at end of file
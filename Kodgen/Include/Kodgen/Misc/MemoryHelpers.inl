@@ -0,0 +1,22 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename CharType>
+inline uint64 MemoryHelpers::getAllocatedMemory(std::basic_string<CharType> const& string) noexcept
+{
+	char const* data	= reinterpret_cast<char const*>(string.data());
+	char const* object	= reinterpret_cast<char const*>(&string);
+
+	//Short strings are stored inside the string object itself
+	return (data >= object && data < object + sizeof(string)) ? 0u : (string.capacity() + 1u) * sizeof(CharType);
+}
+
+template <typename T>
+inline uint64 MemoryHelpers::getAllocatedMemory(std::vector<T> const& vector) noexcept
+{
+	return vector.capacity() * sizeof(T);
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/TimingReport.h"
+
+namespace kodgen
+{
+	/**
+	*	Record a span in a timing report from its construction until its destruction.
+	*	Nothing is measured if the provided report is nullptr.
+	*/
+	class ScopedTimingSpan
+	{
+		private:
+			/** Report the span is added to. Can be nullptr. */
+			TimingReport*					_report;
+
+			/** Category of the span. */
+			char const*						_category;
+
+			/** Name of the span. */
+			char const*						_name;
+
+			/** Additional information about the span. */
+			std::string						_detail;
+
+			/** Time at which the span started. */
+			TimingReport::Clock::time_point	_start;
+
+		public:
+			ScopedTimingSpan(TimingReport*	report,
+							 char const*	category,
+							 char const*	name,
+							 std::string	detail = std::string())	noexcept;
+			ScopedTimingSpan(ScopedTimingSpan const&)				= delete;
+			ScopedTimingSpan(ScopedTimingSpan&&)					= delete;
+			~ScopedTimingSpan()										noexcept;
+
+			ScopedTimingSpan& operator=(ScopedTimingSpan const&)	= delete;
+			ScopedTimingSpan& operator=(ScopedTimingSpan&&)			= delete;
+	};
+}
\ No newline at end of file
@@ -9,6 +9,9 @@
 
 #include <string>
 
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/Filesystem.h"
+
 namespace kodgen
 {
 	class System
@@ -25,5 +28,43 @@ namespace kodgen
 			*	@return The result of the given command.
 			*/
 			static std::string executeCommand(std::string const& cmd);
+
+			/**
+			*	@brief	Get the number of CPUs the process is allowed to use by the CPU quota of its cgroup (cgroup v2 cpu.max),
+			*			rounded up. The most restrictive quota of the cgroup and of its parents is used.
+			*	
+			*	@return The number of CPUs of the quota, or 0 if there is no quota or it could not be read.
+			*/
+			static uint32 getCpuQuota()								noexcept;
+
+			/**
+			*	@brief Get the CPU quota of the cgroup described by a cgroup membership file, see getCpuQuota().
+			*	
+			*	@param cgroupFile	File listing the cgroups of the process, in the /proc/self/cgroup format.
+			*	@param cgroupRoot	Directory where the cgroup v2 hierarchy is mounted.
+			*	
+			*	@return The number of CPUs of the quota, or 0 if there is no quota or it could not be read.
+			*/
+			static uint32 getCpuQuota(fs::path const&	cgroupFile,
+									  fs::path const&	cgroupRoot)		noexcept;
+
+			/**
+			*	@brief	Get the memory the process can still allocate before reaching the memory limit of its cgroup
+			*			(cgroup v2 memory.max minus memory.current). The most restrictive limit of the cgroup and of its parents is used.
+			*	
+			*	@return The available memory in bytes, or 0 if there is no limit or it could not be read.
+			*/
+			static uint64 getAvailableMemory()						noexcept;
+
+			/**
+			*	@brief Get the memory left by the memory limit of the cgroup described by a cgroup membership file, see getAvailableMemory().
+			*	
+			*	@param cgroupFile	File listing the cgroups of the process, in the /proc/self/cgroup format.
+			*	@param cgroupRoot	Directory where the cgroup v2 hierarchy is mounted.
+			*	
+			*	@return The available memory in bytes, or 0 if there is no limit or it could not be read.
+			*/
+			static uint64 getAvailableMemory(fs::path const&	cgroupFile,
+											 fs::path const&	cgroupRoot)	noexcept;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,83 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <chrono>
+
+#include "Kodgen/Misc/TimingSpan.h"
+#include "Kodgen/Misc/Filesystem.h"
+
+namespace kodgen
+{
+	/**
+	*	Collection of timing spans recorded during a code generation process.
+	*	A report is not thread-safe: each task fills its own report and reports are merged together afterwards.
+	*/
+	class TimingReport
+	{
+		public:
+			using Clock = std::chrono::steady_clock;
+
+			/** All recorded spans. */
+			std::vector<TimingSpan>	spans;
+
+			/**
+			*	@brief Record a span for the calling thread.
+			*
+			*	@param category	Category of the span. Must point to a string living until the end of the program.
+			*	@param name		Name of the span. Must point to a string living until the end of the program.
+			*	@param detail	Additional information about the span, usually the processed file.
+			*	@param start	Start time of the span.
+			*	@param end		End time of the span.
+			*/
+			void		addSpan(char const*			category,
+								char const*			name,
+								std::string			detail,
+								Clock::time_point	start,
+								Clock::time_point	end)								noexcept;
+
+			/**
+			*	@brief Move all spans of another report to this report.
+			*
+			*	@param otherReport	The report to merge with this report.
+			*						After the call, otherReport is empty.
+			*/
+			void		mergeReport(TimingReport&& otherReport)							noexcept;
+
+			/**
+			*	@brief	Write all spans in the Chrome trace event format.
+			*			The generated file can be loaded in chrome://tracing or https://ui.perfetto.dev.
+			*
+			*	@param path Path to the file to write.
+			*
+			*	@return true if the file has been written successfully, else false.
+			*/
+			bool		exportChromeTrace(fs::path const& path)					const	noexcept;
+
+			/**
+			*	@brief	Build a human readable summary of the report:
+			*			the cumulated duration per category/name pair followed by the slowest processed files.
+			*
+			*	@param slowestFilesCount Maximum number of slowest files to list.
+			*
+			*	@return The summary table.
+			*/
+			std::string	getSummary(size_t slowestFilesCount = 10u)				const	noexcept;
+
+			/**
+			*	@brief Get a readable version of a span name (demangled if it is a type name).
+			*
+			*	@param name Raw name of the span.
+			*
+			*	@return The readable name.
+			*/
+			static std::string	getReadableName(char const* name)						noexcept;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,36 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	struct TimingSpan
+	{
+		/** Category of the span (phase, file, module...). Must point to a string living until the end of the program. */
+		char const*	category	= nullptr;
+
+		/** Name of the span. Must point to a string living until the end of the program. */
+		char const*	name		= nullptr;
+
+		/** Optional additional information about the span, usually the processed file. */
+		std::string	detail;
+
+		/** Start time of the span in microseconds, relative to an arbitrary steady clock epoch. */
+		uint64		start		= 0u;
+
+		/** Duration of the span in microseconds. */
+		uint64		duration	= 0u;
+
+		/** Identifier of the thread which recorded the span. */
+		uint32		threadId	= 0u;
+	};
+}
\ No newline at end of file
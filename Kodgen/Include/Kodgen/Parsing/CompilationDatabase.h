@@ -0,0 +1,109 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/Optional.h"
+
+namespace kodgen
+{
+	//Forward declaration
+	class ILogger;
+
+	/**
+	*	Compilation arguments of the project files, loaded from a compile_commands.json file.
+	*	Only the arguments affecting parsing (include directories, macros, C++ version, forced includes) are kept,
+	*	and identical argument sets are stored once so that all the files of a target share the same arguments.
+	*	Headers are rarely listed in the database: they get the arguments of the nearest compiled file,
+	*	i.e. the first compiled file found in their directory or in the closest parent directory inside the project.
+	*	The project root is the deepest directory containing all compiled files and compilation directories.
+	*/
+	class CompilationDatabase
+	{
+		private:
+			/** Deduplicated argument sets. */
+			std::vector<std::vector<std::string>>					_argumentSets;
+
+			/** Index of the argument set of each file listed in the database. */
+			std::unordered_map<fs::path, uint32, PathHash>			_fileArgumentSets;
+
+			/** Index of the argument set used for the headers of each directory containing compiled files, directly or in a subdirectory. */
+			std::unordered_map<fs::path, uint32, PathHash>			_directoryArgumentSets;
+
+			/**
+			*	@brief Get the deepest directory containing two paths.
+			*
+			*	@param root	Current common root, or an empty optional if there is none yet.
+			*	@param path	Path to include in the common root.
+			*
+			*	@return The deepest directory containing both root and path.
+			*/
+			static fs::path					getCommonRoot(opt::optional<fs::path> const&	root,
+														  fs::path const&					path)					noexcept;
+
+			/**
+			*	@brief Extract the arguments affecting parsing from a compilation command.
+			*
+			*	@param arguments	All arguments of the compilation command, starting with the compiler.
+			*	@param directory	Working directory of the compilation command, used to make relative paths absolute.
+			*
+			*	@return The arguments to forward to libclang.
+			*/
+			static std::vector<std::string>	extractParsingArguments(std::vector<std::string> const&	arguments,
+																	fs::path const&					directory)	noexcept;
+
+			/**
+			*	@brief Make a path absolute and canonical if it exists.
+			*
+			*	@param path			Path to normalize.
+			*	@param directory	Directory relative paths are relative to.
+			*
+			*	@return The normalized path.
+			*/
+			static fs::path					normalizePath(fs::path const&	path,
+														  fs::path const&	directory)							noexcept;
+
+		public:
+			/**
+			*	@brief	Load the compile_commands.json file located in a directory, replacing the previously loaded commands.
+			*
+			*	@param directory	Directory containing the compile_commands.json file.
+			*	@param logger		Optional logger used to issue loading logs. Can be nullptr.
+			*
+			*	@return true if the database was loaded, else false.
+			*/
+			bool											load(fs::path const&	directory,
+																 ILogger*			logger)			noexcept;
+
+			/**
+			*	@brief Remove all loaded commands.
+			*/
+			void											clear()									noexcept;
+
+			/**
+			*	@brief Find the argument set to use to parse a file.
+			*
+			*	@param file Path to the file to parse.
+			*
+			*	@return The index of the argument set in getArgumentSets() if any, else an empty optional.
+			*/
+			opt::optional<uint32>							findArgumentSet(fs::path const& file)	const	noexcept;
+
+			/**
+			*	@brief Getter for _argumentSets field.
+			*
+			*	@return _argumentSets.
+			*/
+			std::vector<std::vector<std::string>> const&	getArgumentSets()						const	noexcept;
+	};
+}
\ No newline at end of file
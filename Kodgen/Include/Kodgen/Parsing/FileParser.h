@@ -19,6 +19,8 @@
 #include "Kodgen/Parsing/PropertyParser.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Misc/TimingReport.h"
+#include "Kodgen/Threading/CancellationToken.h"
 
 namespace kodgen
 {
@@ -34,6 +36,22 @@ namespace kodgen
 			/** Settings to use during parsing. */
 			std::shared_ptr<ParsingSettings>	_settings;
 
+			/** Token checked during parsing to abort it early. */
+			CancellationToken					_cancellationToken;
+
+			/** Time point after which the parsing of the current file is aborted. Only relevant when ParsingSettings::parsingTimeout is not 0. */
+			TimingReport::Clock::time_point		_deadline;
+
+			/**
+			*	@brief	Check whether the parsing of the current file should be aborted, either because it was cancelled or because its deadline has passed.
+			*			If so, an error is added to the parsing result.
+			*
+			*	@param out_result Result of the file being parsed.
+			*
+			*	@return true if the parsing should be aborted, else false.
+			*/
+			bool						checkInterruption(FileParsingResult& out_result)				noexcept;
+
 			/**
 			*	@brief This method is called at each node (cursor) of the parsing.
 			*
@@ -146,12 +164,14 @@ namespace kodgen
 			*	@brief Parse the file and fill the FileParsingResult.
 			*
 			*	@param toParseFile	Path to the file to parse.
-			*	@param out_result	Result filled while parsing the file.
+			*	@param out_result			Result filled while parsing the file.
+			*	@param cancellationToken	Token checked during parsing to abort it early.
 			*
 			*	@return true if the parsing process finished without error, else false
 			*/
 			bool					parse(fs::path const&					toParseFile,
-										  FileParsingResult&				out_result)		noexcept;
+										  FileParsingResult&				out_result,
+										  CancellationToken const&			cancellationToken = CancellationToken())	noexcept;
 
 			/**
 			*	@brief Getter for _settings field.
@@ -0,0 +1,185 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string_view>
+#include <unordered_map>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResultFormat.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResultView.h"
+
+namespace kodgen
+{
+	/**
+	*	Encode a FileParsingResult in the binary format described by FileParsingResultFormat and decode it back,
+	*	so that parsing results can be cached or transferred between processes.
+	*	Encoded results can be read in place through a FileParsingResultView, without decoding them.
+	*	Timing spans are not encoded.
+	*/
+	class FileParsingResultSerializer
+	{
+		private:
+			/** Entity waiting to be added to the entities section. */
+			struct PendingEntity
+			{
+				/** Entity to encode. */
+				EntityInfo const*	entity;
+
+				/** Access specifier of the entity if it is nested in a struct/class, EAccessSpecifier::Invalid otherwise. */
+				EAccessSpecifier	accessSpecifier;
+			};
+
+			/** Sections being encoded. */
+			struct Writer
+			{
+				std::vector<char>								strings;
+				std::vector<FileParsingResultFormat::StringRef>	stringRefs;
+				std::vector<FileParsingResultFormat::ErrorRecord>	errors;
+				std::vector<FileParsingResultFormat::EntityRecord>	entities;
+				std::vector<FileParsingResultFormat::TypeRecord>	types;
+				std::vector<TypePart>							typeParts;
+				std::vector<FileParsingResultFormat::TemplateParamRecord>	templateParams;
+				std::vector<FileParsingResultFormat::PropertyRecord>	properties;
+				std::vector<FileParsingResultFormat::FunctionParamRecord>	functionParams;
+				std::vector<FileParsingResultFormat::ParentRecord>	parents;
+				std::vector<FileParsingResultFormat::InheritanceLinkRecord>	inheritanceLinks;
+
+				/** Entity encoded by each record of the entities section. */
+				std::vector<EntityInfo const*>							encodedEntities;
+
+				/** Strings already added to the strings section. The viewed strings must outlive the writer. */
+				std::unordered_map<std::string_view, FileParsingResultFormat::StringRef>	stringRefsByValue;
+			};
+
+			/**
+			*	@brief Add a string to the strings section. Identical strings are only stored once.
+			*
+			*	@param writer	Writer to add the string to.
+			*	@param value	String to add.
+			*
+			*	@return The reference to the string.
+			*/
+			static FileParsingResultFormat::StringRef	addString(Writer&			writer,
+																  std::string_view	value)								noexcept;
+
+			/**
+			*	@brief Add a type and the types of its template parameters to the types section.
+			*
+			*	@param writer	Writer to add the type to.
+			*	@param type		Type to add.
+			*
+			*	@return The index of the type record.
+			*/
+			static uint32								addType(Writer&			writer,
+																TypeInfo const&	type)									noexcept;
+
+			/**
+			*	@brief Add properties and their arguments to the properties section.
+			*
+			*	@param writer		Writer to add the properties to.
+			*	@param properties	Properties to add.
+			*
+			*	@return The range of the property records.
+			*/
+			static FileParsingResultFormat::Range		addProperties(Writer&						writer,
+																	  std::vector<Property> const&	properties)			noexcept;
+
+			/**
+			*	@brief Add contiguous entity records. The children of the entities are not added.
+			*
+			*	@param writer		Writer to add the entities to.
+			*	@param entities		Entities to add.
+			*	@param outerEntity	Index of the record of the outer entity, FileParsingResultFormat::invalidIndex for top-level entities.
+			*
+			*	@return The range of the entity records.
+			*/
+			static FileParsingResultFormat::Range		addEntities(Writer&								writer,
+																	std::vector<PendingEntity> const&	entities,
+																	uint32								outerEntity)	noexcept;
+
+			/**
+			*	@brief Fill the record of an entity, except its children.
+			*
+			*	@param writer			Writer the entity is added to.
+			*	@param entity			Entity to encode.
+			*	@param out_record		Record to fill.
+			*/
+			static void									fillEntityRecord(Writer&								writer,
+																		 EntityInfo const&						entity,
+																		 FileParsingResultFormat::EntityRecord&	out_record)	noexcept;
+
+			/**
+			*	@brief Collect the entities declared in an entity, in the order described by FileParsingResultView::Entity::getChildren.
+			*
+			*	@param entity		Entity to collect the children of.
+			*	@param out_children	Vector to fill.
+			*/
+			static void									collectChildren(EntityInfo const&			entity,
+																		std::vector<PendingEntity>&	out_children)			noexcept;
+
+			/**
+			*	@brief Decode a viewed object into an info structure.
+			*
+			*	@param view			Viewed object.
+			*	@param out_value	Value to fill.
+			*/
+			static void		read(FileParsingResultView::Type const&		view, TypeInfo&				out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, EntityInfo&			out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, VariableInfo&			out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, FieldInfo&			out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, FunctionInfo&			out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, MethodInfo&			out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, EnumValueInfo&		out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, EnumInfo&				out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, StructClassInfo&		out_value)	noexcept;
+			static void		read(FileParsingResultView::Entity const&	view, NamespaceInfo&		out_value)	noexcept;
+
+		public:
+			FileParsingResultSerializer()	= delete;
+			~FileParsingResultSerializer()	= delete;
+
+			/**
+			*	@brief Encode a parsing result.
+			*
+			*	@param result		Result to encode.
+			*	@param out_buffer	Buffer to fill. Its previous content is replaced.
+			*
+			*	@return true if the result was encoded successfully, false if it doesn't fit in the 4GB the format can address.
+			*/
+			static bool	serialize(FileParsingResult const&	result,
+								  std::vector<uint8>&		out_buffer)		noexcept;
+
+			/**
+			*	@brief Encode a parsing result to a file, which can then be memory-mapped and read through a FileParsingResultView.
+			*
+			*	@param result	Result to encode.
+			*	@param file		Path of the file to write.
+			*
+			*	@return true if the file was written successfully, else false.
+			*/
+			static bool	serialize(FileParsingResult const&	result,
+								  fs::path const&			file)			noexcept;
+
+			/**
+			*	@brief Decode an encoded parsing result into info structures.
+			*
+			*	@param data			Encoded data. Must be 8-byte aligned.
+			*	@param size			Size of the encoded data in bytes.
+			*	@param out_result	Result to fill. Its previous content is replaced.
+			*
+			*	@return true if the data was decoded successfully, else false.
+			*/
+			static bool	deserialize(uint8 const*		data,
+									size_t				size,
+									FileParsingResult&	out_result)			noexcept;
+	};
+}
\ No newline at end of file
@@ -33,6 +33,10 @@ namespace kodgen
 			ParsingError()																	= delete;
 			ParsingError(std::string		errorDescription,
 						 CXSourceLocation	errorSourceLocation = clang_getNullLocation())	noexcept;
+			ParsingError(std::string		errorDescription,
+						 std::string		filename,
+						 unsigned			line,
+						 unsigned			column)											noexcept;
 			ParsingError(ParsingError const&)												= default;
 			ParsingError(ParsingError&&)													= default;
 			~ParsingError()																	= default;
@@ -8,6 +8,9 @@
 #pragma once
 
 #include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
 #include <cassert>
 
 #include "Kodgen/Parsing/ParsingError.h"
@@ -20,12 +23,24 @@
 #include "Kodgen/InfoStructures/FunctionInfo.h"
 #include "Kodgen/InfoStructures/VariableInfo.h"
 #include "Kodgen/InfoStructures/StructClassTree.h"
+#include "Kodgen/InfoStructures/EntityTable.h"
 #include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/TimingReport.h"
 
 namespace kodgen
 {
 	class FileParsingResult : public ParsingResultBase
 	{
+		private:
+			/** Entities of this result indexed by id (clang USR). Keys reference the id of the indexed entities. */
+			std::unordered_map<std::string_view, EntityInfo const*>	_entitiesById;
+
+			/** Entities of this result indexed by full name. Overloaded functions and reopened namespaces share the same full name. */
+			std::unordered_multimap<std::string, EntityInfo const*>	_entitiesByFullName;
+
+			/** Has buildEntityIndex been called on this result. */
+			bool													_hasEntityIndex	= false;
+
 		public:
 			/** Path to the parsed file. */
 			fs::path						parsedFile;
@@ -51,6 +66,15 @@ namespace kodgen
 			/** Structure containing the whole struct/class hierarchy linked to parsed structs/classes. */
 			StructClassTree					structClassTree;
 
+			/** All entities of the result in pre-order, filled by buildEntityTable. */
+			EntityTable						entityTable;
+
+			/** Timing spans recorded while parsing the file. */
+			TimingReport					timings;
+
+			/** Memory used by the translation unit of the parsed file, in bytes, as reported by libclang. */
+			uint64							translationUnitMemory	= 0u;
+
 			/**
 			*	@brief Call a visitor function on each entity of the provided type(s) contained in a file.
 			* 
@@ -58,7 +82,56 @@ namespace kodgen
 			*	@param visitor		Function to call on entities.
 			*/
 			template <typename Functor, typename = std::enable_if_t<std::is_invocable_v<Functor, EntityInfo const&>>>
-			void foreachEntityOfType(EEntityType entityMask, Functor visitor)	const	noexcept;
+			void				foreachEntityOfType(EEntityType entityMask, Functor visitor)	const	noexcept;
+
+			/**
+			*	@brief	Fill entityTable with all entities of this result.
+			*			Like EntityInfo::outerEntity, the table references the entities of this result and must be built again on copies.
+			*			Called at the end of FileParser::parse.
+			*/
+			void				buildEntityTable()													noexcept;
+
+			/**
+			*	@brief	Index all entities of this result by id and by full name, to find them without walking the whole result.
+			*			Like EntityInfo::outerEntity, the index references the entities of this result:
+			*			copies of this result reference the entities of the original, so the index must be built again if the original is destroyed.
+			*			Called at the end of FileParser::parse if ParsingSettings::shouldBuildEntityIndex is set.
+			*/
+			void				buildEntityIndex()													noexcept;
+
+			/**
+			*	@brief Check whether buildEntityIndex has been called on this result.
+			* 
+			*	@return true if the entities of this result are indexed, else false.
+			*/
+			bool				hasEntityIndex()											const	noexcept;
+
+			/**
+			*	@brief Find an entity by id in constant time. The entity index must have been built.
+			* 
+			*	@param id Id (clang USR) of the entity to look for.
+			* 
+			*	@return The first indexed entity with the provided id, nullptr if none.
+			*/
+			EntityInfo const*	findEntityById(std::string_view id)							const	noexcept;
+
+			/**
+			*	@brief Find an entity by full name in constant time. The entity index must have been built.
+			* 
+			*	@param fullName		Full name of the entity to look for, as returned by EntityInfo::getFullName (ex: "kodgen::EntityInfo").
+			*	@param entityMask	Types of entities to look for.
+			* 
+			*	@return The first indexed entity with the provided full name and a type of the mask, nullptr if none.
+			*/
+			EntityInfo const*	findEntityByFullName(std::string const&	fullName,
+													 EEntityType		entityMask)				const	noexcept;
+
+			/**
+			*	@brief Compute the memory used by this result, including all entities it contains.
+			* 
+			*	@return The number of bytes used by this result.
+			*/
+			uint64				getMemorySize()												const	noexcept;
 	};
 
 	#include "Kodgen/Parsing/ParsingResults/FileParsingResult.inl"
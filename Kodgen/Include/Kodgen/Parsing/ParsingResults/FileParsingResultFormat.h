@@ -0,0 +1,203 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/InfoStructures/TypeDescriptor.h"	//TypePart
+
+namespace kodgen
+{
+	/**
+	*	Records of the binary encoding of a FileParsingResult.
+	*
+	*	An encoded result is a Header followed by sections. Each section is an array of fixed-size records,
+	*	so that the encoded result can be read in place (from a memory-mapped file for example) without any decoding pass.
+	*	Records reference each other by index in their section, and strings by offset in the strings section.
+	*	Entities are stored in breadth-first order: the children of an entity are contiguous and stored after it.
+	*	All values are stored in the native byte order, which is little-endian on all supported platforms.
+	*	Sections start at 8-byte aligned offsets, and the encoded buffer must be 8-byte aligned.
+	*/
+	class FileParsingResultFormat
+	{
+		public:
+			/** Value used for references to no record. */
+			static constexpr uint32		invalidIndex	= 0xFFFFFFFFu;
+
+			/** Magic number at the beginning of an encoded result. */
+			static constexpr uint32		magic			= 0x5250474Bu;	//"KGPR"
+
+			/** Version of the encoding. Encoded results with a different version are rejected. */
+			static constexpr uint32		version			= 1u;
+
+			/** Reference to a string in the strings section. Strings are not null-terminated. */
+			struct StringRef
+			{
+				uint32	offset	= 0u;
+				uint32	size	= 0u;
+			};
+
+			/** Contiguous records of a section. */
+			struct Range
+			{
+				uint32	first	= 0u;
+				uint32	count	= 0u;
+			};
+
+			/** Location of a section in the encoded result. The count is a number of records, or of bytes for the strings section. */
+			struct Section
+			{
+				uint32	offset	= 0u;
+				uint32	count	= 0u;
+			};
+
+			/** Flags stored in EntityRecord::flags. */
+			enum EEntityFlags : uint32
+			{
+				IsStatic				= 1u << 0,
+				IsInline				= 1u << 1,
+				IsMutable				= 1u << 2,
+				IsDefault				= 1u << 3,
+				IsVirtual				= 1u << 4,
+				IsPureVirtual			= 1u << 5,
+				IsOverride				= 1u << 6,
+				IsFinal					= 1u << 7,
+				IsConst					= 1u << 8,
+				IsForwardDeclaration	= 1u << 9,
+				IsImportExport			= 1u << 10
+			};
+
+			struct Header
+			{
+				uint32		magic;
+				uint32		version;
+
+				/** Size of the whole encoded result in bytes. */
+				uint64		size;
+
+				uint64		translationUnitMemory;
+				StringRef	parsedFile;
+
+				/** Top-level entities, in the entities section. */
+				Range		rootEntities;
+
+				Section		strings;
+				Section		stringRefs;
+				Section		errors;
+				Section		entities;
+				Section		types;
+				Section		typeParts;
+				Section		templateParams;
+				Section		properties;
+				Section		functionParams;
+				Section		parents;
+				Section		inheritanceLinks;
+			};
+
+			struct ErrorRecord
+			{
+				StringRef	description;
+				StringRef	filename;
+				uint32		line;
+				uint32		column;
+			};
+
+			/** Record shared by all entity types. Fields which don't apply to an entity type are left to their default value. */
+			struct EntityRecord
+			{
+				uint16		entityType;
+				uint8		accessSpecifier;
+				uint8		padding0;
+
+				/** Combination of EEntityFlags. */
+				uint32		flags;
+
+				StringRef	name;
+				StringRef	id;
+
+				/** Prototype of functions and methods. */
+				StringRef	prototype;
+
+				uint32		outerEntity;
+
+				/** Type of variables, fields, structs, classes and enums, return type of functions and methods. */
+				uint32		type;
+
+				/** Underlying type of enums. */
+				uint32		underlyingType;
+				uint32		padding1;
+
+				Range		properties;
+				Range		children;
+				Range		parameters;
+				Range		parents;
+
+				/** Value of enum values, memory offset of fields. */
+				int64		value;
+			};
+
+			struct TypeRecord
+			{
+				StringRef	fullName;
+				StringRef	canonicalFullName;
+				Range		templateParams;
+				Range		typeParts;
+				uint64		sizeInBytes;
+			};
+
+			struct TemplateParamRecord
+			{
+				int32		kind;
+				uint32		type;
+				StringRef	name;
+			};
+
+			struct PropertyRecord
+			{
+				StringRef	name;
+
+				/** Arguments, in the stringRefs section. */
+				Range		arguments;
+			};
+
+			struct FunctionParamRecord
+			{
+				uint32		type;
+				uint32		padding;
+				StringRef	name;
+			};
+
+			struct ParentRecord
+			{
+				uint32		inheritanceAccess;
+				uint32		type;
+			};
+
+			struct InheritanceLinkRecord
+			{
+				StringRef	childStructClassName;
+				StringRef	inheritedStructClassName;
+				uint32		inheritanceAccess;
+				uint32		padding;
+			};
+
+			FileParsingResultFormat()	= delete;
+			~FileParsingResultFormat()	= delete;
+	};
+
+	//Records are read in place, so their layout must not depend on the compiler
+	static_assert(sizeof(FileParsingResultFormat::Header) % 8u == 0u);
+	static_assert(sizeof(FileParsingResultFormat::ErrorRecord) % 8u == 0u);
+	static_assert(sizeof(FileParsingResultFormat::EntityRecord) == 88u);
+	static_assert(sizeof(FileParsingResultFormat::TypeRecord) == 40u);
+	static_assert(sizeof(FileParsingResultFormat::TemplateParamRecord) == 16u);
+	static_assert(sizeof(FileParsingResultFormat::PropertyRecord) == 16u);
+	static_assert(sizeof(FileParsingResultFormat::FunctionParamRecord) == 16u);
+	static_assert(sizeof(FileParsingResultFormat::ParentRecord) == 8u);
+	static_assert(sizeof(FileParsingResultFormat::InheritanceLinkRecord) == 24u);
+	static_assert(sizeof(TypePart) == 8u);
+}
\ No newline at end of file
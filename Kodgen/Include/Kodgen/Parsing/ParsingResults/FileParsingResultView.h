@@ -0,0 +1,350 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string_view>
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/EAccessSpecifier.h"
+#include "Kodgen/InfoStructures/EEntityType.h"
+#include "Kodgen/InfoStructures/ETemplateParameterKind.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResultFormat.h"
+
+namespace kodgen
+{
+	/**
+	*	Read-only view over a FileParsingResult encoded by FileParsingResultSerializer.
+	*	The view reads the records in place, so opening a buffer only validates its header and section bounds.
+	*	Out of range references in the records are returned as empty views rather than read,
+	*	and children are only followed forward in the buffer, so corrupted data can't be used to loop forever.
+	*	The encoded buffer must outlive the view and all views obtained from it.
+	*/
+	class FileParsingResultView
+	{
+		public:
+			/**
+			*	Contiguous views of the same kind.
+			*/
+			template <typename T>
+			class Range
+			{
+				public:
+					class Iterator
+					{
+						private:
+							FileParsingResultView const*	_result;
+							uint32							_index;
+
+						public:
+							Iterator(FileParsingResultView const* result, uint32 index)	noexcept: _result{result}, _index{index} {}
+
+							T			operator*()								const	noexcept	{ return T(_result, _index); }
+							Iterator&	operator++()									noexcept	{ _index++; return *this; }
+							bool		operator!=(Iterator const& other)		const	noexcept	{ return _index != other._index; }
+					};
+
+				private:
+					FileParsingResultView const*	_result	= nullptr;
+					uint32							_first	= 0u;
+					uint32							_count	= 0u;
+
+				public:
+					Range()																		= default;
+					Range(FileParsingResultView const* result, uint32 first, uint32 count)	noexcept: _result{result}, _first{first}, _count{count} {}
+
+					Iterator	begin()						const	noexcept	{ return Iterator(_result, _first); }
+					Iterator	end()						const	noexcept	{ return Iterator(_result, _first + _count); }
+					uint32		size()						const	noexcept	{ return _count; }
+					bool		empty()						const	noexcept	{ return _count == 0u; }
+					T			operator[](uint32 index)	const	noexcept	{ return T(_result, _first + index); }
+			};
+
+			class Type;
+
+			class TemplateParam
+			{
+				private:
+					FileParsingResultView const*						_result;
+					FileParsingResultFormat::TemplateParamRecord const*	_record;
+					uint32												_index;
+
+				public:
+					TemplateParam(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					ETemplateParameterKind	getKind()	const	noexcept;
+					std::string_view		getName()	const	noexcept;
+
+					/**
+					*	@return The type of the template parameter. Invalid if the parameter has no type.
+					*/
+					Type					getType()	const	noexcept;
+			};
+
+			class Type
+			{
+				private:
+					FileParsingResultView const*					_result;
+					FileParsingResultFormat::TypeRecord const*		_record;
+					uint32											_index;
+
+				public:
+					Type(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					/**
+					*	@return true if the view references an existing type, else false.
+					*/
+					bool					isValid()				const	noexcept;
+
+					std::string_view		getFullName()			const	noexcept;
+					std::string_view		getCanonicalFullName()	const	noexcept;
+					uint64					getSizeInBytes()		const	noexcept;
+					Range<TemplateParam>	getTemplateParams()		const	noexcept;
+
+					/**
+					*	@return The first type part of the type, read in place. There are getTypePartCount() parts.
+					*/
+					TypePart const*			getTypeParts()			const	noexcept;
+					uint32					getTypePartCount()		const	noexcept;
+			};
+
+			class Property
+			{
+				private:
+					FileParsingResultView const*					_result;
+					FileParsingResultFormat::PropertyRecord const*	_record;
+
+				public:
+					Property(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					std::string_view	getName()						const	noexcept;
+					uint32				getArgumentCount()				const	noexcept;
+					std::string_view	getArgument(uint32 index)		const	noexcept;
+			};
+
+			class FunctionParam
+			{
+				private:
+					FileParsingResultView const*						_result;
+					FileParsingResultFormat::FunctionParamRecord const*	_record;
+
+				public:
+					FunctionParam(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					std::string_view	getName()	const	noexcept;
+					Type				getType()	const	noexcept;
+			};
+
+			class Parent
+			{
+				private:
+					FileParsingResultView const*					_result;
+					FileParsingResultFormat::ParentRecord const*	_record;
+
+				public:
+					Parent(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					EAccessSpecifier	getInheritanceAccess()	const	noexcept;
+					Type				getType()				const	noexcept;
+			};
+
+			class Entity
+			{
+				private:
+					FileParsingResultView const*					_result;
+					FileParsingResultFormat::EntityRecord const*	_record;
+					uint32											_index;
+
+				public:
+					Entity(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					/**
+					*	@return true if the view references an existing entity, else false.
+					*/
+					bool				isValid()								const	noexcept;
+
+					/**
+					*	@return The index of the entity in the flat entity table of the result.
+					*/
+					uint32				getIndex()								const	noexcept;
+
+					EEntityType			getEntityType()							const	noexcept;
+					std::string_view	getName()								const	noexcept;
+					std::string_view	getId()									const	noexcept;
+					Range<Property>		getProperties()							const	noexcept;
+
+					/**
+					*	@return The entity containing this entity. Invalid for top-level entities.
+					*/
+					Entity				getOuterEntity()						const	noexcept;
+
+					/**
+					*	@brief	Get the entities declared in this entity:
+					*			- Namespace: namespaces, structs, classes, enums, functions then variables,
+					*			- Struct/Class: nested structs, nested classes, nested enums, fields then methods,
+					*			- Enum: enum values.
+					*
+					*	@return The children of the entity.
+					*/
+					Range<Entity>		getChildren()							const	noexcept;
+
+					/**
+					*	@return The access specifier of fields, methods and nested entities, EAccessSpecifier::Invalid for others.
+					*/
+					EAccessSpecifier	getAccessSpecifier()					const	noexcept;
+
+					/**
+					*	@param flag Flag to check.
+					*
+					*	@return true if the flag is set on the entity, else false.
+					*/
+					bool				hasFlag(FileParsingResultFormat::EEntityFlags flag)	const	noexcept;
+
+					/**
+					*	@return The type of variables, fields, structs, classes and enums, the return type of functions and methods.
+					*/
+					Type				getType()								const	noexcept;
+
+					/**
+					*	@return The underlying type of enums.
+					*/
+					Type				getUnderlyingType()						const	noexcept;
+
+					/**
+					*	@return The prototype of functions and methods.
+					*/
+					std::string_view	getPrototype()							const	noexcept;
+					Range<FunctionParam>	getParameters()						const	noexcept;
+					Range<Parent>		getParents()							const	noexcept;
+
+					/**
+					*	@return The value of enum values, the memory offset of fields.
+					*/
+					int64				getValue()								const	noexcept;
+			};
+
+			class ParsingError
+			{
+				private:
+					FileParsingResultView const*				_result;
+					FileParsingResultFormat::ErrorRecord const*	_record;
+
+				public:
+					ParsingError(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					std::string_view	getDescription()	const	noexcept;
+					std::string_view	getFilename()		const	noexcept;
+					uint32				getLine()			const	noexcept;
+					uint32				getColumn()			const	noexcept;
+			};
+
+			class InheritanceLink
+			{
+				private:
+					FileParsingResultView const*							_result;
+					FileParsingResultFormat::InheritanceLinkRecord const*	_record;
+
+				public:
+					InheritanceLink(FileParsingResultView const* result, uint32 index)	noexcept;
+
+					std::string_view	getChildStructClassName()		const	noexcept;
+					std::string_view	getInheritedStructClassName()	const	noexcept;
+					EAccessSpecifier	getInheritanceAccess()			const	noexcept;
+			};
+
+		private:
+			/** Encoded data, nullptr if no valid buffer is opened. */
+			uint8 const*							_data	= nullptr;
+
+			/** Header of the encoded data. */
+			FileParsingResultFormat::Header const*	_header	= nullptr;
+
+			/**
+			*	@brief Check that a section fits in the opened buffer.
+			*
+			*	@param section		Section to check.
+			*	@param recordSize	Size of a record of the section in bytes.
+			*
+			*	@return true if the section fits in the buffer, else false.
+			*/
+			bool			isValidSection(FileParsingResultFormat::Section const&	section,
+										   size_t									recordSize)	const	noexcept;
+
+			/**
+			*	@brief Get a record of a section.
+			*
+			*	@param section	Section containing the record.
+			*	@param index	Index of the record in the section.
+			*
+			*	@return The record, or nullptr if the index is out of range.
+			*/
+			template <typename T>
+			T const*				getRecord(FileParsingResultFormat::Section const&	section,
+											  uint32									index)	const	noexcept;
+
+			/**
+			*	@brief Get a string of the strings section.
+			*
+			*	@param ref Reference to the string.
+			*
+			*	@return The string, or an empty string if the reference is out of range.
+			*/
+			std::string_view		getString(FileParsingResultFormat::StringRef const& ref)	const	noexcept;
+
+			/**
+			*	@brief Clamp a range to a section, so that views never reference records out of the buffer.
+			*
+			*	@param section	Section the range references.
+			*	@param range	Range to clamp.
+			*
+			*	@return The first index and count of the clamped range.
+			*/
+			FileParsingResultFormat::Range	clampRange(FileParsingResultFormat::Section const&	section,
+													   FileParsingResultFormat::Range const&	range)	const	noexcept;
+
+			/**
+			*	@return The header of the opened buffer, or an header with empty sections if the view is invalid.
+			*/
+			FileParsingResultFormat::Header const&	getHeader()				const	noexcept;
+
+		public:
+			FileParsingResultView()	= default;
+
+			/**
+			*	@brief	Open an encoded buffer. Only the header and the section bounds are checked.
+			*
+			*	@param data	Encoded data. Must be 8-byte aligned.
+			*	@param size	Size of the encoded data in bytes.
+			*
+			*	@return true if the buffer is a valid encoded result, else false.
+			*/
+			bool					open(uint8 const*	data,
+										 size_t			size)						noexcept;
+
+			/**
+			*	@return true if a valid buffer is opened, else false.
+			*/
+			bool					isValid()								const	noexcept;
+
+			std::string_view		getParsedFile()							const	noexcept;
+			uint64					getTranslationUnitMemory()				const	noexcept;
+			Range<ParsingError>		getErrors()								const	noexcept;
+
+			/**
+			*	@return The top-level entities of the file: namespaces, structs, classes, enums, functions then variables.
+			*/
+			Range<Entity>			getRootEntities()						const	noexcept;
+
+			/**
+			*	@return All entities of the file, in breadth-first order.
+			*/
+			Range<Entity>			getEntities()							const	noexcept;
+			Range<InheritanceLink>	getInheritanceLinks()					const	noexcept;
+	};
+
+	#include "Kodgen/Parsing/ParsingResults/FileParsingResultView.inl"
+}
\ No newline at end of file
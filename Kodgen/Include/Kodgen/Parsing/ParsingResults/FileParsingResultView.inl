@@ -0,0 +1,17 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename T>
+T const* FileParsingResultView::getRecord(FileParsingResultFormat::Section const& section, uint32 index) const noexcept
+{
+	if (_data == nullptr || index >= section.count)
+	{
+		return nullptr;
+	}
+
+	return reinterpret_cast<T const*>(_data + section.offset) + index;
+}
\ No newline at end of file
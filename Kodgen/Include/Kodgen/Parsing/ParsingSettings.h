@@ -11,6 +11,7 @@
 #include <string>
 
 #include "Kodgen/Properties/PropertyParsingSettings.h"
+#include "Kodgen/Parsing/CompilationDatabase.h"
 #include "Kodgen/Misc/Settings.h"
 #include "Kodgen/Misc/Filesystem.h"
 #include "Kodgen/Misc/Optional.h"
@@ -55,6 +56,12 @@ namespace kodgen
 
 			std::vector<char const*>				_compilationArguments;
 
+			/** Compilation commands loaded from compilationDatabaseDirectory. */
+			CompilationDatabase						_compilationDatabase;
+
+			/** Compilation arguments of each argument set of _compilationDatabase, built once and shared by all the files using the set. */
+			std::vector<std::vector<char const*>>	_argumentSetCompilationArguments;
+
 			/**
 			*	@brief Try to convert an integer to a ECppVersion enum value.
 			* 
@@ -105,6 +112,24 @@ namespace kodgen
 			void	loadShouldLogDiagnostic(toml::value const&	parsingSettings,
 											ILogger*			logger)						noexcept;
 
+			/**
+			*	@brief Load the shouldBuildEntityIndex setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadShouldBuildEntityIndex(toml::value const&	parsingSettings,
+											   ILogger*				logger)					noexcept;
+
+			/**
+			*	@brief Load the parsingTimeout setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadParsingTimeout(toml::value const&	parsingSettings,
+									   ILogger*				logger)							noexcept;
+
 			/**
 			*	@brief Load the shouldAbortParsingOnFirstError setting from toml.
 			*
@@ -123,6 +148,15 @@ namespace kodgen
 			void	loadCompilerExeName(toml::value const&	parsingSettings,
 										ILogger*			logger)							noexcept;
 
+			/**
+			*	@brief	Load the compilationDatabaseDirectory setting from toml.
+			*
+			*	@param parsingSettings	Toml content.
+			*	@param logger			Optional logger used to issue loading logs. Can be nullptr.
+			*/
+			void	loadCompilationDatabaseDirectory(toml::value const&	parsingSettings,
+													 ILogger*			logger)				noexcept;
+
 			/**
 			*	@brief	Load the _projectIncludeDirectories setting from toml.
 			*			Loaded directories completely replace previous _projectIncludeDirectories if any.
@@ -187,6 +221,25 @@ namespace kodgen
 			*/
 			bool									shouldLogDiagnostic				= false;
 
+			/**
+			*	Should the entities of each parsing result be indexed by id and by full name (see FileParsingResult::buildEntityIndex).
+			*	Makes entity lookups constant time for generators cross-referencing entities, at the cost of some parsing time and memory.
+			*/
+			bool									shouldBuildEntityIndex			= false;
+
+			/**
+			*	Maximum duration of the parsing of a file in milliseconds, 0 for no limit. A file exceeding it fails with a parsing error.
+			*	The libclang parsing of a file can't be interrupted, so the limit is checked once libclang returns and while visiting the AST,
+			*	unless files are parsed by worker processes (see CodeGenManager::parsingWorkerPool) which are killed when the limit is reached.
+			*/
+			uint32									parsingTimeout					= 0u;
+
+			/**
+			*	Directory containing the compile_commands.json file of the project, empty to parse all files with the same arguments.
+			*	Each file is then parsed with the include directories, macros and C++ version of its own target (see CompilationDatabase).
+			*/
+			fs::path								compilationDatabaseDirectory;
+
 			virtual ~ParsingSettings() = default;
 
 			/**
@@ -241,6 +294,16 @@ namespace kodgen
 			*/
 			std::vector<char const*> const&					getCompilationArguments()							const	noexcept;
 
+			/**
+			*	@brief	Get the compilation arguments to parse a file, including the arguments of its target
+			*			if a compilation database is used. Files of the same target share the same arguments.
+			*
+			*	@param file Path to the file to parse.
+			* 
+			*	@return The arguments to forward to libclang.
+			*/
+			std::vector<char const*> const&					getCompilationArguments(fs::path const& file)		const	noexcept;
+
 			/**
 			*	@brief	Setter for _compilerExeName field.
 			*			This will also check that the compiler is indeed available on the running computer.
@@ -0,0 +1,284 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <functional>	//std::function
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+#include "Kodgen/Misc/Filesystem.h"
+#include "Kodgen/Misc/ILogger.h"
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+#include "Kodgen/Threading/CancellationToken.h"
+
+namespace kodgen
+{
+	/**
+	*	Pool of forked processes parsing files on behalf of the current process.
+	*	Each worker receives file paths through a socket and sends back the serialized FileParsingResult,
+	*	so that libclang allocations and global state are not shared between parsings, and a libclang crash
+	*	only fails the file being parsed. A worker can be recycled after a number of files to release its memory.
+	*	Forking a process running several threads is unsafe: the child only gets the forking thread, and the locks held by the other threads
+	*	(allocator, streams, loggers...) stay locked forever. start() therefore forks a single helper process, before the process starts any thread,
+	*	and all workers, including the replacements of crashed or recycled workers, are forked by the helper.
+	*	Forking is only supported on POSIX systems.
+	*/
+	class ParsingWorkerPool
+	{
+		public:
+			/** Function called by a worker to parse a file. */
+			using ParseFunction = std::function<void(fs::path const&, FileParsingResult&)>;
+
+		private:
+			struct Worker
+			{
+				/** Process id of the worker. */
+				int		processId		= -1;
+
+				/** Socket used to communicate with the worker. */
+				int		socket			= -1;
+
+				/** Number of files parsed by the worker process since it was spawned. */
+				uint32	parsedFileCount	= 0u;
+			};
+
+			enum class EWaitResult
+			{
+				/** Data is available on the socket. */
+				Ready,
+
+				/** The deadline has passed before any data was available. */
+				TimedOut,
+
+				/** The cancellation token was cancelled before any data was available. */
+				Cancelled,
+
+				/** The socket could not be polled. */
+				Failed
+			};
+
+			/** Request sent by the pool to its helper process. */
+			enum class EHelperCommand : uint8
+			{
+				/** Fork a new worker and send back its process id and socket. */
+				SpawnWorker,
+
+				/** Wait for a worker process to exit and send back its exit status. */
+				WaitWorker
+			};
+
+			/** Function called by the workers to parse a file. */
+			ParseFunction				_parseFunction;
+
+			/** Number of files parsed by a worker before it is replaced by a new process. 0 if workers are never recycled. */
+			uint32						_maxFilesPerWorker	= 0u;
+
+			/** All workers of the pool. */
+			std::vector<Worker>			_workers;
+
+			/** Index of the workers which are not parsing a file. */
+			std::vector<size_t>			_idleWorkers;
+
+			/** Number of workers which have a running process. */
+			size_t						_runningWorkerCount	= 0u;
+
+			/** Process id of the helper process forking the workers. */
+			int							_helperProcessId	= -1;
+
+			/** Socket used to send requests to the helper process. */
+			int							_helperSocket		= -1;
+
+			/** Mutex used to synchronize workers acquisition and the requests sent to the helper process. */
+			std::mutex					_mutex;
+
+			/** Condition notified when a worker becomes idle. */
+			std::condition_variable		_idleWorkerCondition;
+
+			/**
+			*	@brief	Stop all worker processes and the helper process.
+			*			_mutex must be locked by the caller.
+			*/
+			void				stopProcesses()										noexcept;
+
+			/**
+			*	@brief	Ask the helper process to fork a new worker process.
+			*			_mutex must be locked by the caller so that requests to the helper process don't interleave.
+			*
+			*	@param out_worker Worker to initialize.
+			*
+			*	@return true if the worker was spawned successfully, else false.
+			*/
+			bool				spawnWorker(Worker& out_worker)						noexcept;
+
+			/**
+			*	@brief	Close the socket of a worker and wait for its process to exit.
+			*			_mutex must be locked by the caller so that requests to the helper process don't interleave.
+			*
+			*	@param worker Worker to stop.
+			*
+			*	@return A description of how the worker process exited.
+			*/
+			std::string			stopWorker(Worker& worker)							noexcept;
+
+			/**
+			*	@brief Main loop of the helper process, forking workers and waiting for them on request of the pool. This method never returns.
+			*
+			*	@param socket				Socket used to communicate with the pool.
+			*	@param parseFunction		Function used by the workers to parse a file.
+			*	@param maxFilesPerWorker	Number of files parsed by a worker before exiting. 0 if unlimited.
+			*/
+			[[noreturn]]
+			static void			runHelper(int					socket,
+										  ParseFunction const&	parseFunction,
+										  uint32				maxFilesPerWorker)	noexcept;
+
+			/**
+			*	@brief Main loop of a worker process. This method never returns.
+			*
+			*	@param socket				Socket used to communicate with the pool.
+			*	@param parseFunction		Function used to parse a file.
+			*	@param maxFilesPerWorker	Number of files to parse before exiting. 0 if unlimited.
+			*/
+			[[noreturn]]
+			static void			runWorker(int					socket,
+										  ParseFunction const&	parseFunction,
+										  uint32				maxFilesPerWorker)	noexcept;
+
+			/**
+			*	@brief Wait until data is available on a socket, the timeout has expired or the cancellation token is cancelled.
+			*
+			*	@param socket				Socket to wait for.
+			*	@param timeout				Maximum waiting duration in milliseconds, 0 to wait without limit.
+			*	@param cancellationToken	Token checked regularly while waiting.
+			*
+			*	@return Why the wait ended.
+			*/
+			static EWaitResult	waitForData(int							socket,
+											uint32						timeout,
+											CancellationToken const&	cancellationToken)	noexcept;
+
+			/**
+			*	@brief Send data through a socket.
+			*
+			*	@param socket	Socket to write to.
+			*	@param data		Data to send.
+			*	@param size		Size of the data in bytes.
+			*
+			*	@return true if all data was sent, else false.
+			*/
+			static bool			sendAll(int				socket,
+										void const*		data,
+										size_t			size)						noexcept;
+
+			/**
+			*	@brief Receive data from a socket.
+			*
+			*	@param socket		Socket to read from.
+			*	@param out_data		Buffer to fill.
+			*	@param size			Size of the data to receive in bytes.
+			*
+			*	@return true if all data was received, else false.
+			*/
+			static bool			receiveAll(int		socket,
+										   void*	out_data,
+										   size_t	size)							noexcept;
+
+			/**
+			*	@brief Create a pair of connected sockets.
+			*
+			*	@param out_sockets Array of 2 file descriptors to fill.
+			*
+			*	@return true if the sockets were created, else false.
+			*/
+			static bool			createSocketPair(int* out_sockets)						noexcept;
+
+			/**
+			*	@brief Send a file descriptor to the process at the other end of a socket.
+			*
+			*	@param socket		Socket to write to.
+			*	@param descriptor	File descriptor to send.
+			*
+			*	@return true if the file descriptor was sent, else false.
+			*/
+			static bool			sendDescriptor(int	socket,
+											   int	descriptor)							noexcept;
+
+			/**
+			*	@brief Receive a file descriptor sent with sendDescriptor.
+			*
+			*	@param socket Socket to read from.
+			*
+			*	@return The received file descriptor, or -1 if none could be received.
+			*/
+			static int			receiveDescriptor(int socket)							noexcept;
+
+		public:
+			/** Logger used to issue logs from the pool. Can be nullptr. */
+			ILogger*	logger	= nullptr;
+
+			ParsingWorkerPool()							= default;
+			ParsingWorkerPool(ParsingWorkerPool const&)	= delete;
+			ParsingWorkerPool(ParsingWorkerPool&&)		= delete;
+			~ParsingWorkerPool()						noexcept;
+
+			/**
+			*	@brief Check whether worker processes can be used on this platform.
+			*
+			*	@return true if worker processes are supported, else false.
+			*/
+			static bool	isSupported()													noexcept;
+
+			/**
+			*	@brief	Fork the helper process and spawn the worker processes. The pool must not be running.
+			*			This method must be called before the process starts any thread, including the threads of a ThreadPool or an AsyncLogger,
+			*			and after everything used by parseFunction is set up: the workers get a copy of the process as it was when this method was called.
+			*			A FileParser used by parseFunction must have its settings initialized (see ParsingSettings::init) and a logger which doesn't use threads.
+			*
+			*	@param workerCount			Number of worker processes.
+			*	@param maxFilesPerWorker	Number of files parsed by a worker before it is replaced by a new process. 0 if workers are never recycled.
+			*	@param parseFunction		Function called by the workers to parse a file.
+			*
+			*	@return true if all workers were spawned successfully, else false.
+			*/
+			bool		start(uint32			workerCount,
+							  uint32			maxFilesPerWorker,
+							  ParseFunction		parseFunction)								noexcept;
+
+			/**
+			*	@brief	Parse a file in a worker process. If no worker is idle, wait until one becomes idle.
+			*			If the worker crashes, an error is added to the result and the worker is replaced.
+			*			If the parsing exceeds the timeout or is cancelled, the worker is killed, an error is added to the result and the worker is replaced.
+			*			This method is thread-safe.
+			*
+			*	@param file					File to parse.
+			*	@param out_result			Result to fill.
+			*	@param timeout				Maximum parsing duration in milliseconds, 0 for no limit.
+			*	@param cancellationToken	Token checked while the worker is parsing.
+			*
+			*	@return true if the worker sent back a result, else false.
+			*/
+			bool		parse(fs::path const&			file,
+							  FileParsingResult&		out_result,
+							  uint32					timeout = 0u,
+							  CancellationToken const&	cancellationToken = CancellationToken())	noexcept;
+
+			/**
+			*	@brief Stop all worker processes and the helper process. No file must be being parsed.
+			*/
+			void		stop()															noexcept;
+
+			/**
+			*	@brief Check whether the pool has been started and not stopped since.
+			*
+			*	@return true if the pool is running, else false.
+			*/
+			bool		isRunning()												const	noexcept;
+	};
+}
\ No newline at end of file
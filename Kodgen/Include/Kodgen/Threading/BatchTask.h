@@ -0,0 +1,138 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <memory>	//std::shared_ptr
+
+#include "Kodgen/Threading/TaskBase.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Task calling a function on each index of a range, executed by several workers at the same time.
+	*	Each worker executing the task claims chunks of indices until the range is exhausted,
+	*	so a whole batch costs a single allocation instead of one task, future and callable per index.
+	*/
+	class BatchTaskBase : public TaskBase
+	{
+		private:
+			/** Number of indices of the batch. */
+			uint64					_count;
+
+			/** Number of indices claimed at once by a worker. */
+			uint64					_chunkSize;
+
+			/** Next index to claim. */
+			std::atomic<uint64>		_nextIndex		= 0u;
+
+			/** Number of indices which have not been processed yet, plus one until the batch has finished. The batch has finished when it reaches 0. */
+			std::atomic<uint64>		_remainingCount;
+
+			/** Set when at least one chunk has been skipped because the batch was cancelled. */
+			std::atomic_bool		_skippedChunk	= false;
+
+			/** Mutex and condition used to block the threads waiting for the batch to finish. */
+			mutable std::mutex				_finishedMutex;
+			mutable std::condition_variable	_finishedCondition;
+
+		protected:
+			/**
+			*	@brief Process the indices [begin, end[.
+			*
+			*	@param begin	First index to process.
+			*	@param end		Index following the last index to process.
+			*/
+			virtual void	executeRange(uint64 begin,
+										 uint64 end)										noexcept = 0;
+
+		public:
+			BatchTaskBase(char const*								name,
+						  uint64									count,
+						  uint64									chunkSize,
+						  std::vector<std::shared_ptr<TaskBase>>&&	deps,
+						  CancellationToken							cancellationToken)	noexcept;
+
+			virtual bool	isReadyToExecute()								const	noexcept override;
+
+			/**
+			*	@brief	Process chunks of indices until all indices have been claimed. Can be called by several workers at the same time.
+			*			Chunks claimed once the batch is cancelled are skipped.
+			*/
+			virtual void	execute()												noexcept override;
+			virtual bool	hasFinished()									const	noexcept override;
+			virtual void	wait()											const	noexcept override;
+
+			/**
+			*	@brief Get the number of workers which can usefully execute this batch at the same time.
+			*
+			*	@param workerCount Number of workers of the executor.
+			*
+			*	@return The number of times the batch should be queued in the executor.
+			*/
+			uint64			getParallelism(uint64 workerCount)				const	noexcept;
+	};
+
+	/**
+	*	Batch task storing the value returned for each index.
+	*/
+	template <typename ResultType>
+	class BatchTaskResults : public BatchTaskBase
+	{
+		protected:
+			/** Value returned for each index. */
+			std::vector<ResultType>	results;
+
+		public:
+			BatchTaskResults(char const*								name,
+							 uint64										count,
+							 uint64										chunkSize,
+							 std::vector<std::shared_ptr<TaskBase>>&&	deps,
+							 CancellationToken							cancellationToken)	noexcept;
+
+			/**
+			*	@brief	Move the results out of the batch. The batch must have finished and must not have been cancelled.
+			*
+			*	@return The value returned for each index of the batch.
+			*/
+			std::vector<ResultType>	takeResults()													noexcept;
+	};
+
+	template <>
+	class BatchTaskResults<void> : public BatchTaskBase
+	{
+		public:
+			using BatchTaskBase::BatchTaskBase;
+	};
+
+	template <typename ResultType, typename Callable>
+	class BatchTask final : public BatchTaskResults<ResultType>
+	{
+		private:
+			/** Function called on each index. */
+			Callable	_callable;
+
+		protected:
+			virtual void	executeRange(uint64 begin,
+										 uint64 end)										noexcept override;
+
+		public:
+			BatchTask(char const*								name,
+					  uint64									count,
+					  uint64									chunkSize,
+					  Callable&&								callable,
+					  std::vector<std::shared_ptr<TaskBase>>&&	deps,
+					  CancellationToken							cancellationToken)		noexcept;
+	};
+
+	#include "Kodgen/Threading/BatchTask.inl"
+}
\ No newline at end of file
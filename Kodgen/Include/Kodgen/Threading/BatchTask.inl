@@ -0,0 +1,42 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename ResultType>
+BatchTaskResults<ResultType>::BatchTaskResults(char const* name, uint64 count, uint64 chunkSize, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken) noexcept:
+	BatchTaskBase(name, count, chunkSize, std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps), std::move(cancellationToken)),
+	results(static_cast<size_t>(count))
+{
+}
+
+template <typename ResultType>
+std::vector<ResultType> BatchTaskResults<ResultType>::takeResults() noexcept
+{
+	return std::move(results);
+}
+
+template <typename ResultType, typename Callable>
+BatchTask<ResultType, Callable>::BatchTask(char const* name, uint64 count, uint64 chunkSize, Callable&& callable, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken) noexcept:
+	BatchTaskResults<ResultType>(name, count, chunkSize, std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps), std::move(cancellationToken)),
+	_callable{std::forward<Callable>(callable)}
+{
+}
+
+template <typename ResultType, typename Callable>
+void BatchTask<ResultType, Callable>::executeRange(uint64 begin, uint64 end) noexcept
+{
+	for (uint64 i = begin; i < end; i++)
+	{
+		if constexpr (std::is_void_v<ResultType>)
+		{
+			_callable(i, this);
+		}
+		else
+		{
+			this->results[static_cast<size_t>(i)] = _callable(i, this);
+		}
+	}
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>	//std::shared_ptr
+
+namespace kodgen
+{
+	/**
+	*	Read-only view over the cancellation state of a CancellationSource.
+	*	Tokens are cheap to copy and can be checked from any thread.
+	*	A default-constructed token is never cancelled.
+	*/
+	class CancellationToken
+	{
+		friend class CancellationSource;
+
+		private:
+			/** Flag shared with the source of the token, nullptr if the token has no source. */
+			std::shared_ptr<std::atomic_bool const>	_isCancelled;
+
+			CancellationToken(std::shared_ptr<std::atomic_bool const> isCancelled)	noexcept;
+
+		public:
+			CancellationToken()	= default;
+
+			/**
+			*	@brief Check whether the source of this token has been cancelled.
+			*
+			*	@return true if cancellation has been requested, else false.
+			*/
+			bool	isCancellationRequested()	const	noexcept;
+	};
+
+	/**
+	*	Owner of a cancellation state, used to cancel all the tokens it has given.
+	*	Cancellation is cooperative: cancelled work only stops when it checks its token.
+	*/
+	class CancellationSource
+	{
+		private:
+			/** Flag shared with all tokens of this source. */
+			std::shared_ptr<std::atomic_bool>	_isCancelled;
+
+		public:
+			CancellationSource()	noexcept;
+
+			/**
+			*	@brief Request the cancellation of all tokens of this source. This method is thread-safe.
+			*/
+			void				cancel()							noexcept;
+
+			/**
+			*	@brief Check whether cancel has been called on this source.
+			*
+			*	@return true if cancellation has been requested, else false.
+			*/
+			bool				isCancellationRequested()	const	noexcept;
+
+			/**
+			*	@brief Get a token cancelled when this source is cancelled.
+			*
+			*	@return A token of this source.
+			*/
+			CancellationToken	getToken()					const	noexcept;
+	};
+}
\ No newline at end of file
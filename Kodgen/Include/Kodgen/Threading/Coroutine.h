@@ -0,0 +1,267 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#if !KODGEN_COROUTINES
+#error "Kodgen/Threading/Coroutine.h requires Kodgen to be built with the KODGEN_COROUTINES option (C++20)."
+#endif
+
+#include <coroutine>
+#include <optional>
+#include <atomic>
+#include <memory>		//std::shared_ptr
+#include <string>
+#include <exception>	//std::terminate
+
+#include "Kodgen/Threading/IExecutor.h"
+#include "Kodgen/Threading/TaskHelper.h"
+
+namespace kodgen
+{
+	//Forward declaration
+	template <typename T>
+	class CoroutineTask;
+
+	/**
+	*	Task finished when a coroutine submitted with CoroutineHelper::submitCoroutine completes.
+	*	It is only used as a dependency, so it is never executed.
+	*/
+	class CoroutineCompletion final : public TaskBase
+	{
+		private:
+			/** Has the coroutine completed? */
+			std::atomic_bool	_finished	= false;
+
+		public:
+			CoroutineCompletion()	noexcept;
+
+			/**
+			*	@brief Mark the coroutine as completed.
+			*/
+			void				finish()					noexcept;
+
+			virtual bool		isReadyToExecute()	const	noexcept override;
+			virtual void		execute()					noexcept override;
+			virtual bool		hasFinished()		const	noexcept override;
+			virtual void		wait()				const	noexcept override;
+	};
+
+	/**
+	*	Task resuming a suspended coroutine on an executor once the task it awaits has finished.
+	*	The coroutine is resumed even if the awaited task was cancelled, so that it is never leaked.
+	*/
+	class CoroutineResumption final : public TaskBase
+	{
+		private:
+			/** Coroutine to resume. */
+			std::coroutine_handle<>		_coroutine;
+
+			/** Task which must finish before the coroutine is resumed. Can be nullptr. */
+			std::shared_ptr<TaskBase>	_awaitedTask;
+
+			/** Has the coroutine been resumed? */
+			std::atomic_bool			_finished	= false;
+
+		public:
+			CoroutineResumption(std::coroutine_handle<>		coroutine,
+								std::shared_ptr<TaskBase>	awaitedTask)		noexcept;
+
+			virtual bool		isReadyToExecute()	const	noexcept override;
+			virtual void		execute()					noexcept override;
+			virtual bool		hasFinished()		const	noexcept override;
+			virtual void		wait()				const	noexcept override;
+	};
+
+	/**
+	*	Part of the promise shared by all CoroutineTask types.
+	*/
+	class CoroutinePromiseBase
+	{
+		public:
+			/** Awaiter of the final suspension point, resuming the awaiting coroutine or signaling the completion. */
+			struct FinalAwaiter
+			{
+				bool						await_ready()								const	noexcept	{ return false; }
+
+				template <typename Promise>
+				std::coroutine_handle<>		await_suspend(std::coroutine_handle<Promise> coroutine)	noexcept;
+
+				void						await_resume()								const	noexcept	{}
+			};
+
+			/** Coroutine to resume when this coroutine completes, if it is awaited by another coroutine. */
+			std::coroutine_handle<>	continuation;
+
+			/** Completion to signal when this coroutine completes, if it has been submitted to an executor. */
+			CoroutineCompletion*	completion	= nullptr;
+
+			std::suspend_always	initial_suspend()		noexcept	{ return {}; }
+			FinalAwaiter		final_suspend()			noexcept	{ return {}; }
+			void				unhandled_exception()	noexcept	{ std::terminate(); }
+	};
+
+	template <typename T>
+	class CoroutinePromise : public CoroutinePromiseBase
+	{
+		private:
+			/** Value returned by the coroutine. */
+			std::optional<T>	_result;
+
+		public:
+			CoroutineTask<T>	get_return_object()			noexcept;
+
+			template <typename U>
+			void				return_value(U&& value)		noexcept;
+
+			/**
+			*	@brief Move the value returned by the coroutine out of the promise. The coroutine must have completed.
+			*
+			*	@return The value returned by the coroutine.
+			*/
+			T					takeResult()				noexcept;
+	};
+
+	template <>
+	class CoroutinePromise<void> : public CoroutinePromiseBase
+	{
+		public:
+			inline CoroutineTask<void>	get_return_object()		noexcept;
+			void						return_void()			noexcept	{}
+			void						takeResult()			noexcept	{}
+	};
+
+	/**
+	*	Return type of the coroutines run on an IExecutor.
+	*	A coroutine starts suspended. It runs when it is awaited by another coroutine with co_await,
+	*	or when it is submitted to an executor with CoroutineHelper::submitCoroutine.
+	*/
+	template <typename T = void>
+	class CoroutineTask
+	{
+		public:
+			using promise_type = CoroutinePromise<T>;
+
+		private:
+			/** Handle of the coroutine, owned by this object. */
+			std::coroutine_handle<promise_type>	_handle;
+
+		public:
+			explicit CoroutineTask(std::coroutine_handle<promise_type> handle)	noexcept;
+			CoroutineTask(CoroutineTask const&)									= delete;
+			CoroutineTask(CoroutineTask&& other)								noexcept;
+			~CoroutineTask()													noexcept;
+
+			/**
+			*	@brief Getter for _handle field.
+			*
+			*	@return _handle.
+			*/
+			std::coroutine_handle<promise_type>	getHandle()							const	noexcept;
+
+			bool								await_ready()						const	noexcept;
+			std::coroutine_handle<>				await_suspend(std::coroutine_handle<> awaitingCoroutine)	noexcept;
+			T									await_resume()								noexcept;
+
+			CoroutineTask& operator=(CoroutineTask const&)	= delete;
+			CoroutineTask& operator=(CoroutineTask&&)		= delete;
+	};
+
+	class CoroutineHelper
+	{
+		public:
+			/** Awaitable resuming the awaiting coroutine on an executor. */
+			struct ScheduleAwaitable
+			{
+				IExecutor&		executor;
+				ETaskPriority	priority;
+
+				bool	await_ready()									const	noexcept	{ return false; }
+				void	await_suspend(std::coroutine_handle<> coroutine)	const	noexcept;
+				void	await_resume()									const	noexcept	{}
+			};
+
+			/** Awaitable resuming the awaiting coroutine on an executor once a task has finished, without blocking any thread. */
+			struct TaskAwaitable
+			{
+				IExecutor&					executor;
+				std::shared_ptr<TaskBase>	task;
+
+				bool	await_ready()									const	noexcept;
+				void	await_suspend(std::coroutine_handle<> coroutine)	const	noexcept;
+				bool	await_resume()									const	noexcept;
+			};
+
+			/** TaskAwaitable returning the result of the awaited task. */
+			template <typename ResultType>
+			struct TaskResultAwaitable : public TaskAwaitable
+			{
+				ResultType	await_resume()	const	noexcept;
+			};
+
+			CoroutineHelper()	= delete;
+			~CoroutineHelper()	= delete;
+
+			/**
+			*	@brief	Suspend the awaiting coroutine and resume it on a worker of the executor.
+			*			A coroutine submitted with submitCoroutine already runs on the executor,
+			*			but a coroutine resumed by an external event (I/O completion...) can await it to go back to the executor.
+			*
+			*	@param executor Executor to resume the coroutine on.
+			*	@param priority Priority of the resumption among the ready tasks of the executor.
+			*
+			*	@return The awaitable.
+			*/
+			static ScheduleAwaitable					schedule(IExecutor&		executor,
+																 ETaskPriority	priority = ETaskPriority::Normal)			noexcept;
+
+			/**
+			*	@brief	Suspend the awaiting coroutine until a task has finished, then resume it on a worker of the executor.
+			*			co_await returns false if the task was cancelled, else true.
+			*
+			*	@param executor	Executor to resume the coroutine on.
+			*	@param task		Task to wait for. It can be a task of the executor or a CoroutineCompletion.
+			*
+			*	@return The awaitable.
+			*/
+			static TaskAwaitable						awaitTask(IExecutor&				executor,
+																  std::shared_ptr<TaskBase>	task)						noexcept;
+
+			/**
+			*	@brief	Suspend the awaiting coroutine until a task has finished, then resume it on a worker of the executor.
+			*			co_await returns the result of the task, which must not be cancelled (see TaskHelper::getResult).
+			*
+			*	@param executor	Executor to resume the coroutine on.
+			*	@param task		Task to wait for. It must be a Task<ResultType>.
+			*
+			*	@return The awaitable.
+			*/
+			template <typename ResultType>
+			static TaskResultAwaitable<ResultType>		awaitResult(IExecutor&					executor,
+																	std::shared_ptr<TaskBase>	task)					noexcept;
+
+			/**
+			*	@brief	Run a coroutine on an executor.
+			*			The returned task finishes once the coroutine has completed, so it can be used as a dependency of other tasks,
+			*			waited with IExecutor::waitTask, and its result can be retrieved with TaskHelper::getResult<T>.
+			*
+			*	@param executor		Executor to run the coroutine on.
+			*	@param taskName		Name of the task.
+			*	@param coroutine	Coroutine to run. It must not have been started.
+			*	@param priority		Priority of the coroutine tasks among the ready tasks of the executor.
+			*
+			*	@return The task holding the result of the coroutine.
+			*/
+			template <typename T>
+			static std::shared_ptr<TaskBase>			submitCoroutine(IExecutor&			executor,
+																		std::string const&	taskName,
+																		CoroutineTask<T>&&	coroutine,
+																		ETaskPriority		priority = ETaskPriority::Normal)	noexcept;
+	};
+
+	#include "Kodgen/Threading/Coroutine.inl"
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Promise>
+std::coroutine_handle<> CoroutinePromiseBase::FinalAwaiter::await_suspend(std::coroutine_handle<Promise> coroutine) noexcept
+{
+	//Read the promise before signaling the completion, since the coroutine can be destroyed as soon as it is signaled
+	std::coroutine_handle<>	continuation	= coroutine.promise().continuation;
+	CoroutineCompletion*	completion		= coroutine.promise().completion;
+
+	if (completion != nullptr)
+	{
+		completion->finish();
+	}
+
+	return (continuation) ? continuation : std::noop_coroutine();
+}
+
+template <typename T>
+CoroutineTask<T> CoroutinePromise<T>::get_return_object() noexcept
+{
+	return CoroutineTask<T>(std::coroutine_handle<CoroutinePromise<T>>::from_promise(*this));
+}
+
+template <typename T>
+template <typename U>
+void CoroutinePromise<T>::return_value(U&& value) noexcept
+{
+	_result.emplace(std::forward<U>(value));
+}
+
+template <typename T>
+T CoroutinePromise<T>::takeResult() noexcept
+{
+	return std::move(*_result);
+}
+
+inline CoroutineTask<void> CoroutinePromise<void>::get_return_object() noexcept
+{
+	return CoroutineTask<void>(std::coroutine_handle<CoroutinePromise<void>>::from_promise(*this));
+}
+
+template <typename T>
+CoroutineTask<T>::CoroutineTask(std::coroutine_handle<promise_type> handle) noexcept:
+	_handle{handle}
+{
+}
+
+template <typename T>
+CoroutineTask<T>::CoroutineTask(CoroutineTask&& other) noexcept:
+	_handle{other._handle}
+{
+	other._handle = nullptr;
+}
+
+template <typename T>
+CoroutineTask<T>::~CoroutineTask() noexcept
+{
+	if (_handle)
+	{
+		_handle.destroy();
+	}
+}
+
+template <typename T>
+std::coroutine_handle<typename CoroutineTask<T>::promise_type> CoroutineTask<T>::getHandle() const noexcept
+{
+	return _handle;
+}
+
+template <typename T>
+bool CoroutineTask<T>::await_ready() const noexcept
+{
+	return false;
+}
+
+template <typename T>
+std::coroutine_handle<> CoroutineTask<T>::await_suspend(std::coroutine_handle<> awaitingCoroutine) noexcept
+{
+	//Start this coroutine on the current thread, the awaiting coroutine is resumed when it completes
+	_handle.promise().continuation = awaitingCoroutine;
+
+	return _handle;
+}
+
+template <typename T>
+T CoroutineTask<T>::await_resume() noexcept
+{
+	return _handle.promise().takeResult();
+}
+
+template <typename ResultType>
+ResultType CoroutineHelper::TaskResultAwaitable<ResultType>::await_resume() const noexcept
+{
+	return TaskHelper::getResult<ResultType>(task.get());
+}
+
+template <typename ResultType>
+CoroutineHelper::TaskResultAwaitable<ResultType> CoroutineHelper::awaitResult(IExecutor& executor, std::shared_ptr<TaskBase> task) noexcept
+{
+	return TaskResultAwaitable<ResultType>{ { executor, std::move(task) } };
+}
+
+template <typename T>
+std::shared_ptr<TaskBase> CoroutineHelper::submitCoroutine(IExecutor& executor, std::string const& taskName, CoroutineTask<T>&& coroutine, ETaskPriority priority) noexcept
+{
+	std::shared_ptr<CoroutineCompletion>	completion			= std::make_shared<CoroutineCompletion>();
+	std::shared_ptr<CoroutineTask<T>>		ownedCoroutine		= std::make_shared<CoroutineTask<T>>(std::move(coroutine));
+	std::coroutine_handle<>					coroutineHandle		= ownedCoroutine->getHandle();
+
+	ownedCoroutine->getHandle().promise().completion = completion.get();
+
+	//The result task owns the coroutine and the completion until the result is retrieved
+	std::shared_ptr<TaskBase> resultTask = executor.submitTask(taskName, [ownedCoroutine](TaskBase*)
+	{
+		return ownedCoroutine->getHandle().promise().takeResult();
+	}, { std::move(completion) }, CancellationToken(), priority);
+
+	//Start the coroutine
+	executor.enqueueTask(std::make_shared<CoroutineResumption>(coroutineHandle, nullptr), priority);
+
+	return resultTask;
+}
\ No newline at end of file
@@ -0,0 +1,25 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	enum class ETaskPriority : uint8
+	{
+		/** Task picked after the ready tasks of higher priority, unless it has been waiting for long. */
+		Low		= 0,
+
+		/** Default priority of submitted tasks. */
+		Normal	= 1,
+
+		/** Task picked before the ready tasks of lower priority. */
+		High	= 2
+	};
+}
\ No newline at end of file
@@ -0,0 +1,128 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>		//std::shared_ptr
+#include <algorithm>	//std::max
+#include <type_traits>	//std::invoke_result
+
+#include "Kodgen/Threading/Task.h"
+#include "Kodgen/Threading/BatchTask.h"
+#include "Kodgen/Threading/CancellationToken.h"
+#include "Kodgen/Threading/ETaskPriority.h"
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Interface of the objects executing tasks. ThreadPool is the default implementation.
+	*	An executor can be shared by several CodeGenManagers and by any other code submitting tasks,
+	*	or implemented on top of an existing task runtime.
+	*/
+	class IExecutor
+	{
+		public:
+			IExecutor()					= default;
+			IExecutor(IExecutor const&)	= default;
+			IExecutor(IExecutor&&)		= default;
+			virtual ~IExecutor()		= default;
+
+			/**
+			*	@brief Submit a task to the executor.
+			*	
+			*	@param taskName				Name of the task to submit to the executor.
+			*	@param callable				Callable the submitted task should execute. It must take a TaskBase* as parameter.
+			*	@param deps					Dependencies of the submitted task.
+			*	@param cancellationToken	Token of the submitted task. If it is cancelled before the task is executed,
+			*								the task is skipped, and so are the tasks depending on it.
+			*	@param priority				Priority of the submitted task among the ready tasks of the executor.
+			*
+			*	@return A pointer to the submitted task. It can be used as a dependency when submitting other tasks.
+			*/
+			template <typename Callable, typename = decltype(std::declval<Callable>()(std::declval<TaskBase*>()))>
+			std::shared_ptr<TaskBase>	submitTask(std::string const&						taskName,
+												   Callable&&								callable,
+												   std::vector<std::shared_ptr<TaskBase>>&& deps				= {},
+												   CancellationToken						cancellationToken	= CancellationToken(),
+												   ETaskPriority							priority			= ETaskPriority::Normal)	noexcept;
+
+			/**
+			*	@brief	Submit a batch calling a callable on each index of [0, count[. The whole batch is a single task which
+			*			is executed by up to getWorkerCount() workers at the same time, each claiming chunks of indices.
+			*			It avoids the task, future and callable allocated by submitTask for each small work item.
+			*			The values returned by the callable are stored in the batch, see TaskHelper::getBatchResults.
+			*
+			*	@param taskName				Name of the batch to submit to the executor.
+			*	@param count				Number of indices of the batch.
+			*	@param callable				Callable called on each index. It must take a uint64 index and a TaskBase* as parameters.
+			*								It can be called concurrently on different indices.
+			*	@param deps					Dependencies of the submitted batch.
+			*	@param cancellationToken	Token of the submitted batch. Once it is cancelled, remaining indices are skipped
+			*								and the batch is reported as cancelled.
+			*	@param priority				Priority of the submitted batch among the ready tasks of the executor.
+			*	@param chunkSize			Number of indices claimed at once by a worker. If 0, it is deduced from count and the worker count.
+			*
+			*	@return A pointer to the submitted batch. It can be used as a dependency when submitting other tasks.
+			*/
+			template <typename Callable, typename = decltype(std::declval<Callable>()(std::declval<uint64>(), std::declval<TaskBase*>()))>
+			std::shared_ptr<TaskBase>	submitBatch(std::string const&							taskName,
+													uint64										count,
+													Callable&&									callable,
+													std::vector<std::shared_ptr<TaskBase>>&&	deps				= {},
+													CancellationToken							cancellationToken	= CancellationToken(),
+													ETaskPriority								priority			= ETaskPriority::Normal,
+													uint64										chunkSize			= 0u)			noexcept;
+
+			/**
+			*	@brief	Call a callable on each index of [0, count[ using the workers of the executor, and wait until all indices are processed.
+			*			Can be called from a task executed by this executor.
+			*
+			*	@param count		Number of indices.
+			*	@param callable		Callable called on each index. It must take a uint64 index and a TaskBase* as parameters.
+			*	@param priority		Priority of the batch among the ready tasks of the executor.
+			*
+			*	@return The values returned for each index, or nothing if the callable returns void.
+			*/
+			template <typename Callable, typename = decltype(std::declval<Callable>()(std::declval<uint64>(), std::declval<TaskBase*>()))>
+			auto						parallelFor(uint64			count,
+													Callable&&		callable,
+													ETaskPriority	priority = ETaskPriority::Normal)											noexcept;
+
+			/**
+			*	@brief	Queue a task for execution. This method must be thread-safe.
+			*			The task must only be executed once TaskBase::isReadyToExecute returns true.
+			*
+			*	@param task		Task to execute.
+			*	@param priority	Priority of the task among the ready tasks of the executor.
+			*/
+			virtual void				enqueueTask(std::shared_ptr<TaskBase>	task,
+													ETaskPriority				priority)									noexcept = 0;
+
+			/**
+			*	@brief	Wait until a task submitted to this executor has finished.
+			*			It must be safe to call this method from a task executed by this executor.
+			*
+			*	@param task Task to wait for.
+			*/
+			virtual void				waitTask(TaskBase const& task)														noexcept = 0;
+
+			/**
+			*	@brief Get the number of tasks this executor can execute concurrently.
+			*
+			*	@return The number of workers of the executor.
+			*/
+			virtual uint32				getWorkerCount()															const	noexcept = 0;
+
+			IExecutor& operator=(IExecutor const&)	= default;
+			IExecutor& operator=(IExecutor&&)		= default;
+	};
+
+	#include "Kodgen/Threading/IExecutor.inl"
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+template <typename Callable, typename>
+std::shared_ptr<TaskBase> IExecutor::submitTask(std::string const& taskName, Callable&& callable, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken, ETaskPriority priority) noexcept
+{
+	//Return type of the submitted task
+	using ReturnType = typename std::invoke_result_t<Callable, TaskBase*>;
+
+	std::shared_ptr<Task<ReturnType>> newTask =
+		std::make_shared<Task<ReturnType>>(taskName.data(), std::forward<Callable>(callable), std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps), std::move(cancellationToken));
+
+	enqueueTask(newTask, priority);
+
+	return newTask;
+}
+
+template <typename Callable, typename>
+std::shared_ptr<TaskBase> IExecutor::submitBatch(std::string const& taskName, uint64 count, Callable&& callable, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken, ETaskPriority priority, uint64 chunkSize) noexcept
+{
+	//Return type of the callable for each index
+	using ReturnType	= typename std::invoke_result_t<Callable, uint64, TaskBase*>;
+	using BatchType		= BatchTask<ReturnType, std::decay_t<Callable>>;
+
+	//An executor reporting no worker still executes the batch, on at least one thread
+	uint64 workerCount = std::max<uint64>(getWorkerCount(), 1u);
+
+	//Several chunks per worker balance the load when indices have different costs
+	if (chunkSize == 0u)
+	{
+		chunkSize = count / (workerCount * 4u);
+	}
+
+	std::shared_ptr<BatchType> newBatch =
+		std::make_shared<BatchType>(taskName.data(), count, chunkSize, std::decay_t<Callable>(std::forward<Callable>(callable)), std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps), std::move(cancellationToken));
+
+	//Each queued copy lets one more worker claim chunks of the batch
+	for (uint64 i = newBatch->getParallelism(workerCount); i > 0u; i--)
+	{
+		enqueueTask(newBatch, priority);
+	}
+
+	return newBatch;
+}
+
+template <typename Callable, typename>
+auto IExecutor::parallelFor(uint64 count, Callable&& callable, ETaskPriority priority) noexcept
+{
+	//Return type of the callable for each index
+	using ReturnType = typename std::invoke_result_t<Callable, uint64, TaskBase*>;
+
+	std::shared_ptr<TaskBase> batch = submitBatch("Parallel for", count, std::forward<Callable>(callable), {}, CancellationToken(), priority);
+
+	waitTask(*batch);
+
+	if constexpr (!std::is_void_v<ReturnType>)
+	{
+		return static_cast<BatchTaskResults<ReturnType>*>(batch.get())->takeResults();
+	}
+}
\ No newline at end of file
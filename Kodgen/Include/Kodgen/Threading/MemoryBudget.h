@@ -0,0 +1,156 @@
+/**
+*	Copyright (c) 2021 Julien SOYSOUVANH - All Rights Reserved
+*
+*	This file is part of the Kodgen library project which is released under the MIT License.
+*	See the LICENSE.md file for full license details.
+*/
+
+#pragma once
+
+#include <list>
+#include <mutex>
+#include <memory>		//std::shared_ptr
+#include <functional>	//std::function
+
+#include "Kodgen/Misc/FundamentalTypes.h"
+
+namespace kodgen
+{
+	/**
+	*	Admission control limiting the memory used by concurrent work, such as translation units parsed at the same time.
+	*	Work is admitted while the admitted amounts fit in the budget. Work larger than the whole budget is admitted alone,
+	*	so that everything is processed eventually.
+	*	Admission never blocks: work which doesn't fit waits in the budget and is started by the thread releasing enough memory.
+	*/
+	class MemoryBudget
+	{
+		public:
+			/**
+			*	Memory admitted by a budget. It is given back to the budget by release, or when the admission is destroyed,
+			*	so that work dropped without being executed doesn't keep its memory.
+			*/
+			class Admission
+			{
+				friend class MemoryBudget;
+
+				private:
+					/** Budget the memory was admitted by, nullptr if the admission holds no memory. */
+					MemoryBudget*	_budget	= nullptr;
+
+					/** Admitted memory, in bytes. */
+					uint64			_amount	= 0u;
+
+				public:
+					Admission()							= default;
+					Admission(Admission const&)			= delete;
+					Admission(Admission&&)				= delete;
+					~Admission()						noexcept;
+
+					/**
+					*	@brief Give the admitted memory back to the budget. Does nothing if the memory was already released or not admitted yet.
+					*/
+					void	release()					noexcept;
+
+					/**
+					*	@brief Getter for _amount field.
+					*
+					*	@return _amount.
+					*/
+					uint64	getAmount()			const	noexcept;
+
+					Admission& operator=(Admission const&)	= delete;
+					Admission& operator=(Admission&&)		= delete;
+			};
+
+		private:
+			/** Work waiting for enough memory to be released. */
+			struct PendingAdmission
+			{
+				/** Admission receiving the memory. */
+				std::shared_ptr<Admission>	admission;
+
+				/** Memory to admit, in bytes. */
+				uint64						amount;
+
+				/** Function starting the work once the memory is admitted. */
+				std::function<void()>		onAdmitted;
+			};
+
+			/** Memory which can be admitted at the same time, in bytes. 0 if unlimited. */
+			uint64						_capacity			= 0u;
+
+			/** Memory currently admitted, in bytes. */
+			uint64						_admitted			= 0u;
+
+			/** Work waiting for memory, in admission order. */
+			std::list<PendingAdmission>	_pendingAdmissions;
+
+			/** Mutex used to synchronize the admitted memory and the pending admissions. */
+			std::mutex					_mutex;
+
+			/**
+			*	@brief Check whether an amount of memory can be admitted now. _mutex must be locked.
+			*
+			*	@param amount Memory to admit, clamped to the capacity.
+			*
+			*	@return true if the amount fits in the budget, else false.
+			*/
+			bool	fits(uint64 amount)									const	noexcept;
+
+			/**
+			*	@brief	Give memory back to the budget, and start the pending work which now fits.
+			*
+			*	@param amount Amount to give back.
+			*/
+			void	release(uint64 amount)										noexcept;
+
+		public:
+			MemoryBudget()								= default;
+
+			/**
+			*	@param capacity Memory which can be admitted at the same time, in bytes. 0 if unlimited.
+			*/
+			explicit MemoryBudget(uint64 capacity)		noexcept;
+			MemoryBudget(MemoryBudget const&)			= delete;
+			MemoryBudget(MemoryBudget&&)				= delete;
+
+			/**
+			*	@brief	Admit an amount of memory as soon as it fits in the budget, then call onAdmitted.
+			*			onAdmitted is called before this method returns if the amount fits now,
+			*			else by the thread releasing enough memory, so it should only start the work (for example submit a task).
+			*
+			*	@param admission	Admission receiving the memory. It must not hold memory already.
+			*	@param amount		Memory to admit, in bytes. It is clamped to the capacity.
+			*	@param onAdmitted	Function called once the memory is admitted.
+			*/
+			void	admit(std::shared_ptr<Admission> const&	admission,
+						  uint64							amount,
+						  std::function<void()>&&			onAdmitted)			noexcept;
+
+			/**
+			*	@brief	Setter for _capacity field. Must not be called while memory is admitted.
+			*
+			*	@param capacity Memory which can be admitted at the same time, in bytes. 0 if unlimited.
+			*/
+			void	setCapacity(uint64 capacity)								noexcept;
+
+			/**
+			*	@brief Getter for _capacity field.
+			*
+			*	@return _capacity.
+			*/
+			uint64	getCapacity()										const	noexcept;
+
+			/**
+			*	@brief	Get the budget shared by all the users of the process which have no explicit budget,
+			*			so that they don't exceed the cgroup memory limit together.
+			*			Its capacity is 3/4 of the memory left by the cgroup memory limit when it is first used, or unlimited if there is no limit.
+			*
+			*	@return The process memory budget.
+			*/
+			static MemoryBudget&	getProcessBudget()							noexcept;
+
+			MemoryBudget& operator=(MemoryBudget const&)	= delete;
+			MemoryBudget& operator=(MemoryBudget&&)			= delete;
+	};
+}
\ No newline at end of file
@@ -35,11 +35,13 @@ namespace kodgen
 			Task()														= delete;
 			Task(char const*								name,
 				 std::function<ReturnType(TaskBase*)>&&		task,
-				 std::vector<std::shared_ptr<TaskBase>>&&	deps = {})	noexcept;
+				 std::vector<std::shared_ptr<TaskBase>>&&	deps				= {},
+				 CancellationToken							cancellationToken	= CancellationToken())	noexcept;
 
 			virtual bool				isReadyToExecute()	const	noexcept override;
 			virtual void				execute()					noexcept override;
 			virtual bool				hasFinished()		const	noexcept override;
+			virtual void				wait()				const	noexcept override;
 	};
 
 	#include "Kodgen/Threading/Task.inl"
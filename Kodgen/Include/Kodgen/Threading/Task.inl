@@ -6,8 +6,8 @@
 */
 
 template <typename ReturnType>
-Task<ReturnType>::Task(char const* name, std::function<ReturnType(TaskBase*)>&& task, std::vector<std::shared_ptr<TaskBase>>&& deps) noexcept:
-	TaskBase(name, std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps)),
+Task<ReturnType>::Task(char const* name, std::function<ReturnType(TaskBase*)>&& task, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken) noexcept:
+	TaskBase(name, std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps), std::move(cancellationToken)),
 	_task{std::forward<std::function<ReturnType(TaskBase*)>>(task)},
 	_result{_task.get_future()}
 {
@@ -31,11 +31,30 @@ bool Task<ReturnType>::isReadyToExecute() const noexcept
 template <typename ReturnType>
 void Task<ReturnType>::execute() noexcept
 {
-	_task(this);
+	if (shouldSkip())
+	{
+		cancelled = true;
+
+		//Releasing the underlying task without calling it makes the result ready, so that dependent tasks are not blocked
+		_task = std::packaged_task<ReturnType(TaskBase*)>();
+	}
+	else
+	{
+		_task(this);
+	}
 }
 
 template <typename ReturnType>
 bool Task<ReturnType>::hasFinished() const noexcept
 {
 	return !_result.valid() || _result.wait_for(std::chrono::nanoseconds(0)) == std::future_status::ready;
+}
+
+template <typename ReturnType>
+void Task<ReturnType>::wait() const noexcept
+{
+	if (_result.valid())
+	{
+		_result.wait();
+	}
 }
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include <string>
 #include <memory>	//std::shared_ptr
 
+#include "Kodgen/Threading/CancellationToken.h"
+
 namespace kodgen
 {
 	class TaskBase
@@ -19,16 +21,31 @@ namespace kodgen
 
 		private:
 			/** Name of the task. */
-			std::string	_name;
+			std::string			_name;
+
+			/** Token checked before the task is executed. A cancelled task is skipped. */
+			CancellationToken	_cancellationToken;
 
 		protected:
 			/** Dependent tasks which must terminate before this task is executed. */
 			std::vector<std::shared_ptr<TaskBase>>	dependencies;
 
+			/** Set when the task is skipped because it was cancelled. Only valid once the task has finished. */
+			bool									cancelled	= false;
+
+			/**
+			*	@brief	Check if this task must be skipped instead of executed:
+			*			its token is cancelled, or one of its dependencies was skipped.
+			*
+			*	@return true if the task must be skipped, else false.
+			*/
+			bool				shouldSkip()		const	noexcept;
+
 		public:
 			TaskBase()														= delete;
 			TaskBase(char const*								name,
-					 std::vector<std::shared_ptr<TaskBase>>&&	deps = {})	noexcept;
+					 std::vector<std::shared_ptr<TaskBase>>&&	deps				= {},
+					 CancellationToken							cancellationToken	= CancellationToken())	noexcept;
 			TaskBase(TaskBase const&)										= default;
 			TaskBase(TaskBase&&)											= default;
 			virtual ~TaskBase()												= default;
@@ -53,6 +70,28 @@ namespace kodgen
 			*/
 			virtual bool		hasFinished()		const	noexcept = 0;
 
+			/**
+			*	@brief Block the calling thread until this task has finished executing.
+			*/
+			virtual void		wait()				const	noexcept = 0;
+
+			/**
+			*	@brief	Check whether the token of this task has been cancelled.
+			*			Long tasks can call it while executing to stop early.
+			* 
+			*	@return true if cancellation has been requested, else false.
+			*/
+			bool				isCancellationRequested()	const	noexcept;
+
+			/**
+			*	@brief	Check whether this task was skipped because it was cancelled before being executed.
+			*			The result of a skipped task must not be retrieved.
+			*			Must only be called once the task has finished.
+			* 
+			*	@return true if the task was skipped, else false.
+			*/
+			bool				wasCancelled()		const	noexcept;
+
 			/**
 			*	@brief Getter for _name field.
 			* 
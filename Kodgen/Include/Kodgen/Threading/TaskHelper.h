@@ -11,6 +11,7 @@
 #include <cassert>
 
 #include "Kodgen/Threading/Task.h"
+#include "Kodgen/Threading/BatchTask.h"
 
 namespace kodgen
 {
@@ -21,7 +22,8 @@ namespace kodgen
 			~TaskHelper() = delete;
 
 			/**
-			*	@brief Retrieve the result from a TaskBase object
+			*	@brief	Retrieve the result from a TaskBase object.
+			*			The task must not have been cancelled (see TaskBase::wasCancelled).
 			*	
 			*	@param task The task we get the result from.
 			*
@@ -44,6 +46,18 @@ namespace kodgen
 			*/
 			template <typename ResultType, typename = typename std::enable_if_t<!std::is_same_v<ResultType, void>>>
 			static ResultType getDependencyResult(TaskBase* task, size_t dependencyIndex);
+
+			/**
+			*	@brief	Retrieve the results from a batch task submitted with IExecutor::submitBatch.
+			*			The batch must have finished and must not have been cancelled (see TaskBase::wasCancelled).
+			*			Results are moved out of the batch, so they can only be retrieved once.
+			*
+			*	@param task The batch task we get the results from.
+			*
+			*	@return The value returned for each index of the batch.
+			*/
+			template <typename ResultType, typename = typename std::enable_if_t<!std::is_same_v<ResultType, void>>>
+			static std::vector<ResultType> getBatchResults(TaskBase* task);
 	};
 
 	#include "Kodgen/Threading/TaskHelper.inl"
@@ -20,4 +20,13 @@ ResultType TaskHelper::getDependencyResult(TaskBase* task, size_t dependencyInde
 	assert(task != nullptr);
 
 	return TaskHelper::getResult<ResultType>(task->dependencies.at(dependencyIndex).get());
+}
+
+template <typename ResultType, typename>
+std::vector<ResultType> TaskHelper::getBatchResults(TaskBase* task)
+{
+	assert(task != nullptr);
+	assert(task->hasFinished() && !task->wasCancelled());
+
+	return static_cast<BatchTaskResults<ResultType>*>(task)->takeResults();
 }
\ No newline at end of file
@@ -10,31 +10,60 @@
 #include <string>
 #include <list>
 #include <vector>
+#include <array>
 #include <thread>
 #include <condition_variable>
 #include <mutex>
 #include <atomic>		//std::atomic_uint
+#include <chrono>		//std::chrono::milliseconds
 #include <functional>	//std::bind
 #include <memory>		//std::shared_ptr
-#include <type_traits>	//std::invoke_result
 
-#include "Kodgen/Threading/Task.h"
+#include "Kodgen/Threading/IExecutor.h"
 #include "Kodgen/Threading/ETerminationMode.h"
 #include "Kodgen/Misc/FundamentalTypes.h"
 
 namespace kodgen
 {
-	class ThreadPool
+	class ThreadPool : public IExecutor
 	{
 		private:
+			/** Task waiting in the pool to be picked by a worker. */
+			struct QueuedTask
+			{
+				/** The task itself. */
+				std::shared_ptr<TaskBase>	task;
+
+				/** Priority of the task. */
+				ETaskPriority				priority;
+
+				/** Value of _pickedTaskCount when the task was submitted. */
+				uint64						submissionIndex;
+			};
+
+			/**
+			*	Number of picked tasks a queued task must wait for to gain one priority level.
+			*	It bounds how long a ready task can be overtaken by tasks of higher priority, so that low priority tasks are never starved.
+			*/
+			static constexpr uint64					_agingStep	= 64u;
+
+			/** Maximum duration a worker waits for a queued task to become ready before checking the queued tasks again. */
+			static constexpr std::chrono::milliseconds	_readinessCheckPeriod	= std::chrono::milliseconds(10);
+
 			/** Are workers allowed to process queued tasks? */
 			bool									_isRunning	= true;
 
 			/** Collection of all workers in this pool. */
 			std::vector<std::thread>				_workers;
 
-			/** List of all tasks. */
-			std::list<std::shared_ptr<TaskBase>>	_tasks;
+			/** List of all tasks, in submission order. */
+			std::list<QueuedTask>					_tasks;
+
+			/** Number of tasks picked by workers since the pool was created. */
+			uint64									_pickedTaskCount	= 0u;
+
+			/** Number of queued tasks of each priority. */
+			std::array<uint64, 3u>					_queuedTaskCounts	= {};
 
 			/** Set to true when the ThreadPool destructor has been called. */
 			bool									_destructorCalled	= false;
@@ -53,8 +82,16 @@ namespace kodgen
 			*/
 			void						workerRoutine()				noexcept;
 
+			/**
+			*	@brief	Wake up workers waiting for a queued task to become ready, since a task just finished.
+			*			This method doesn't lock the task mutex so make sure _tasks is safe to access BEFORE the method is called.
+			*/
+			void						notifyTaskFinished()		noexcept;
+
 			/**
 			*	@brief	Retrieve a task which is ready to execute.
+			*			The ready task with the highest priority is picked, the oldest one first for equal priorities.
+			*			The priority of a task increases by one level every _agingStep picked tasks while it waits in the pool.
 			*			This method doesn't lock the task mutex so make sure _tasks is safe to access BEFORE the method is called.
 			*	
 			*	@return A valid shared_ptr pointing to a ready-to-execute task if any, else an empty shared_ptr.
@@ -79,18 +116,29 @@ namespace kodgen
 			~ThreadPool()																		noexcept;
 
 			/**
-			*	@brief Submit a task to the thread pool.
-			*	
-			*	@param taskName	Name of the task to submit to the thread pool.
-			*	@param callable	Callable the submitted task should execute. It must take a TaskBase* as parameter.
-			*	@param deps		Dependencies of the submitted task.
+			*	@brief Queue a task for execution by the workers of the pool. This method is thread-safe.
+			*
+			*	@param task		Task to execute.
+			*	@param priority	Priority of the task among the ready tasks of the pool.
+			*/
+			virtual void				enqueueTask(std::shared_ptr<TaskBase>	task,
+													ETaskPriority				priority)				noexcept override;
+
+			/**
+			*	@brief	Wait until a task submitted to this pool has finished.
+			*			When called from a worker of the pool, the worker executes the other ready tasks of the pool while waiting,
+			*			so that tasks waiting for other tasks can't exhaust the workers.
 			*
-			*	@return A pointer to the submitted task. It can be used as a dependency when submitting other tasks.
+			*	@param task Task to wait for.
 			*/
-			template <typename Callable, typename = decltype(std::declval<Callable>()(std::declval<TaskBase*>()))>
-			std::shared_ptr<TaskBase>	submitTask(std::string const&						taskName,
-												   Callable&&								callable,
-												   std::vector<std::shared_ptr<TaskBase>>&& deps = {})	noexcept;
+			virtual void				waitTask(TaskBase const& task)									noexcept override;
+
+			/**
+			*	@brief Get the number of threads of the pool.
+			*
+			*	@return The number of workers of the pool.
+			*/
+			virtual uint32				getWorkerCount()										const	noexcept override;
 
 			/**
 			*	@brief Join all workers.
@@ -107,6 +155,4 @@ namespace kodgen
 			ThreadPool& operator=(ThreadPool const&)	= delete;
 			ThreadPool& operator=(ThreadPool&&)			= delete;
 	};
-
-	#include "Kodgen/Threading/ThreadPool.inl"
 }
\ No newline at end of file
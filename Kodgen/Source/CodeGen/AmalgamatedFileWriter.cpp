@@ -0,0 +1,123 @@
+#include "Kodgen/CodeGen/AmalgamatedFileWriter.h"
+
+#include <fstream>
+
+#include "Kodgen/CodeGen/GeneratedFile.h"
+
+using namespace kodgen;
+
+void AmalgamatedFileWriter::addFragment(fs::path const& amalgamationFile, fs::path const& sourceFile, std::string&& code) noexcept
+{
+	std::string fragmentName = getFragmentName(amalgamationFile, sourceFile);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_amalgamations[amalgamationFile].fragments[std::move(fragmentName)] = std::move(code);
+}
+
+void AmalgamatedFileWriter::removeFragment(fs::path const& amalgamationFile, fs::path const& sourceFile) noexcept
+{
+	std::string fragmentName = getFragmentName(amalgamationFile, sourceFile);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_amalgamations[amalgamationFile].removedFragments.emplace(std::move(fragmentName));
+}
+
+bool AmalgamatedFileWriter::writeFiles(ILogger* logger) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	bool result = true;
+
+	for (auto& [amalgamationFile, amalgamation] : _amalgamations)
+	{
+		//Keep the fragments of the files that have not been regenerated during this run
+		loadExistingFragments(amalgamationFile, amalgamation);
+
+		writeAmalgamationFile(amalgamationFile, amalgamation.fragments);
+
+		if (!fs::exists(amalgamationFile))
+		{
+			if (logger != nullptr)
+			{
+				logger->log("Failed to write amalgamation file " + amalgamationFile.string() + ".", ILogger::ELogSeverity::Error);
+			}
+
+			result = false;
+		}
+	}
+
+	return result;
+}
+
+void AmalgamatedFileWriter::clear() noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_amalgamations.clear();
+}
+
+std::string AmalgamatedFileWriter::getFragmentName(fs::path const& amalgamationFile, fs::path const& sourceFile) noexcept
+{
+	return FilesystemHelpers::normalizeSeparator(sourceFile.lexically_relative(amalgamationFile.parent_path())).string();
+}
+
+void AmalgamatedFileWriter::loadExistingFragments(fs::path const& amalgamationFile, Amalgamation& inout_amalgamation) noexcept
+{
+	std::ifstream	stream(amalgamationFile);
+	std::string		line;
+	std::string		sourceFile;
+	std::string		code;
+	bool			isInFragment	= false;
+	bool			isFirstLine		= false;
+
+	while (std::getline(stream, line))
+	{
+		if (!isInFragment)
+		{
+			if (line.rfind(_fragmentBeginMarker, 0u) == 0u)
+			{
+				sourceFile		= line.substr(std::char_traits<char>::length(_fragmentBeginMarker));
+				isInFragment	= true;
+				isFirstLine		= true;
+				code.clear();
+			}
+		}
+		else if (line == _fragmentEndMarker)
+		{
+			isInFragment = false;
+
+			//Discard fragments of removed or deleted source files, the emplace doesn't overwrite regenerated fragments
+			if (inout_amalgamation.removedFragments.find(sourceFile) == inout_amalgamation.removedFragments.cend() &&
+				fs::exists(amalgamationFile.parent_path() / sourceFile))
+			{
+				inout_amalgamation.fragments.emplace(std::move(sourceFile), std::move(code));
+			}
+		}
+		else
+		{
+			if (!isFirstLine)
+			{
+				code += '\n';
+			}
+
+			code		+= line;
+			isFirstLine	= false;
+		}
+	}
+}
+
+void AmalgamatedFileWriter::writeAmalgamationFile(fs::path const& amalgamationFile, Fragments const& fragments) noexcept
+{
+	GeneratedFile generatedFile{fs::path(amalgamationFile)};
+
+	generatedFile.writeLine("#pragma once\n");
+
+	for (auto const& [sourceFile, code] : fragments)
+	{
+		generatedFile.writeLine(_fragmentBeginMarker + sourceFile);
+		generatedFile.writeLine(code);
+		generatedFile.writeLine(std::string(_fragmentEndMarker) + "\n");
+	}
+}
\ No newline at end of file
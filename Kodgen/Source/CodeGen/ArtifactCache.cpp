@@ -0,0 +1,505 @@
+#include "Kodgen/CodeGen/ArtifactCache.h"
+
+#include <map>
+#include <algorithm>	//std::min
+#include <set>
+#include <fstream>
+#include <sstream>
+#include <iomanip>	//std::setw, std::setfill
+#include <iterator>	//std::istreambuf_iterator
+#include <random>	//std::random_device
+
+#include "Kodgen/Misc/HashHelpers.h"
+
+using namespace kodgen;
+
+bool ArtifactCache::computeFileDigest(fs::path const& file, FileDigest& out_fileDigest) noexcept
+{
+	std::ifstream stream(file, std::ios::in | std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	std::string content((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+	if (stream.bad())
+	{
+		return false;
+	}
+
+	out_fileDigest.contentHash = HashHelpers::hashString(HashHelpers::initialHash, content);
+	out_fileDigest.includeDirectives.clear();
+
+	//Directives are only recognized at the beginning of a line, with optional spaces around the #
+	for (size_t lineStart = 0u; lineStart < content.size();)
+	{
+		size_t lineEnd	= std::min(content.find('\n', lineStart), content.size());
+		size_t position	= content.find_first_not_of(" \t", lineStart);
+
+		if (position < lineEnd && content[position] == '#')
+		{
+			IncludeDirective	directive;
+			bool				isInclude = true;
+
+			position = content.find_first_not_of(" \t", position + 1u);
+
+			if (position >= lineEnd)
+			{
+				isInclude = false;
+			}
+			else if (content.compare(position, 12u, "include_next") == 0)
+			{
+				directive.isIncludeNext = true;
+				position += 12u;
+			}
+			else if (content.compare(position, 7u, "include") == 0)
+			{
+				position += 7u;
+			}
+			else if (content.compare(position, 6u, "import") == 0)
+			{
+				position += 6u;
+			}
+			else
+			{
+				isInclude = false;
+			}
+
+			position = (isInclude) ? content.find_first_not_of(" \t", position) : std::string::npos;
+
+			//Includes using a macro can't be resolved without a preprocessor
+			if (position < lineEnd && (content[position] == '"' || content[position] == '<'))
+			{
+				char	closingChar	= (content[position] == '"') ? '"' : '>';
+				size_t	nameEnd		= content.find(closingChar, position + 1u);
+
+				if (nameEnd < lineEnd)
+				{
+					directive.name		= content.substr(position + 1u, nameEnd - position - 1u);
+					directive.isQuoted	= closingChar == '"';
+
+					out_fileDigest.includeDirectives.push_back(std::move(directive));
+				}
+			}
+		}
+
+		lineStart = lineEnd + 1u;
+	}
+
+	return true;
+}
+
+std::vector<fs::path> ArtifactCache::resolveIncludeDirective(IncludeDirective const& directive, fs::path const& includingDirectory, std::vector<fs::path> const& quoteDirectories, std::vector<fs::path> const& includeDirectories) noexcept
+{
+	std::vector<fs::path> result;
+
+	//Return true when the search is over
+	auto searchDirectory = [&directive, &result](fs::path const& directory) -> bool
+	{
+		std::error_code	errorCode;
+		fs::path		candidate = (directory / directive.name).lexically_normal();
+
+		if (fs::is_regular_file(candidate, errorCode))
+		{
+			result.push_back(std::move(candidate));
+
+			//The file found by an #include_next depends on the directory of the including file,
+			//so all the candidates are kept
+			return !directive.isIncludeNext;
+		}
+
+		return false;
+	};
+
+	if (directive.isQuoted)
+	{
+		if (searchDirectory(includingDirectory))
+		{
+			return result;
+		}
+
+		for (fs::path const& directory : quoteDirectories)
+		{
+			if (searchDirectory(directory))
+			{
+				return result;
+			}
+		}
+	}
+
+	for (fs::path const& directory : includeDirectories)
+	{
+		if (searchDirectory(directory))
+		{
+			return result;
+		}
+	}
+
+	return result;
+}
+
+fs::path ArtifactCache::getArtifactPath(uint64 key) const noexcept
+{
+	std::ostringstream keyStream;
+	keyStream << std::hex << std::setw(16) << std::setfill('0') << key;
+
+	std::string keyString = keyStream.str();
+
+	//Artifacts are spread in subdirectories to keep directories small
+	return _directory / keyString.substr(0u, 2u) / (keyString + ".artifact");
+}
+
+std::string ArtifactCache::getKeyPath(fs::path const& path) const noexcept
+{
+	fs::path normalizedPath	= path.lexically_normal();
+	fs::path relativePath	= normalizedPath.lexically_relative(_rootDirectory);
+
+	//Paths outside of the root directory, like system headers, don't depend on the project location
+	if (_rootDirectory.empty() || relativePath.empty() || *relativePath.begin() == "..")
+	{
+		return FilesystemHelpers::normalizeSeparator(normalizedPath).string();
+	}
+
+	//The prefix tells paths inside the root directory apart from relative paths used as is
+	return "<root>/" + FilesystemHelpers::normalizeSeparator(relativePath).string();
+}
+
+ArtifactCache::FileDigest const* ArtifactCache::getFileDigest(fs::path const& file) noexcept
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto it = _fileDigests.find(file);
+
+		if (it != _fileDigests.cend())
+		{
+			return &it->second;
+		}
+	}
+
+	//Files are read outside of the lock, a file read by several threads at the same time keeps the first digest
+	FileDigest fileDigest;
+
+	if (!computeFileDigest(file, fileDigest))
+	{
+		return nullptr;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	//References to unordered_map elements stay valid when other elements are inserted
+	return &_fileDigests.emplace(file, std::move(fileDigest)).first->second;
+}
+
+std::vector<fs::path> ArtifactCache::getIncludedFiles(IncludeDirective const& directive, fs::path const& includingDirectory, std::vector<fs::path> const& quoteDirectories,
+													  std::vector<fs::path> const& includeDirectories, std::string const& directoriesKey) noexcept
+{
+	//Only quoted includes depend on the directory of the including file
+	std::string resolutionKey = directoriesKey + "\n" + ((directive.isQuoted) ? includingDirectory.string() : std::string()) + "\n" +
+								((directive.isIncludeNext) ? "n" : "i") + ((directive.isQuoted) ? "\"" : "<") + directive.name;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		auto it = _resolvedIncludes.find(resolutionKey);
+
+		if (it != _resolvedIncludes.cend())
+		{
+			return it->second;
+		}
+	}
+
+	std::vector<fs::path> includedFiles = resolveIncludeDirective(directive, includingDirectory, quoteDirectories, includeDirectories);
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_resolvedIncludes.emplace(std::move(resolutionKey), includedFiles);
+
+	return includedFiles;
+}
+
+opt::optional<uint64> ArtifactCache::computeKey(fs::path const& sourceFile, std::vector<char const*> const& compilationArguments, std::vector<fs::path> const& generatedFiles,
+												uint64 codeGenUnitFingerprint, fs::path const& outputDirectory) noexcept
+{
+	std::vector<fs::path>	quoteDirectories;
+	std::vector<fs::path>	includeDirectories;
+	std::vector<fs::path>	systemDirectories;
+	std::vector<fs::path>	afterDirectories;
+	std::vector<fs::path>	toVisitFiles{ sourceFile.lexically_normal() };
+	uint64					key = HashHelpers::initialHash;
+
+	key = HashHelpers::hashString(key, _header);
+	key = HashHelpers::hashValue(key, codeGenUnitFingerprint);
+
+	//Generated files usually include the source file using a path relative to the output directory
+	key = HashHelpers::hashString(key, getKeyPath(sourceFile));
+	key = HashHelpers::hashValue(key, generatedFiles.size());
+
+	for (fs::path const& generatedFile : generatedFiles)
+	{
+		key = HashHelpers::hashString(key, getKeyPath(generatedFile));
+	}
+
+	key = HashHelpers::hashValue(key, compilationArguments.size());
+
+	//Compilation arguments paths are glued to their argument (see ParsingSettings)
+	for (char const* compilationArgument : compilationArguments)
+	{
+		std::string	argument	= compilationArgument;
+		size_t		flagSize	= 0u;
+
+		if (argument.rfind("-iquote", 0u) == 0u)
+		{
+			flagSize = 7u;
+			quoteDirectories.emplace_back(argument.substr(flagSize));
+		}
+		else if (argument.rfind("-isystem", 0u) == 0u)
+		{
+			flagSize = 8u;
+			systemDirectories.emplace_back(argument.substr(flagSize));
+		}
+		else if (argument.rfind("-idirafter", 0u) == 0u)
+		{
+			flagSize = 10u;
+			afterDirectories.emplace_back(argument.substr(flagSize));
+		}
+		else if (argument.rfind("-include", 0u) == 0u || argument.rfind("-imacros", 0u) == 0u)
+		{
+			flagSize = 8u;
+			toVisitFiles.emplace_back(fs::path(argument.substr(flagSize)).lexically_normal());
+		}
+		else if (argument.rfind("-I", 0u) == 0u)
+		{
+			flagSize = 2u;
+			includeDirectories.emplace_back(argument.substr(flagSize));
+		}
+
+		//Other arguments are hashed as is
+		key = HashHelpers::hashString(key, (flagSize != 0u) ? argument.substr(0u, flagSize) + getKeyPath(argument.substr(flagSize)) : argument);
+	}
+
+	//Same search order as clang
+	includeDirectories.insert(includeDirectories.end(), systemDirectories.cbegin(), systemDirectories.cend());
+	includeDirectories.insert(includeDirectories.end(), afterDirectories.cbegin(), afterDirectories.cend());
+
+	std::string directoriesKey;
+
+	for (fs::path const& directory : quoteDirectories)
+	{
+		directoriesKey += "q" + directory.string() + "\n";
+	}
+
+	for (fs::path const& directory : includeDirectories)
+	{
+		directoriesKey += "i" + directory.string() + "\n";
+	}
+
+	fs::path normalizedOutputDirectory = outputDirectory.lexically_normal();
+
+	if (normalizedOutputDirectory.filename().empty())
+	{
+		normalizedOutputDirectory = normalizedOutputDirectory.parent_path();
+	}
+
+	//Files are sorted so that the key doesn't depend on the traversal order
+	std::set<fs::path>			visitedFiles;
+	std::map<fs::path, uint64>	includeClosure;
+
+	while (!toVisitFiles.empty())
+	{
+		fs::path file = std::move(toVisitFiles.back());
+		toVisitFiles.pop_back();
+
+		if (!visitedFiles.insert(file).second)
+		{
+			continue;
+		}
+
+		fs::path relativePath = file.lexically_relative(normalizedOutputDirectory);
+
+		if (!relativePath.empty() && *relativePath.begin() != "..")
+		{
+			continue;
+		}
+
+		FileDigest const* fileDigest = getFileDigest(file);
+
+		if (fileDigest == nullptr)
+		{
+			return opt::nullopt;
+		}
+
+		includeClosure.emplace(file, fileDigest->contentHash);
+
+		//Includes which are not found are ignored: they are either excluded by the preprocessor or generated
+		for (IncludeDirective const& directive : fileDigest->includeDirectives)
+		{
+			for (fs::path& includedFile : getIncludedFiles(directive, file.parent_path(), quoteDirectories, includeDirectories, directoriesKey))
+			{
+				toVisitFiles.push_back(std::move(includedFile));
+			}
+		}
+	}
+
+	key = HashHelpers::hashValue(key, includeClosure.size());
+
+	for (auto const& [file, contentHash] : includeClosure)
+	{
+		key = HashHelpers::hashString(key, getKeyPath(file));
+		key = HashHelpers::hashValue(key, contentHash);
+	}
+
+	return key;
+}
+
+bool ArtifactCache::restore(uint64 key, fs::path const& sourceFile, std::vector<fs::path> const& generatedFiles) const noexcept
+{
+	std::ifstream	stream(getArtifactPath(key), std::ios::in | std::ios::binary);
+	std::string		line;
+	size_t			fileCount = 0u;
+
+	//The source file is stored in the artifact to detect key collisions between source files
+	if (!std::getline(stream, line) || line != _header ||
+		!std::getline(stream, line) || line != getKeyPath(sourceFile) ||
+		!std::getline(stream, line) || !(std::istringstream(line) >> fileCount) || fileCount != generatedFiles.size())
+	{
+		return false;
+	}
+
+	//All files are read before writing any of them, so that an invalid artifact doesn't leave the generated files half updated
+	std::vector<std::string> contents(fileCount);
+
+	for (std::string& content : contents)
+	{
+		size_t contentSize = 0u;
+
+		if (!std::getline(stream, line) || !(std::istringstream(line) >> contentSize))
+		{
+			return false;
+		}
+
+		content.resize(contentSize);
+
+		if (!stream.read(content.data(), static_cast<std::streamsize>(contentSize)) || stream.get() != '\n')
+		{
+			return false;
+		}
+	}
+
+	for (size_t i = 0u; i < fileCount; i++)
+	{
+		std::error_code errorCode;
+		fs::create_directories(generatedFiles[i].parent_path(), errorCode);
+
+		std::ofstream generatedFileStream(generatedFiles[i], std::ios::out | std::ios::trunc | std::ios::binary);
+
+		if (!generatedFileStream.write(contents[i].data(), static_cast<std::streamsize>(contents[i].size())))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool ArtifactCache::publish(uint64 key, fs::path const& sourceFile, std::vector<fs::path> const& generatedFiles) const noexcept
+{
+	fs::path		artifactPath = getArtifactPath(key);
+	std::error_code	errorCode;
+
+	//Another process may have published the same artifact
+	if (fs::exists(artifactPath, errorCode))
+	{
+		return true;
+	}
+
+	fs::create_directories(artifactPath.parent_path(), errorCode);
+
+	//A random suffix makes the temporary file unique to this call, even among processes running on different machines
+	std::random_device	randomDevice;
+	fs::path			temporaryPath = artifactPath;
+
+	temporaryPath += "." + std::to_string((static_cast<uint64>(randomDevice()) << 32) | randomDevice()) + ".tmp";
+
+	bool written = true;
+
+	{
+		std::ofstream stream(temporaryPath, std::ios::out | std::ios::trunc | std::ios::binary);
+
+		if (!stream.is_open())
+		{
+			return false;
+		}
+
+		stream << _header << "\n" << getKeyPath(sourceFile) << "\n" << generatedFiles.size() << "\n";
+
+		for (fs::path const& generatedFile : generatedFiles)
+		{
+			std::ifstream generatedFileStream(generatedFile, std::ios::in | std::ios::binary);
+
+			if (!generatedFileStream.is_open())
+			{
+				written = false;
+
+				break;
+			}
+
+			std::string content((std::istreambuf_iterator<char>(generatedFileStream)), std::istreambuf_iterator<char>());
+
+			stream << content.size() << "\n";
+			stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+			stream << "\n";
+		}
+
+		stream.flush();
+		written &= stream.good();
+	}
+
+	//Renaming a file is atomic on local file systems and NFS, readers either see the complete artifact or no artifact
+	if (written)
+	{
+		fs::rename(temporaryPath, artifactPath, errorCode);
+
+		if (!errorCode)
+		{
+			return true;
+		}
+	}
+
+	fs::remove(temporaryPath, errorCode);
+
+	return false;
+}
+
+void ArtifactCache::clearFileDigests() noexcept
+{
+	_fileDigests.clear();
+	_resolvedIncludes.clear();
+}
+
+void ArtifactCache::setDirectory(fs::path const& directory) noexcept
+{
+	_directory = directory;
+}
+
+fs::path const& ArtifactCache::getDirectory() const noexcept
+{
+	return _directory;
+}
+
+void ArtifactCache::setRootDirectory(fs::path const& rootDirectory) noexcept
+{
+	_rootDirectory = rootDirectory.lexically_normal();
+
+	if (_rootDirectory.filename().empty())
+	{
+		_rootDirectory = _rootDirectory.parent_path();
+	}
+}
+
+fs::path const& ArtifactCache::getRootDirectory() const noexcept
+{
+	return _rootDirectory;
+}
\ No newline at end of file
@@ -1,84 +1,668 @@
 #include "Kodgen/CodeGen/CodeGenManager.h"
 
+#include <algorithm>	//std::sort, std::stable_sort, std::min
+#include <unordered_set>
+
 #include "Kodgen/CodeGen/GeneratedFile.h"
 #include "Kodgen/Parsing/ParsingSettings.h"	//ParsingSettings::parsingMacro
+#include "Kodgen/Misc/System.h"
+#include "Kodgen/Misc/HashHelpers.h"
 
 using namespace kodgen;
 
 CodeGenManager::CodeGenManager(uint32 threadCount) noexcept:
-	_threadPool(getThreadCount(threadCount), ETerminationMode::FinishAll)
+	_ownedThreadPool{std::make_unique<ThreadPool>(getThreadCount(threadCount), ETerminationMode::FinishAll)},
+	_executor{_ownedThreadPool.get()}
+{
+}
+
+CodeGenManager::CodeGenManager(IExecutor& executor) noexcept:
+	_executor{&executor}
 {
 }
 
 std::set<fs::path> CodeGenManager::identifyFilesToProcess(CodeGenUnit const& codeGenUnit, CodeGenResult& out_genResult, bool forceRegenerateAll) noexcept
 {
-	std::set<fs::path> result;
+	FileScanResult scanResult;
+
+	//Load the file manifest written by the previous run, if any
+	_fileManifest.load(codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::fileManifestFilename);
+	_scannedFileStatuses.clear();
+
+	//Sanitize ignored paths on this thread so that the following concurrent checks don't modify the settings
+	settings.sanitizeIgnoredPaths();
 
-	//Iterate over all "toParseFiles"
-	for (fs::path path : settings.getToProcessFiles())
+	//Scan all "toParseFiles" in a single batch, each worker claiming files until all are scanned
+	std::vector<fs::path> toProcessFiles(settings.getToProcessFiles().cbegin(), settings.getToProcessFiles().cend());
+
+	if (!toProcessFiles.empty())
 	{
-		if (fs::exists(path) && !fs::is_directory(path))
+		scanResult.scanTasks.emplace_back(_executor->submitBatch("Scan files", toProcessFiles.size(), [this, &toProcessFiles, &codeGenUnit, forceRegenerateAll, &scanResult](uint64 index, TaskBase*)
 		{
-			if (!codeGenUnit.isUpToDate(path) || forceRegenerateAll)
+			fs::path const& path = toProcessFiles[index];
+
+			if (fs::exists(path) && !fs::is_directory(path))
 			{
-				result.emplace(path);
+				scanFile(path, codeGenUnit, forceRegenerateAll, scanResult);
 			}
-			else
+			else if (logger != nullptr)
 			{
-				out_genResult.upToDateFiles.push_back(path);
+				//Add FileGenerationFile invalid path
+				logger->log("File " + path.string() + " doesn't exist or is not a file. Skip.", ILogger::ELogSeverity::Warning);
 			}
+		}));
+	}
+
+	//Iterate over all "toParseDirectories", each directory is scanned on its own thread
+	for (fs::path pathToIncludedDir : settings.getToProcessDirectories())
+	{
+		if (fs::exists(pathToIncludedDir) && fs::is_directory(pathToIncludedDir))
+		{
+			submitScanDirectory(pathToIncludedDir, codeGenUnit, forceRegenerateAll, scanResult);
 		}
 		else if (logger != nullptr)
 		{
 			//Add FileGenerationFile invalid path
-			logger->log("File " + path.string() + " doesn't exist or is not a file. Skip.", ILogger::ELogSeverity::Warning);
+			logger->log("Directory " + pathToIncludedDir.string() + " is not a directory or doesn't exist. Skip.", ILogger::ELogSeverity::Warning);
 		}
 	}
 
-	//Iterate over all "toParseDirectories"
-	for (fs::path pathToIncludedDir : settings.getToProcessDirectories())
+	//Scan tasks add the tasks of their subdirectories before finishing, so all tasks are known once the last listed task has finished
+	for (size_t i = 0u; ; i++)
 	{
-		if (fs::exists(pathToIncludedDir) && fs::is_directory(pathToIncludedDir))
+		std::shared_ptr<TaskBase> scanTask;
+
 		{
-			for (fs::recursive_directory_iterator directoryIt = fs::recursive_directory_iterator(pathToIncludedDir, fs::directory_options::follow_directory_symlink); directoryIt != fs::recursive_directory_iterator(); directoryIt++)
+			std::lock_guard<std::mutex> lock(_scanMutex);
+
+			if (i == scanResult.scanTasks.size())
 			{
-				fs::directory_entry entry = *directoryIt;
+				break;
+			}
 
-				//Just to make sure the entry hasn't been deleted since beginning of directory iteration
-				if (entry.exists())
-				{
-					if (entry.is_regular_file())
-					{
-						if (settings.isSupportedFileExtension(entry.path().extension()) && !settings.isIgnoredFile(entry.path()))
-						{
-							if (!codeGenUnit.isUpToDate(entry.path()) || forceRegenerateAll)
-							{
-								result.emplace(entry.path());
-							}
-							else
-							{
-								out_genResult.upToDateFiles.push_back(entry.path());
-							}
-						}
-					}
-					else if (entry.is_directory() && settings.isIgnoredDirectory(entry.path()))
-					{
-						//Don't iterate on ignored directory content
-						directoryIt.disable_recursion_pending();
-					}
-				}
+			scanTask = scanResult.scanTasks[i];
+		}
+
+		_executor->waitTask(*scanTask);
+	}
+
+	//Refresh the manifest entries of the files found up-to-date by the CodeGenUnit
+	for (fs::path const& file : scanResult.toRefreshFiles)
+	{
+		_fileManifest.update(file, _scannedFileStatuses[file], codeGenUnit.getGeneratedFilePaths(file));
+	}
+
+	//Forget files which have not been found during this scan
+	out_genResult.removedFiles = _fileManifest.prune([this](fs::path const& file) { return _scannedFileStatuses.find(file) != _scannedFileStatuses.cend(); });
+
+	//Keep a stable order regardless of the scan threads scheduling
+	std::sort(scanResult.upToDateFiles.begin(), scanResult.upToDateFiles.end());
+
+	out_genResult.upToDateFiles.insert(out_genResult.upToDateFiles.cend(), std::make_move_iterator(scanResult.upToDateFiles.begin()), std::make_move_iterator(scanResult.upToDateFiles.end()));
+
+	return std::set<fs::path>(std::make_move_iterator(scanResult.toProcessFiles.begin()), std::make_move_iterator(scanResult.toProcessFiles.end()));
+}
+
+void CodeGenManager::submitScanDirectory(fs::path const& directory, CodeGenUnit const& codeGenUnit, bool forceRegenerateAll, FileScanResult& out_scanResult) noexcept
+{
+	std::shared_ptr<TaskBase> scanTask = _executor->submitTask("Scan directory", [this, directory, &codeGenUnit, forceRegenerateAll, &out_scanResult](TaskBase*)
+	{
+		scanDirectory(directory, codeGenUnit, forceRegenerateAll, out_scanResult);
+	});
+
+	std::lock_guard<std::mutex> lock(_scanMutex);
+
+	out_scanResult.scanTasks.push_back(std::move(scanTask));
+}
+
+void CodeGenManager::scanDirectory(fs::path const& directory, CodeGenUnit const& codeGenUnit, bool forceRegenerateAll, FileScanResult& out_scanResult) noexcept
+{
+	std::error_code errorCode;
+
+	//directory_iterator retrieves the entry types while reading the directory, so no additional system call is needed here
+	for (fs::directory_iterator directoryIt(directory, errorCode), end; !errorCode && directoryIt != end; directoryIt.increment(errorCode))
+	{
+		fs::directory_entry const& entry = *directoryIt;
+
+		if (entry.is_directory(errorCode))
+		{
+			//Don't iterate on ignored directory content
+			if (!settings.isIgnoredDirectory(entry.path()))
+			{
+				submitScanDirectory(entry.path(), codeGenUnit, forceRegenerateAll, out_scanResult);
 			}
 		}
-		else if (logger != nullptr)
+		else if (entry.is_regular_file(errorCode))
 		{
-			//Add FileGenerationFile invalid path
-			logger->log("Directory " + pathToIncludedDir.string() + " is not a directory or doesn't exist. Skip.", ILogger::ELogSeverity::Warning);
+			if (settings.isSupportedFileExtension(entry.path().extension()) && !settings.isIgnoredFile(entry.path()))
+			{
+				scanFile(entry.path(), codeGenUnit, forceRegenerateAll, out_scanResult);
+			}
+		}
+
+		//Errors on a single entry (entry deleted since the beginning of the iteration...) must not stop the iteration
+		errorCode.clear();
+	}
+
+	if (errorCode && logger != nullptr)
+	{
+		logger->log("Failed to scan directory " + directory.string() + ": " + errorCode.message(), ILogger::ELogSeverity::Warning);
+	}
+}
+
+void CodeGenManager::scanFile(fs::path const& file, CodeGenUnit const& codeGenUnit, bool forceRegenerateAll, FileScanResult& out_scanResult) noexcept
+{
+	FileStatus	fileStatus;
+	bool		hasStatus		= FileStatus::query(file, fileStatus);
+	bool		isUpToDate		= false;
+	bool		shouldRefresh	= false;
+
+	if (!forceRegenerateAll)
+	{
+		std::vector<fs::path> generatedFiles = codeGenUnit.getGeneratedFilePaths(file);
+
+		if (hasStatus && !generatedFiles.empty() && _fileManifest.isUpToDate(file, fileStatus, generatedFiles))
+		{
+			isUpToDate = true;
+		}
+		//Invalidated files failed or were cancelled during their last processing, their generated files may be partial
+		else if (!_fileManifest.isInvalidated(file))
+		{
+			//Fallback to the CodeGenUnit check, and refresh the manifest if it states the file is up-to-date
+			isUpToDate		= codeGenUnit.isUpToDate(file);
+			shouldRefresh	= isUpToDate && hasStatus && !generatedFiles.empty();
+		}
+	}
+
+	std::lock_guard<std::mutex> lock(_scanMutex);
+
+	if (hasStatus)
+	{
+		_scannedFileStatuses.emplace(file, fileStatus);
+	}
+
+	if (isUpToDate)
+	{
+		out_scanResult.upToDateFiles.push_back(file);
+
+		if (shouldRefresh)
+		{
+			out_scanResult.toRefreshFiles.push_back(file);
+		}
+	}
+	else
+	{
+		out_scanResult.toProcessFiles.push_back(file);
+	}
+}
+
+std::vector<fs::path> CodeGenManager::scheduleFiles(std::set<fs::path> const& files, fs::path const& outputDirectory) const noexcept
+{
+	struct FileCost
+	{
+		fs::path const*	file;
+		double			cost;
+		bool			isEstimated;
+	};
+
+	std::vector<FileCost>	filesCost;
+	double					recordedCost		= 0.0;
+	double					recordedEstimate	= 0.0;
+	uint32					shardIndex			= settings.getShardIndex();
+	uint32					shardCount			= settings.getShardCount();
+
+	filesCost.reserve(files.size() / shardCount + 1u);
+
+	for (fs::path const& file : files)
+	{
+		//The shard of a file only depends on its path, so that every file is processed by exactly one shard
+		//whatever the file manifest and the out-of-date files of each shard
+		if (shardCount > 1u && getStablePathHash(file, outputDirectory) % shardCount != shardIndex)
+		{
+			continue;
+		}
+
+		uint64 parseDuration;
+		uint64 generationDuration;
+		double estimate = static_cast<double>(estimateFileCost(file));
+
+		if (_fileManifest.getDurations(file, parseDuration, generationDuration))
+		{
+			double cost = static_cast<double>(parseDuration + generationDuration);
+
+			//The estimate of a file with recorded durations only calibrates the estimates of the other files
+			recordedCost		+= cost;
+			recordedEstimate	+= estimate;
+
+			filesCost.push_back(FileCost{ &file, cost, false });
+		}
+		else
+		{
+			filesCost.push_back(FileCost{ &file, estimate, true });
+		}
+	}
+
+	//Convert estimates to durations using the ratio observed on files with recorded durations
+	if (recordedEstimate > 0.0)
+	{
+		double estimateToDuration = recordedCost / recordedEstimate;
+
+		for (FileCost& fileCost : filesCost)
+		{
+			if (fileCost.isEstimated)
+			{
+				fileCost.cost *= estimateToDuration;
+			}
+		}
+	}
+
+	//Stable sort keeps the path order between files of equal cost
+	std::stable_sort(filesCost.begin(), filesCost.end(), [](FileCost const& lhs, FileCost const& rhs) { return lhs.cost > rhs.cost; });
+
+	std::vector<fs::path> result;
+
+	result.reserve(filesCost.size());
+
+	for (FileCost const& fileCost : filesCost)
+	{
+		result.push_back(*fileCost.file);
+	}
+
+	return result;
+}
+
+uint64 CodeGenManager::getStablePathHash(fs::path const& file, fs::path const& rootDirectory) noexcept
+{
+	std::string path = FilesystemHelpers::normalizeSeparator(file.lexically_relative(rootDirectory)).string();
+
+	return HashHelpers::hashBytes(HashHelpers::initialHash, path.data(), path.size());
+}
+
+uint64 CodeGenManager::estimateFileCost(fs::path const& file) const noexcept
+{
+	//The size is retrieved by the scan, so estimating a file doesn't read it
+	auto it = _scannedFileStatuses.find(file);
+
+	return (it != _scannedFileStatuses.cend()) ? it->second.size : 0u;
+}
+
+std::vector<uint64> CodeGenManager::estimateTranslationUnitsMemory(std::vector<fs::path> const& files) const noexcept
+{
+	//Memory of a translation unit is mostly used by included headers, so it is rarely lower than this
+	constexpr uint64 const defaultMemory = 64u * 1024u * 1024u;
+
+	std::vector<uint64>	result(files.size(), 0u);
+	std::vector<uint64>	fileSizes(files.size(), 0u);
+	double				recordedMemory	= 0.0;
+	double				recordedSize	= 0.0;
+
+	for (size_t i = 0u; i < files.size(); i++)
+	{
+		//Reuse the sizes read when scanning the files instead of querying the file system again
+		fileSizes[i]	= estimateFileCost(files[i]);
+		result[i]		= _fileManifest.getTranslationUnitMemory(files[i]);
+
+		if (result[i] != 0u)
+		{
+			recordedMemory	+= static_cast<double>(result[i]);
+			recordedSize	+= static_cast<double>(fileSizes[i]);
+		}
+	}
+
+	//Convert sizes to memory using the ratio observed on files with recorded memory
+	double sizeToMemory = (recordedSize > 0.0) ? recordedMemory / recordedSize : 0.0;
+
+	for (size_t i = 0u; i < files.size(); i++)
+	{
+		if (result[i] == 0u)
+		{
+			uint64 estimate = static_cast<uint64>(static_cast<double>(fileSizes[i]) * sizeToMemory);
+
+			result[i] = (estimate != 0u) ? estimate : defaultMemory;
+		}
+	}
+
+	return result;
+}
+
+MemoryBudget& CodeGenManager::initMemoryBudget() noexcept
+{
+	MemoryBudget* memoryBudget = &MemoryBudget::getProcessBudget();
+
+	if (settings.getMemoryBudget() != 0u)
+	{
+		_ownedMemoryBudget.setCapacity(settings.getMemoryBudget() * 1024u * 1024u);
+
+		memoryBudget = &_ownedMemoryBudget;
+	}
+
+	if (memoryBudget->getCapacity() != 0u && logger != nullptr && logger->isLogged(ILogger::ELogSeverity::Info))
+	{
+		logger->log("Translation units memory budget: " + std::to_string(memoryBudget->getCapacity() / (1024u * 1024u)) + " MiB.");
+	}
+
+	return *memoryBudget;
+}
+
+void CodeGenManager::recordProcessedFile(CodeGenUnit const& codeGenUnit, fs::path const& file, bool succeeded, FileProcessingStats const& stats) noexcept
+{
+	auto it = _scannedFileStatuses.find(file);
+
+	if (succeeded && it != _scannedFileStatuses.cend())
+	{
+		//Record the status retrieved during the scan so that a modification made during the generation is detected next time
+		_fileManifest.update(file, it->second, codeGenUnit.getGeneratedFilePaths(file));
+	}
+	else
+	{
+		_fileManifest.invalidate(file);
+	}
+
+	_fileManifest.setDurations(file, stats.parseDuration, stats.generationDuration);
+
+	if (stats.translationUnitMemory != 0u)
+	{
+		_fileManifest.setTranslationUnitMemory(file, stats.translationUnitMemory);
+	}
+}
+
+uint64 CodeGenManager::computePeakTranslationUnitsMemory(std::vector<TranslationUnitUsage> const& usages) noexcept
+{
+	//Each usage adds its memory when it starts and removes it when it ends
+	std::vector<std::pair<TimingReport::Clock::time_point, int64>> events;
+	events.reserve(usages.size() * 2u);
+
+	for (TranslationUnitUsage const& usage : usages)
+	{
+		events.emplace_back(usage.start, static_cast<int64>(usage.memory));
+		events.emplace_back(usage.end, -static_cast<int64>(usage.memory));
+	}
+
+	//On equal times, releases (negative values) are sorted before allocations
+	std::sort(events.begin(), events.end());
+
+	int64 currentMemory	= 0;
+	int64 peakMemory	= 0;
+
+	for (auto const& [time, memory] : events)
+	{
+		currentMemory	+= memory;
+		peakMemory		= std::max(peakMemory, currentMemory);
+	}
+
+	return static_cast<uint64>(peakMemory);
+}
+
+void CodeGenManager::saveFileManifest(CodeGenUnit const& codeGenUnit) noexcept
+{
+	fs::path manifestPath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::fileManifestFilename;
+
+	if (!_fileManifest.save(manifestPath) && logger != nullptr)
+	{
+		logger->log("Failed to write the file manifest " + manifestPath.string() + ".", ILogger::ELogSeverity::Warning);
+	}
+}
+
+void CodeGenManager::prepareProjectStructClassTree(CodeGenUnit const& codeGenUnit, std::vector<fs::path> const& toProcessFiles) noexcept
+{
+	if (!settings.shouldPersistProjectStructClassTree())
+	{
+		_projectStructClassTree.clear();
+
+		return;
+	}
+
+	fs::path treePath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::projectStructClassTreeFilename;
+
+	if (!_projectStructClassTree.load(treePath) && fs::exists(treePath) && logger != nullptr)
+	{
+		logger->log("Failed to load the project struct/class tree " + treePath.string() + ", the inheritance links of up-to-date files are unknown.", ILogger::ELogSeverity::Warning);
+	}
+
+	std::unordered_set<fs::path, PathHash> toProcessFilesSet(toProcessFiles.cbegin(), toProcessFiles.cend());
+
+	//Links of processed files are added again when they are parsed, links of removed files are forgotten
+	_projectStructClassTree.prune([this, &toProcessFilesSet](fs::path const& file)
+								  {
+									  return toProcessFilesSet.find(file) == toProcessFilesSet.cend() && _scannedFileStatuses.find(file) != _scannedFileStatuses.cend();
+								  });
+
+	//Frozen again once the files are parsed
+	_projectStructClassTree.freeze();
+}
+
+void CodeGenManager::saveProjectStructClassTree(CodeGenUnit const& codeGenUnit) noexcept
+{
+	fs::path treePath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::projectStructClassTreeFilename;
+
+	if (!_projectStructClassTree.save(treePath) && logger != nullptr)
+	{
+		logger->log("Failed to write the project struct/class tree " + treePath.string() + ".", ILogger::ELogSeverity::Warning);
+	}
+}
+
+bool CodeGenManager::shouldUseEntityCodeCache() const noexcept
+{
+	return settings.shouldCacheEntityCode() && !settings.shouldBuildProjectStructClassTree();
+}
+
+void CodeGenManager::prepareEntityCodeCache(CodeGenUnit const& codeGenUnit) noexcept
+{
+	fs::path cachePath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::entityCodeCacheFilename;
+
+	if (!_entityCodeCache.load(cachePath) && fs::exists(cachePath) && logger != nullptr)
+	{
+		logger->log("Failed to load the entity code cache " + cachePath.string() + ", the code of all entities is generated again.", ILogger::ELogSeverity::Warning);
+	}
+
+	//Snippets of removed files are forgotten
+	_entityCodeCache.prune([this](fs::path const& file)
+						   {
+							   return _scannedFileStatuses.find(file) != _scannedFileStatuses.cend();
+						   });
+}
+
+void CodeGenManager::saveEntityCodeCache(CodeGenUnit const& codeGenUnit) noexcept
+{
+	fs::path cachePath = codeGenUnit.getSettings()->getOutputDirectory() / CodeGenUnitSettings::entityCodeCacheFilename;
+
+	if (!_entityCodeCache.save(cachePath) && logger != nullptr)
+	{
+		logger->log("Failed to write the entity code cache " + cachePath.string() + ".", ILogger::ELogSeverity::Warning);
+	}
+
+	//The snippets are only needed during the run
+	_entityCodeCache.clear();
+}
+
+fs::path CodeGenManager::getArtifactCacheRootDirectory(fs::path const& outputDirectory) const noexcept
+{
+	if (!settings.getArtifactCacheRootDirectory().empty())
+	{
+		return settings.getArtifactCacheRootDirectory();
+	}
+
+	std::vector<fs::path> paths{ outputDirectory };
+
+	paths.insert(paths.end(), settings.getToProcessDirectories().cbegin(), settings.getToProcessDirectories().cend());
+
+	for (fs::path const& file : settings.getToProcessFiles())
+	{
+		paths.push_back(file.parent_path());
+	}
+
+	//Keep the leading components shared by all the paths
+	fs::path result = paths.front().lexically_normal();
+
+	for (fs::path const& path : paths)
+	{
+		fs::path	commonPath;
+		fs::path	normalizedPath	= path.lexically_normal();
+		auto		resultIt		= result.begin();
+		auto		pathIt			= normalizedPath.begin();
+
+		for (; resultIt != result.end() && pathIt != normalizedPath.end() && *resultIt == *pathIt && !resultIt->empty(); ++resultIt, ++pathIt)
+		{
+			commonPath /= *resultIt;
 		}
+
+		result = std::move(commonPath);
 	}
 
 	return result;
 }
 
+std::vector<opt::optional<uint64>> CodeGenManager::restoreArtifacts(ParsingSettings const& parsingSettings, CodeGenUnit const& codeGenUnit, bool forceRegenerateAll,
+																	std::vector<fs::path>& inout_toProcessFiles, FileProcessedCallback const& onFileProcessed, CodeGenResult& out_genResult) noexcept
+{
+	//Code generators can check inheritance across files, so the generated files also depend on the other files of the project
+	if (settings.shouldBuildProjectStructClassTree())
+	{
+		if (logger != nullptr)
+		{
+			logger->log("The artifact cache is not used since the project struct class tree is built.", ILogger::ELogSeverity::Warning);
+		}
+
+		return {};
+	}
+
+	uint64 codeGenUnitFingerprint = codeGenUnit.getCacheFingerprint();
+
+	if (codeGenUnitFingerprint == 0u)
+	{
+		if (logger != nullptr)
+		{
+			logger->log("The artifact cache is not used since the code generation unit can't be cached. Make sure all code generators return a cache fingerprint.", ILogger::ELogSeverity::Warning);
+		}
+
+		return {};
+	}
+
+	fs::path const& outputDirectory = codeGenUnit.getSettings()->getOutputDirectory();
+
+	//Files may have been modified since the previous run
+	_artifactCache.setDirectory(settings.getArtifactCacheDirectory());
+	_artifactCache.setRootDirectory(getArtifactCacheRootDirectory(outputDirectory));
+	_artifactCache.clearFileDigests();
+
+	std::vector<std::pair<opt::optional<uint64>, bool>> restoreResults = _executor->parallelFor(inout_toProcessFiles.size(), [&](uint64 fileIndex, TaskBase*)
+	{
+		fs::path const&			file			= inout_toProcessFiles[fileIndex];
+		std::vector<fs::path>	generatedFiles	= codeGenUnit.getGeneratedFilePaths(file);
+		opt::optional<uint64>	key;
+		bool					restored		= false;
+
+		if (!generatedFiles.empty())
+		{
+			key = _artifactCache.computeKey(file, parsingSettings.getCompilationArguments(file), generatedFiles, codeGenUnitFingerprint, outputDirectory);
+		}
+
+		if (key.has_value() && !forceRegenerateAll && _artifactCache.restore(key.value(), file, generatedFiles))
+		{
+			auto it = _scannedFileStatuses.find(file);
+
+			if (it != _scannedFileStatuses.cend())
+			{
+				_fileManifest.update(file, it->second, generatedFiles);
+			}
+
+			if (onFileProcessed)
+			{
+				onFileProcessed(file, EFileProcessingStep::Restored, true);
+			}
+
+			restored = true;
+		}
+
+		return std::make_pair(key, restored);
+	});
+
+	std::vector<fs::path>				toProcessFiles;
+	std::vector<opt::optional<uint64>>	artifactKeys;
+
+	toProcessFiles.reserve(inout_toProcessFiles.size());
+	artifactKeys.reserve(inout_toProcessFiles.size());
+
+	for (size_t fileIndex = 0u; fileIndex < inout_toProcessFiles.size(); fileIndex++)
+	{
+		if (restoreResults[fileIndex].second)
+		{
+			out_genResult.restoredFiles.push_back(std::move(inout_toProcessFiles[fileIndex]));
+		}
+		else
+		{
+			toProcessFiles.push_back(std::move(inout_toProcessFiles[fileIndex]));
+			artifactKeys.push_back(restoreResults[fileIndex].first);
+		}
+	}
+
+	if (logger != nullptr && logger->isLogged(ILogger::ELogSeverity::Info))
+	{
+		logger->log("Artifact cache: " + std::to_string(out_genResult.restoredFiles.size()) + " file(s) restored, " + std::to_string(toProcessFiles.size()) + " file(s) to process.");
+	}
+
+	inout_toProcessFiles = std::move(toProcessFiles);
+
+	return artifactKeys;
+}
+
+void CodeGenManager::publishArtifacts(CodeGenUnit const& codeGenUnit, std::vector<fs::path> const& processedFiles, std::vector<opt::optional<uint64>> const& artifactKeys) noexcept
+{
+	_executor->parallelFor(processedFiles.size(), [&](uint64 fileIndex, TaskBase*)
+	{
+		fs::path const&			file			= processedFiles[fileIndex];
+		std::vector<fs::path>	generatedFiles	= codeGenUnit.getGeneratedFilePaths(file);
+		FileStatus				sourceStatus;
+
+		//The file manifest only keeps the files generated successfully, and the key was computed from the source file scanned at the beginning of the run
+		if (!artifactKeys[fileIndex].has_value() || !FileStatus::query(file, sourceStatus) || !_fileManifest.isUpToDate(file, sourceStatus, generatedFiles))
+		{
+			return;
+		}
+
+		if (!_artifactCache.publish(artifactKeys[fileIndex].value(), file, generatedFiles) && logger != nullptr)
+		{
+			logger->log("Failed to store the files generated from " + file.string() + " in the artifact cache " + _artifactCache.getDirectory().string() + ".", ILogger::ELogSeverity::Warning);
+		}
+	});
+}
+
+ProjectStructClassTree const& CodeGenManager::getProjectStructClassTree() const noexcept
+{
+	return _projectStructClassTree;
+}
+
+void CodeGenManager::cancel() noexcept
+{
+	std::lock_guard<std::mutex> lock(_cancellationMutex);
+
+	_cancellationSource.cancel();
+}
+
+CancellationToken CodeGenManager::resetCancellation() noexcept
+{
+	std::lock_guard<std::mutex> lock(_cancellationMutex);
+
+	_cancellationSource = CancellationSource();
+
+	return _cancellationSource.getToken();
+}
+
+void CodeGenManager::failFast(std::string const& failure) noexcept
+{
+	std::lock_guard<std::mutex> lock(_cancellationMutex);
+
+	if (!_cancellationSource.isCancellationRequested())
+	{
+		_cancellationSource.cancel();
+
+		if (logger != nullptr)
+		{
+			logger->log(failure + " Stop the generation since fail-fast is enabled.", ILogger::ELogSeverity::Error);
+		}
+	}
+}
+
 uint32 CodeGenManager::getThreadCount(uint32 initialThreadCount) const noexcept
 {
 	if (initialThreadCount == 0)
@@ -91,6 +675,14 @@ uint32 CodeGenManager::getThreadCount(uint32 initialThreadCount) const noexcept
 		{
 			initialThreadCount = 8u;
 		}
+
+		//hardware_concurrency ignores the CPU quota of containers, which would oversubscribe the allowed CPUs
+		uint32 cpuQuota = System::getCpuQuota();
+
+		if (cpuQuota != 0u)
+		{
+			initialThreadCount = std::min(initialThreadCount, cpuQuota);
+		}
 	}
 
 	return initialThreadCount;
@@ -40,6 +40,13 @@ bool CodeGenManagerSettings::loadSettingsValues(toml::value const& tomlData, ILo
 		loadToProcessDirectories(tomlGeneratorSettings, logger);
 		loadIgnoredFiles(tomlGeneratorSettings, logger);
 		loadIgnoredDirectories(tomlGeneratorSettings, logger);
+		loadShard(tomlGeneratorSettings, logger);
+		loadProjectStructClassTree(tomlGeneratorSettings, logger);
+		loadFailFast(tomlGeneratorSettings, logger);
+		loadMemoryBudget(tomlGeneratorSettings, logger);
+		loadEntityCodeCache(tomlGeneratorSettings, logger);
+		loadArtifactCacheDirectory(tomlGeneratorSettings, logger);
+		loadArtifactCacheRootDirectory(tomlGeneratorSettings, logger);
 
 		return true;
 	}
@@ -101,6 +108,50 @@ bool CodeGenManagerSettings::addSupportedFileExtension(fs::path const& extension
 	return false;
 }
 
+bool CodeGenManagerSettings::setShard(uint32 shardIndex, uint32 shardCount) noexcept
+{
+	if (shardCount == 0u || shardIndex >= shardCount)
+	{
+		return false;
+	}
+
+	_shardIndex = shardIndex;
+	_shardCount = shardCount;
+
+	return true;
+}
+
+void CodeGenManagerSettings::setProjectStructClassTree(bool build, bool persist) noexcept
+{
+	_buildProjectStructClassTree	= build;
+	_persistProjectStructClassTree	= persist;
+}
+
+void CodeGenManagerSettings::setFailFast(bool failFast) noexcept
+{
+	_failFast = failFast;
+}
+
+void CodeGenManagerSettings::setMemoryBudget(uint64 memoryBudget) noexcept
+{
+	_memoryBudget = memoryBudget;
+}
+
+void CodeGenManagerSettings::setEntityCodeCache(bool cacheEntityCode) noexcept
+{
+	_cacheEntityCode = cacheEntityCode;
+}
+
+void CodeGenManagerSettings::setArtifactCacheDirectory(fs::path const& artifactCacheDirectory) noexcept
+{
+	_artifactCacheDirectory = artifactCacheDirectory;
+}
+
+void CodeGenManagerSettings::setArtifactCacheRootDirectory(fs::path const& artifactCacheRootDirectory) noexcept
+{
+	_artifactCacheRootDirectory = artifactCacheRootDirectory;
+}
+
 void CodeGenManagerSettings::removeToProcessFile(fs::path const& path) noexcept
 {
 	_toProcessFiles.erase(FilesystemHelpers::sanitizePath(path));
@@ -158,24 +209,31 @@ bool CodeGenManagerSettings::isSupportedFileExtension(fs::path const& extension)
 
 bool CodeGenManagerSettings::isIgnoredFile(fs::path const& file) noexcept
 {
-	if (_ignoredFilesDirtyFlag)
-	{
-		sanitizePaths(_ignoredFiles);
-		_ignoredFilesDirtyFlag = false;
-	}
+	sanitizeIgnoredPaths();
 
 	return _ignoredFiles.find(fs::exists(file) ? FilesystemHelpers::sanitizePath(file) : file) != _ignoredFiles.end();
 }
 
 bool CodeGenManagerSettings::isIgnoredDirectory(fs::path const& directory) noexcept
 {
+	sanitizeIgnoredPaths();
+
+	return _ignoredDirectories.find(fs::exists(directory) ? FilesystemHelpers::sanitizePath(directory) : directory) != _ignoredDirectories.end();
+}
+
+void CodeGenManagerSettings::sanitizeIgnoredPaths() noexcept
+{
+	if (_ignoredFilesDirtyFlag)
+	{
+		sanitizePaths(_ignoredFiles);
+		_ignoredFilesDirtyFlag = false;
+	}
+
 	if (_ignoredDirectoriesDirtyFlag)
 	{
 		sanitizePaths(_ignoredDirectories);
 		_ignoredDirectoriesDirtyFlag = false;
 	}
-
-	return _ignoredDirectories.find(fs::exists(directory) ? FilesystemHelpers::sanitizePath(directory) : directory) != _ignoredDirectories.end();
 }
 
 void CodeGenManagerSettings::loadSupportedFileExtensions(toml::value const& generationSettings, ILogger* logger) noexcept
@@ -322,6 +380,113 @@ void CodeGenManagerSettings::loadIgnoredDirectories(toml::value const& generatio
 	}
 }
 
+void CodeGenManagerSettings::loadShard(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	uint32 loadedShardIndex = _shardIndex;
+	uint32 loadedShardCount = _shardCount;
+
+	bool loadedIndex = TomlUtility::updateSetting(generationSettings, "shardIndex", loadedShardIndex, logger);
+	bool loadedCount = TomlUtility::updateSetting(generationSettings, "shardCount", loadedShardCount, logger);
+
+	if (loadedIndex || loadedCount)
+	{
+		if (setShard(loadedShardIndex, loadedShardCount))
+		{
+			if (logger != nullptr)
+			{
+				logger->log("[TOML] Load shard: " + std::to_string(_shardIndex) + "/" + std::to_string(_shardCount));
+			}
+		}
+		else if (logger != nullptr)
+		{
+			logger->log("[TOML] Failed to load shard: shardIndex (" + std::to_string(loadedShardIndex) + ") must be less than shardCount (" + std::to_string(loadedShardCount) + ").", ILogger::ELogSeverity::Warning);
+		}
+	}
+}
+
+void CodeGenManagerSettings::loadProjectStructClassTree(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "buildProjectStructClassTree", _buildProjectStructClassTree, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load buildProjectStructClassTree: " + std::to_string(_buildProjectStructClassTree));
+	}
+
+	if (TomlUtility::updateSetting(generationSettings, "persistProjectStructClassTree", _persistProjectStructClassTree, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load persistProjectStructClassTree: " + std::to_string(_persistProjectStructClassTree));
+	}
+}
+
+void CodeGenManagerSettings::loadFailFast(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "failFast", _failFast, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load failFast: " + std::to_string(_failFast));
+	}
+}
+
+void CodeGenManagerSettings::loadMemoryBudget(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "memoryBudget", _memoryBudget, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load memoryBudget: " + std::to_string(_memoryBudget));
+	}
+}
+
+void CodeGenManagerSettings::loadEntityCodeCache(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(generationSettings, "cacheEntityCode", _cacheEntityCode, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load cacheEntityCode: " + std::to_string(_cacheEntityCode));
+	}
+}
+
+void CodeGenManagerSettings::loadArtifactCacheDirectory(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	std::string loadedDirectory;
+
+	if (TomlUtility::updateSetting(generationSettings, "artifactCacheDirectory", loadedDirectory, logger))
+	{
+		_artifactCacheDirectory.clear();
+
+		//The directory doesn't have to exist yet, create it so that the path can be sanitized like the other paths
+		if (!loadedDirectory.empty())
+		{
+			std::error_code errorCode;
+			fs::create_directories(loadedDirectory, errorCode);
+
+			_artifactCacheDirectory = FilesystemHelpers::sanitizePath(loadedDirectory);
+		}
+
+		if (logger != nullptr)
+		{
+			if (!_artifactCacheDirectory.empty() || loadedDirectory.empty())
+			{
+				logger->log("[TOML] Load artifactCacheDirectory: " + _artifactCacheDirectory.string());
+			}
+			else
+			{
+				logger->log("[TOML] Failed to create artifactCacheDirectory " + loadedDirectory + ", the artifact cache is disabled.", ILogger::ELogSeverity::Warning);
+			}
+		}
+	}
+}
+
+void CodeGenManagerSettings::loadArtifactCacheRootDirectory(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	std::string loadedDirectory;
+
+	if (TomlUtility::updateSetting(generationSettings, "artifactCacheRootDirectory", loadedDirectory, logger))
+	{
+		_artifactCacheRootDirectory = FilesystemHelpers::sanitizePath(loadedDirectory);
+
+		if (logger != nullptr)
+		{
+			logger->log("[TOML] Load artifactCacheRootDirectory: " + _artifactCacheRootDirectory.string());
+		}
+	}
+}
+
 std::unordered_set<fs::path, PathHash> const& CodeGenManagerSettings::getToProcessFiles() const noexcept
 {
 	return _toProcessFiles;
@@ -345,4 +510,49 @@ std::unordered_set<fs::path, PathHash> const& CodeGenManagerSettings::getIgnored
 std::unordered_set<std::string> const& CodeGenManagerSettings::getSupportedExtensions() const noexcept
 {
 	return _supportedFileExtensions;
+}
+
+uint32 CodeGenManagerSettings::getShardIndex() const noexcept
+{
+	return _shardIndex;
+}
+
+uint32 CodeGenManagerSettings::getShardCount() const noexcept
+{
+	return _shardCount;
+}
+
+bool CodeGenManagerSettings::shouldBuildProjectStructClassTree() const noexcept
+{
+	return _buildProjectStructClassTree;
+}
+
+bool CodeGenManagerSettings::shouldPersistProjectStructClassTree() const noexcept
+{
+	return _persistProjectStructClassTree;
+}
+
+bool CodeGenManagerSettings::shouldFailFast() const noexcept
+{
+	return _failFast;
+}
+
+uint64 CodeGenManagerSettings::getMemoryBudget() const noexcept
+{
+	return _memoryBudget;
+}
+
+bool CodeGenManagerSettings::shouldCacheEntityCode() const noexcept
+{
+	return _cacheEntityCode;
+}
+
+fs::path const& CodeGenManagerSettings::getArtifactCacheDirectory() const noexcept
+{
+	return _artifactCacheDirectory;
+}
+
+fs::path const& CodeGenManagerSettings::getArtifactCacheRootDirectory() const noexcept
+{
+	return _artifactCacheRootDirectory;
 }
\ No newline at end of file
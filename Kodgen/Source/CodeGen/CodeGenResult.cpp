@@ -1,11 +1,170 @@
 #include "Kodgen/CodeGen/CodeGenResult.h"
 
+#include <algorithm>	//std::max, std::sort, std::unique
+#include <fstream>
+#include <sstream>
+
 using namespace kodgen;
 
 void CodeGenResult::mergeResult(CodeGenResult&& otherResult) noexcept
 {
 	parsedFiles.insert(parsedFiles.cend(), std::make_move_iterator(otherResult.parsedFiles.cbegin()), std::make_move_iterator(otherResult.parsedFiles.cend()));
 	upToDateFiles.insert(upToDateFiles.cend(), std::make_move_iterator(otherResult.upToDateFiles.cbegin()), std::make_move_iterator(otherResult.upToDateFiles.cend()));
+	restoredFiles.insert(restoredFiles.cend(), std::make_move_iterator(otherResult.restoredFiles.cbegin()), std::make_move_iterator(otherResult.restoredFiles.cend()));
+	skippedFiles.insert(skippedFiles.cend(), std::make_move_iterator(otherResult.skippedFiles.cbegin()), std::make_move_iterator(otherResult.skippedFiles.cend()));
+	removedFiles.insert(removedFiles.cend(), std::make_move_iterator(otherResult.removedFiles.cbegin()), std::make_move_iterator(otherResult.removedFiles.cend()));
+
+	timings.mergeReport(std::move(otherResult.timings));
+	filesMemoryUsage.insert(filesMemoryUsage.cend(), std::make_move_iterator(otherResult.filesMemoryUsage.begin()), std::make_move_iterator(otherResult.filesMemoryUsage.end()));
+
+	peakTranslationUnitsMemory	= std::max(peakTranslationUnitsMemory, otherResult.peakTranslationUnitsMemory);
+	peakResidentSetSize			= std::max(peakResidentSetSize, otherResult.peakResidentSetSize);
 
 	completed &= otherResult.completed;
+}
+
+bool CodeGenResult::save(fs::path const& resultFile) const noexcept
+{
+	std::ofstream stream(resultFile, std::ios::out | std::ios::trunc);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	stream << _header << "\n";
+	stream << "R " << completed << " " << duration << " " << peakTranslationUnitsMemory << " " << peakResidentSetSize << "\n";
+
+	for (fs::path const& file : parsedFiles)
+	{
+		stream << "P " << file.string() << "\n";
+	}
+
+	for (fs::path const& file : upToDateFiles)
+	{
+		stream << "U " << file.string() << "\n";
+	}
+
+	for (fs::path const& file : restoredFiles)
+	{
+		stream << "C " << file.string() << "\n";
+	}
+
+	for (fs::path const& file : skippedFiles)
+	{
+		stream << "S " << file.string() << "\n";
+	}
+
+	for (fs::path const& file : removedFiles)
+	{
+		stream << "D " << file.string() << "\n";
+	}
+
+	for (FileMemoryUsage const& memoryUsage : filesMemoryUsage)
+	{
+		stream << "M " << memoryUsage.translationUnitMemory << " " << memoryUsage.parsingResultMemory << " " << memoryUsage.file.string() << "\n";
+	}
+
+	return stream.good();
+}
+
+bool CodeGenResult::load(fs::path const& resultFile) noexcept
+{
+	*this = CodeGenResult();
+
+	std::ifstream	stream(resultFile);
+	std::string		line;
+
+	if (!std::getline(stream, line) || line != _header)
+	{
+		return false;
+	}
+
+	while (std::getline(stream, line))
+	{
+		if (line.size() < 2u)
+		{
+			continue;
+		}
+
+		std::istringstream lineStream(line.substr(2u));
+
+		switch (line[0])
+		{
+			case 'R':
+				lineStream >> completed >> duration >> peakTranslationUnitsMemory >> peakResidentSetSize;
+				break;
+
+			case 'P':
+				parsedFiles.emplace_back(line.substr(2u));
+				break;
+
+			case 'U':
+				upToDateFiles.emplace_back(line.substr(2u));
+				break;
+
+			case 'C':
+				restoredFiles.emplace_back(line.substr(2u));
+				break;
+
+			case 'S':
+				skippedFiles.emplace_back(line.substr(2u));
+				break;
+
+			case 'D':
+				removedFiles.emplace_back(line.substr(2u));
+				break;
+
+			case 'M':
+			{
+				FileMemoryUsage memoryUsage;
+
+				//The path is the remaining of the line since it can contain spaces
+				if (lineStream >> memoryUsage.translationUnitMemory >> memoryUsage.parsingResultMemory)
+				{
+					std::string file;
+
+					std::getline(lineStream >> std::ws, file);
+					memoryUsage.file = file;
+
+					filesMemoryUsage.push_back(std::move(memoryUsage));
+				}
+
+				break;
+			}
+
+			default:
+				break;
+		}
+
+		if (lineStream.bad())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+CodeGenResult CodeGenResult::mergeShardResults(std::vector<CodeGenResult>&& shardResults) noexcept
+{
+	CodeGenResult result;
+	result.completed = !shardResults.empty();
+
+	for (CodeGenResult& shardResult : shardResults)
+	{
+		float shardDuration = shardResult.duration;
+
+		result.mergeResult(std::move(shardResult));
+		result.duration = std::max(result.duration, shardDuration);
+	}
+
+	//All shards identify the same up-to-date and removed files
+	std::sort(result.upToDateFiles.begin(), result.upToDateFiles.end());
+	result.upToDateFiles.erase(std::unique(result.upToDateFiles.begin(), result.upToDateFiles.end()), result.upToDateFiles.end());
+
+	std::sort(result.removedFiles.begin(), result.removedFiles.end());
+	result.removedFiles.erase(std::unique(result.removedFiles.begin(), result.removedFiles.end()), result.removedFiles.end());
+
+	return result;
 }
\ No newline at end of file
@@ -0,0 +1,47 @@
+#include "Kodgen/CodeGen/CodeGenRunHandle.h"
+
+#include <cassert>
+
+#include "Kodgen/CodeGen/CodeGenManager.h"
+#include "Kodgen/Threading/TaskHelper.h"
+
+using namespace kodgen;
+
+CodeGenRunHandle::CodeGenRunHandle(CodeGenManager& manager, IExecutor& executor, std::shared_ptr<TaskBase> task) noexcept:
+	_manager{&manager},
+	_executor{&executor},
+	_task{std::move(task)}
+{
+}
+
+bool CodeGenRunHandle::isValid() const noexcept
+{
+	return _task != nullptr;
+}
+
+bool CodeGenRunHandle::isFinished() const noexcept
+{
+	assert(isValid());
+
+	return _task->hasFinished();
+}
+
+void CodeGenRunHandle::cancel() noexcept
+{
+	assert(isValid());
+
+	_manager->cancel();
+}
+
+CodeGenResult CodeGenRunHandle::join() noexcept
+{
+	assert(isValid());
+
+	_executor->waitTask(*_task);
+
+	CodeGenResult result = TaskHelper::getResult<CodeGenResult>(_task.get());
+
+	_task = nullptr;
+
+	return result;
+}
\ No newline at end of file
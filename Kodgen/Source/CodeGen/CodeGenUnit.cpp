@@ -1,9 +1,12 @@
 #include "Kodgen/CodeGen/CodeGenUnit.h"
 
 #include <algorithm>
+#include <typeinfo>
 
 #include "Kodgen/CodeGen/CodeGenHelpers.h"
 #include "Kodgen/CodeGen/PropertyCodeGen.h"
+#include "Kodgen/Misc/ScopedTimingSpan.h"
+#include "Kodgen/Misc/HashHelpers.h"
 
 #define HANDLE_NESTED_ENTITY_ITERATION_RESULT(result)																\
 	if (result == ETraversalBehaviour::Break)																		\
@@ -101,7 +104,24 @@ bool CodeGenUnit::isFileNewerThan(fs::path const& file, fs::path const& referenc
 	return fs::last_write_time(file) > fs::last_write_time(referenceFile);
 }
 
-bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult) noexcept
+std::vector<fs::path> CodeGenUnit::getGeneratedFilePaths(fs::path const& /* sourceFile */) const noexcept
+{
+	//Default implementation doesn't know which files are generated
+	return std::vector<fs::path>();
+}
+
+void CodeGenUnit::preProcessFiles(std::vector<fs::path> const& /* removedFiles */) noexcept
+{
+	//Default implementation does nothing
+}
+
+bool CodeGenUnit::postProcessFiles() noexcept
+{
+	//Default implementation does nothing
+	return true;
+}
+
+bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult, TimingReport* timingReport, ProjectStructClassTree const* projectStructClassTree, EntityCodeCache* entityCodeCache) noexcept
 {
 	//TODO: Should probably use std::unique_ptr here instead of a raw pointer to be exception-safe
 	CodeGenEnv* env = createCodeGenEnv();
@@ -110,8 +130,24 @@ bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult) noexcept
 	//Check the implementation in the CodeGenUnit you use.
 	assert(env != nullptr);
 
+	env->_timingReport				= timingReport;
+	env->_projectStructClassTree	= projectStructClassTree;
+
+	//Snippets stored by the previous generation of the file
+	if (entityCodeCache != nullptr)
+	{
+		_entityCodeCacheState.cache				= entityCodeCache;
+		_entityCodeCacheState.previousSnippets	= entityCodeCache->takeFileSnippets(parsingResult.parsedFile);
+	}
+
 	//Pre-generation step
-	bool result = preGenerateCode(parsingResult, *env);
+	bool result;
+	
+	{
+		ScopedTimingSpan span(timingReport, "CodeGen", "Pre-generation", parsingResult.parsedFile.string());
+
+		result = preGenerateCode(parsingResult, *env);
+	}
 
 	//Generation step (per module/entity pair), runs only if the pre-generation step succeeded
 	if (result)
@@ -134,6 +170,8 @@ bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult) noexcept
 				//Post-generation step, runs only if all previous steps succeeded
 				if (result)
 				{
+					ScopedTimingSpan span(timingReport, "CodeGen", "Post-generation", parsingResult.parsedFile.string());
+
 					result &= postGenerateCode(*env);
 				}
 			}
@@ -142,6 +180,19 @@ bool CodeGenUnit::generateCode(FileParsingResult const& parsingResult) noexcept
 
 	delete env;
 
+	if (entityCodeCache != nullptr)
+	{
+		//Snippets of removed or modified entities are dropped, unless the generation failed before reaching them
+		if (!result)
+		{
+			_entityCodeCacheState.snippets.merge(_entityCodeCacheState.previousSnippets);
+		}
+
+		entityCodeCache->storeFileSnippets(parsingResult.parsedFile, std::move(_entityCodeCacheState.snippets));
+
+		_entityCodeCacheState = EntityCodeCacheState();
+	}
+
 	return result;
 }
 
@@ -183,6 +234,11 @@ bool CodeGenUnit::finalGenerateCodeInternal(std::vector<ICodeGenerator*> const&
 
 ETraversalBehaviour	CodeGenUnit::generateCodeForEntityInternal(ICodeGenerator& codeGenerator, EntityInfo const& entity, CodeGenEnv& env, void const* data) noexcept
 {
+	if (_entityCodeCacheState.cache != nullptr && codeGenerator.getCacheFingerprint() != 0u)
+	{
+		return generateCachedCodeForEntityInternal(codeGenerator, entity, env, data);
+	}
+
 	ETraversalBehaviour result = CodeGenHelpers::leastPrioritizedTraversalBehaviour;
 
 	auto generateLambda = [&result, &codeGenerator, &data](EntityInfo const& entity, CodeGenEnv& env, std::string& inout_result)
@@ -196,6 +252,92 @@ ETraversalBehaviour	CodeGenUnit::generateCodeForEntityInternal(ICodeGenerator& c
 	return result;
 }
 
+ETraversalBehaviour CodeGenUnit::generateCachedCodeForEntityInternal(ICodeGenerator& codeGenerator, EntityInfo const& entity, CodeGenEnv& env, void const* data) noexcept
+{
+	EntityCodeCacheState& state = _entityCodeCacheState;
+
+	//Property code generators visit an entity once per property, consecutively
+	if (&codeGenerator == state.lastVisitedCodeGenerator && &entity == state.lastVisitedEntity)
+	{
+		state.visitIndex++;
+	}
+	else
+	{
+		state.lastVisitedCodeGenerator	= &codeGenerator;
+		state.lastVisitedEntity			= &entity;
+		state.visitIndex				= 0u;
+	}
+
+	uint64 key = EntityCodeCache::computeSnippetKey(EntityCodeCache::computeEntityHash(entity, state.entityHashes), codeGenerator, state.visitIndex);
+
+	auto it = state.snippets.find(key);
+
+	if (it == state.snippets.end())
+	{
+		auto previousIt = state.previousSnippets.find(key);
+
+		if (previousIt != state.previousSnippets.end())
+		{
+			it = state.snippets.emplace(key, std::move(previousIt->second)).first;
+			state.previousSnippets.erase(previousIt);
+		}
+	}
+
+	//Replay the cached code, the unit still dispatches each code to its location
+	if (it != state.snippets.end())
+	{
+		EntityCodeCache::Snippet const&	snippet		= it->second;
+		size_t							codeIndex	= 0u;
+
+		auto replayLambda = [&snippet, &codeIndex](EntityInfo const& /* entity */, CodeGenEnv& /* env */, std::string& inout_result)
+		{
+			if (codeIndex < snippet.codes.size())
+			{
+				inout_result += snippet.codes[codeIndex];
+			}
+
+			codeIndex++;
+		};
+
+		generateCodeForEntity(entity, env, replayLambda);
+
+		return snippet.traversalBehaviour;
+	}
+
+	ETraversalBehaviour			result		= CodeGenHelpers::leastPrioritizedTraversalBehaviour;
+	EntityCodeCache::Snippet	snippet;
+	bool						isCacheable	= true;
+
+	auto generateLambda = [&result, &codeGenerator, &data, &snippet, &isCacheable](EntityInfo const& entity, CodeGenEnv& env, std::string& inout_result)
+	{
+		std::string::size_type initialSize = inout_result.size();
+
+		result = CodeGenHelpers::combineTraversalBehaviours(result, codeGenerator.generateCodeForEntity(entity, env, inout_result, data));
+
+		//Only appended code can be replayed
+		if (inout_result.size() >= initialSize)
+		{
+			snippet.codes.emplace_back(inout_result, initialSize);
+		}
+		else
+		{
+			isCacheable = false;
+		}
+	};
+
+	generateCodeForEntity(entity, env, generateLambda);
+
+	//Failures are not cached so that they are reported again by the next generation
+	if (isCacheable && result != ETraversalBehaviour::AbortWithFailure)
+	{
+		snippet.traversalBehaviour = result;
+
+		state.snippets.emplace(key, std::move(snippet));
+	}
+
+	return result;
+}
+
 void CodeGenUnit::sortedInsert(std::vector<ICodeGenerator*>& vector, ICodeGenerator& codeGen) noexcept
 {
 	vector.insert
@@ -255,6 +397,9 @@ ETraversalBehaviour CodeGenUnit::foreachCodeGenEntityPair(std::function<ETravers
 	//Call visitor on all code generators
 	for (ICodeGenerator* codeGenerator : getSortedCodeGenerators())
 	{
+		//Span named after the dynamic type of the code generator, demangled when the report is exported
+		ScopedTimingSpan span(env.getTimingReport(), "Module", typeid(*codeGenerator).name(), env.getFileParsingResult()->parsedFile.string());
+
 		for (NamespaceInfo const& namespace_ : env.getFileParsingResult()->namespaces)
 		{
 			result = foreachCodeGenEntityPairInNamespace(*codeGenerator, namespace_, env, visitor);
@@ -493,6 +638,35 @@ uint8 CodeGenUnit::getIterationCount() const noexcept
 	}
 }
 
+uint64 CodeGenUnit::getCacheFingerprint() const noexcept
+{
+	std::vector<ICodeGenerator*> codeGenerators = getSortedCodeGenerators();
+
+	if (codeGenerators.empty())
+	{
+		return 0u;
+	}
+
+	uint64 fingerprint = HashHelpers::initialHash;
+
+	for (ICodeGenerator const* codeGenerator : codeGenerators)
+	{
+		uint64 codeGeneratorFingerprint = codeGenerator->getCacheFingerprint();
+
+		if (codeGeneratorFingerprint == 0u)
+		{
+			return 0u;
+		}
+
+		//The type name distinguishes generators which happen to use the same fingerprint
+		fingerprint = HashHelpers::hashString(fingerprint, typeid(*codeGenerator).name());
+		fingerprint = HashHelpers::hashValue(fingerprint, codeGeneratorFingerprint);
+	}
+
+	//0 is reserved for units which can't be cached
+	return (fingerprint != 0u) ? fingerprint : 1u;
+}
+
 std::vector<CodeGenModule*>	const& CodeGenUnit::getRegisteredCodeGenModules() const noexcept
 {
 	return _generationModules;
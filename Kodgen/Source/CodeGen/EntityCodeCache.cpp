@@ -0,0 +1,399 @@
+#include "Kodgen/CodeGen/EntityCodeCache.h"
+
+#include <fstream>
+#include <sstream>
+#include <typeinfo>
+#include <type_traits>	//std::is_same_v, std::decay_t
+
+#include "Kodgen/CodeGen/ICodeGenerator.h"
+#include "Kodgen/InfoStructures/NamespaceInfo.h"
+#include "Kodgen/InfoStructures/NestedStructClassInfo.h"
+#include "Kodgen/Misc/HashHelpers.h"
+
+using namespace kodgen;
+
+uint64 EntityCodeCache::hashType(uint64 hash, TypeInfo const& type) noexcept
+{
+	//The template parameters are part of the names
+	hash = HashHelpers::hashString(hash, type.getName());
+	hash = HashHelpers::hashString(hash, type.getCanonicalName());
+
+	return HashHelpers::hashValue(hash, type.sizeInBytes);
+}
+
+uint64 EntityCodeCache::hashEntityData(uint64 hash, EntityInfo const& entity) noexcept
+{
+	switch (entity.entityType)
+	{
+		case EEntityType::Field:
+			{
+				FieldInfo const& field = static_cast<FieldInfo const&>(entity);
+
+				hash = HashHelpers::hashValue(hash, static_cast<uint64>(field.accessSpecifier));
+				hash = HashHelpers::hashValue(hash, static_cast<uint64>(field.memoryOffset));
+				hash = HashHelpers::hashValue(hash, field.isMutable);
+			}
+			[[fallthrough]];
+
+		case EEntityType::Variable:
+			{
+				VariableInfo const& variable = static_cast<VariableInfo const&>(entity);
+
+				hash = hashType(hash, variable.type);
+				hash = HashHelpers::hashValue(hash, variable.isStatic);
+			}
+			break;
+
+		case EEntityType::Method:
+			{
+				MethodInfo const& method = static_cast<MethodInfo const&>(entity);
+
+				hash = HashHelpers::hashValue(hash, static_cast<uint64>(method.accessSpecifier));
+				hash = HashHelpers::hashValue(hash, (method.isDefault << 0) | (method.isVirtual << 1) | (method.isPureVirtual << 2) |
+									   (method.isOverride << 3) | (method.isFinal << 4) | (method.isConst << 5));
+			}
+			[[fallthrough]];
+
+		case EEntityType::Function:
+			{
+				FunctionInfo const& function = static_cast<FunctionInfo const&>(entity);
+
+				hash = HashHelpers::hashString(hash, function.prototype);
+				hash = hashType(hash, function.returnType);
+				hash = HashHelpers::hashValue(hash, (function.isInline << 0) | (function.isStatic << 1));
+				hash = HashHelpers::hashValue(hash, function.parameters.size());
+
+				for (FunctionParamInfo const& parameter : function.parameters)
+				{
+					hash = hashType(hash, parameter.type);
+					hash = HashHelpers::hashString(hash, parameter.name);
+				}
+			}
+			break;
+
+		case EEntityType::EnumValue:
+			hash = HashHelpers::hashValue(hash, static_cast<uint64>(static_cast<EnumValueInfo const&>(entity).value));
+			break;
+
+		case EEntityType::Enum:
+			{
+				EnumInfo const& enumInfo = static_cast<EnumInfo const&>(entity);
+
+				hash = hashType(hash, enumInfo.type);
+				hash = hashType(hash, enumInfo.underlyingType);
+
+				//Enums declared in a struct/class are NestedEnumInfo
+				if (entity.outerEntity != nullptr && (entity.outerEntity->entityType == EEntityType::Struct || entity.outerEntity->entityType == EEntityType::Class))
+				{
+					hash = HashHelpers::hashValue(hash, static_cast<uint64>(static_cast<NestedEnumInfo const&>(entity).accessSpecifier));
+				}
+			}
+			break;
+
+		case EEntityType::Struct:
+			[[fallthrough]];
+		case EEntityType::Class:
+			{
+				StructClassInfo const& structClass = static_cast<StructClassInfo const&>(entity);
+
+				hash = hashType(hash, structClass.type);
+				hash = HashHelpers::hashValue(hash, (structClass.qualifiers.isFinal << 0) | (structClass.isForwardDeclaration << 1) | (structClass.isImportExport << 2));
+				hash = HashHelpers::hashValue(hash, structClass.parents.size());
+
+				for (StructClassInfo::ParentInfo const& parent : structClass.parents)
+				{
+					hash = HashHelpers::hashValue(hash, static_cast<uint64>(parent.inheritanceAccess));
+					hash = hashType(hash, parent.type);
+				}
+
+				//Structs/classes declared in a struct/class are NestedStructClassInfo
+				if (entity.outerEntity != nullptr && (entity.outerEntity->entityType == EEntityType::Struct || entity.outerEntity->entityType == EEntityType::Class))
+				{
+					hash = HashHelpers::hashValue(hash, static_cast<uint64>(static_cast<NestedStructClassInfo const&>(entity).accessSpecifier));
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+
+	return hash;
+}
+
+uint64 EntityCodeCache::hashProperties(uint64 hash, EntityInfo const& entity) noexcept
+{
+	hash = HashHelpers::hashValue(hash, entity.properties.size());
+
+	for (Property const& property : entity.properties)
+	{
+		hash = HashHelpers::hashString(hash, property.name);
+		hash = HashHelpers::hashValue(hash, property.arguments.size());
+
+		for (std::string const& argument : property.arguments)
+		{
+			hash = HashHelpers::hashString(hash, argument);
+		}
+	}
+
+	return hash;
+}
+
+uint64 EntityCodeCache::computeEntityHash(EntityInfo const& entity, std::unordered_map<EntityInfo const*, uint64>& inout_hashes) noexcept
+{
+	auto it = inout_hashes.find(&entity);
+
+	if (it != inout_hashes.cend())
+	{
+		return it->second;
+	}
+
+	uint64 hash = HashHelpers::initialHash;
+
+	hash = HashHelpers::hashValue(hash, static_cast<uint64>(entity.entityType));
+	hash = HashHelpers::hashString(hash, entity.name);
+	hash = HashHelpers::hashString(hash, entity.id);
+
+	//Generated code often refers to the outer entities and checks their properties
+	hash = HashHelpers::hashString(hash, entity.getFullName());
+	hash = hashProperties(hash, entity);
+
+	for (EntityInfo const* outerEntity = entity.outerEntity; outerEntity != nullptr; outerEntity = outerEntity->outerEntity)
+	{
+		hash = hashProperties(hash, *outerEntity);
+	}
+
+	hash = hashEntityData(hash, entity);
+
+	//Nested entities
+	auto hashChildren = [&hash, &inout_hashes](auto const& children)
+	{
+		hash = HashHelpers::hashValue(hash, children.size());
+
+		for (auto const& child : children)
+		{
+			if constexpr (std::is_same_v<std::decay_t<decltype(child)>, std::shared_ptr<NestedStructClassInfo>>)
+			{
+				hash = HashHelpers::hashValue(hash, computeEntityHash(*child, inout_hashes));
+			}
+			else
+			{
+				hash = HashHelpers::hashValue(hash, computeEntityHash(child, inout_hashes));
+			}
+		}
+	};
+
+	switch (entity.entityType)
+	{
+		case EEntityType::Namespace:
+			{
+				NamespaceInfo const& namespaceInfo = static_cast<NamespaceInfo const&>(entity);
+
+				hashChildren(namespaceInfo.namespaces);
+				hashChildren(namespaceInfo.structs);
+				hashChildren(namespaceInfo.classes);
+				hashChildren(namespaceInfo.enums);
+				hashChildren(namespaceInfo.variables);
+				hashChildren(namespaceInfo.functions);
+			}
+			break;
+
+		case EEntityType::Struct:
+			[[fallthrough]];
+		case EEntityType::Class:
+			{
+				StructClassInfo const& structClass = static_cast<StructClassInfo const&>(entity);
+
+				hashChildren(structClass.nestedStructs);
+				hashChildren(structClass.nestedClasses);
+				hashChildren(structClass.nestedEnums);
+				hashChildren(structClass.fields);
+				hashChildren(structClass.methods);
+			}
+			break;
+
+		case EEntityType::Enum:
+			hashChildren(static_cast<EnumInfo const&>(entity).enumValues);
+			break;
+
+		default:
+			break;
+	}
+
+	inout_hashes.emplace(&entity, hash);
+
+	return hash;
+}
+
+uint64 EntityCodeCache::computeSnippetKey(uint64 entityHash, ICodeGenerator const& codeGenerator, uint32 visitIndex) noexcept
+{
+	//The type name distinguishes generators which happen to use the same fingerprint
+	char const* generatorTypeName = typeid(codeGenerator).name();
+
+	uint64 key = HashHelpers::hashString(entityHash, generatorTypeName);
+
+	key = HashHelpers::hashValue(key, codeGenerator.getCacheFingerprint());
+
+	return HashHelpers::hashValue(key, visitIndex);
+}
+
+bool EntityCodeCache::load(fs::path const& cacheFile) noexcept
+{
+	clear();
+
+	std::ifstream	stream(cacheFile, std::ios::in | std::ios::binary);
+	std::string		line;
+
+	if (!std::getline(stream, line) || line != _header)
+	{
+		return false;
+	}
+
+	FileSnippets* currentFileSnippets = nullptr;
+
+	//Each line is a kind followed by a value, snippet codes are stored raw after their size
+	while (std::getline(stream, line))
+	{
+		if (line.size() < 2u || line[1] != ' ')
+		{
+			clear();
+
+			return false;
+		}
+
+		if (line[0] == 'F')
+		{
+			currentFileSnippets = &_fileSnippets[line.substr(2u)];
+		}
+		else if (line[0] == 'S' && currentFileSnippets != nullptr)
+		{
+			std::istringstream	valueStream(line.substr(2u));
+			uint64				key					= 0u;
+			uint32				traversalBehaviour	= 0u;
+			size_t				codeCount			= 0u;
+
+			if (!(valueStream >> key >> traversalBehaviour >> codeCount))
+			{
+				clear();
+
+				return false;
+			}
+
+			Snippet& snippet = (*currentFileSnippets)[key];
+
+			snippet.traversalBehaviour = static_cast<ETraversalBehaviour>(traversalBehaviour);
+			snippet.codes.resize(codeCount);
+
+			for (std::string& code : snippet.codes)
+			{
+				size_t codeSize = 0u;
+
+				if (!std::getline(stream, line) || !(std::istringstream(line) >> codeSize))
+				{
+					clear();
+
+					return false;
+				}
+
+				code.resize(codeSize);
+
+				//Codes are followed by a line break to keep the file readable
+				if (!stream.read(code.data(), static_cast<std::streamsize>(codeSize)) || stream.get() != '\n')
+				{
+					clear();
+
+					return false;
+				}
+			}
+		}
+		else
+		{
+			clear();
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool EntityCodeCache::save(fs::path const& cacheFile) const noexcept
+{
+	std::ofstream stream(cacheFile, std::ios::out | std::ios::trunc | std::ios::binary);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	stream << _header << "\n";
+
+	for (auto const& [sourceFile, fileSnippets] : _fileSnippets)
+	{
+		if (fileSnippets.empty())
+		{
+			continue;
+		}
+
+		stream << "F " << sourceFile.string() << "\n";
+
+		for (auto const& [key, snippet] : fileSnippets)
+		{
+			stream << "S " << key << " " << static_cast<uint32>(snippet.traversalBehaviour) << " " << snippet.codes.size() << "\n";
+
+			for (std::string const& code : snippet.codes)
+			{
+				stream << code.size() << "\n";
+				stream.write(code.data(), static_cast<std::streamsize>(code.size()));
+				stream << "\n";
+			}
+		}
+	}
+
+	return stream.good();
+}
+
+EntityCodeCache::FileSnippets EntityCodeCache::takeFileSnippets(fs::path const& sourceFile) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _fileSnippets.find(sourceFile);
+
+	if (it == _fileSnippets.cend())
+	{
+		return FileSnippets();
+	}
+
+	FileSnippets result = std::move(it->second);
+
+	_fileSnippets.erase(it);
+
+	return result;
+}
+
+void EntityCodeCache::storeFileSnippets(fs::path const& sourceFile, FileSnippets&& snippets) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_fileSnippets[sourceFile] = std::move(snippets);
+}
+
+void EntityCodeCache::prune(std::function<bool(fs::path const&)> const& shouldKeep) noexcept
+{
+	for (auto it = _fileSnippets.begin(); it != _fileSnippets.end();)
+	{
+		if (shouldKeep(it->first))
+		{
+			++it;
+		}
+		else
+		{
+			it = _fileSnippets.erase(it);
+		}
+	}
+}
+
+void EntityCodeCache::clear() noexcept
+{
+	_fileSnippets.clear();
+}
\ No newline at end of file
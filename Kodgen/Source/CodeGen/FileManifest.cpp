@@ -0,0 +1,288 @@
+#include "Kodgen/CodeGen/FileManifest.h"
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>	//std::sort
+#include <random>		//std::random_device
+
+using namespace kodgen;
+
+bool FileManifest::load(fs::path const& manifestFile) noexcept
+{
+	_entries.clear();
+
+	std::ifstream	stream(manifestFile);
+	std::string		line;
+
+	if (!std::getline(stream, line) || line != _header)
+	{
+		return false;
+	}
+
+	Entry* currentEntry = nullptr;
+
+	while (std::getline(stream, line))
+	{
+		std::istringstream	lineStream(line);
+		char				kind = '\0';
+
+		lineStream >> kind;
+
+		if (kind == 'C')
+		{
+			//Durations of the last source file
+			if (currentEntry != nullptr)
+			{
+				lineStream >> currentEntry->parseDuration >> currentEntry->generationDuration;
+
+				//The translation unit memory was added later, manifests without it are still valid
+				if (!lineStream.fail() && !(lineStream >> currentEntry->translationUnitMemory))
+				{
+					currentEntry->translationUnitMemory = 0u;
+					lineStream.clear();
+				}
+			}
+		}
+		else
+		{
+			FileStatus	status;
+			std::string	path;
+
+			lineStream >> status.size >> status.lastWriteTime >> status.inode;
+
+			//Path is the end of the line since it can contain spaces
+			lineStream.get();
+			std::getline(lineStream, path);
+
+			if (path.empty())
+			{
+				lineStream.setstate(std::ios::failbit);
+			}
+			else if (kind == 'S')
+			{
+				currentEntry = &_entries[path];
+				currentEntry->sourceStatus = status;
+			}
+			else if (kind == 'G' && currentEntry != nullptr)
+			{
+				currentEntry->generatedFiles.emplace_back(path, status);
+			}
+		}
+
+		if (lineStream.fail())
+		{
+			_entries.clear();
+
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool FileManifest::save(fs::path const& manifestFile) const noexcept
+{
+	//The manifest is written to a temporary file then renamed, so that an interrupted run never leaves a truncated manifest.
+	//A random suffix keeps processes writing the same manifest from sharing the temporary file
+	std::random_device	randomDevice;
+	fs::path			temporaryPath = manifestFile;
+
+	temporaryPath += "." + std::to_string((static_cast<uint64>(randomDevice()) << 32) | randomDevice()) + ".tmp";
+
+	bool written = false;
+
+	{
+		std::ofstream stream(temporaryPath, std::ios::out | std::ios::trunc);
+
+		if (!stream.is_open())
+		{
+			return false;
+		}
+
+		stream << _header << "\n";
+
+		for (auto const& [sourceFile, entry] : _entries)
+		{
+			stream << "S " << entry.sourceStatus.size << " " << entry.sourceStatus.lastWriteTime << " " << entry.sourceStatus.inode << " " << sourceFile.string() << "\n";
+			stream << "C " << entry.parseDuration << " " << entry.generationDuration << " " << entry.translationUnitMemory << "\n";
+
+			for (auto const& [generatedFile, generatedStatus] : entry.generatedFiles)
+			{
+				stream << "G " << generatedStatus.size << " " << generatedStatus.lastWriteTime << " " << generatedStatus.inode << " " << generatedFile.string() << "\n";
+			}
+		}
+
+		stream.flush();
+		written = stream.good();
+	}
+
+	std::error_code errorCode;
+
+	if (written)
+	{
+		fs::rename(temporaryPath, manifestFile, errorCode);
+
+		if (!errorCode)
+		{
+			return true;
+		}
+	}
+
+	fs::remove(temporaryPath, errorCode);
+
+	return false;
+}
+
+bool FileManifest::isUpToDate(fs::path const& sourceFile, FileStatus const& sourceStatus, std::vector<fs::path> const& generatedFiles) const noexcept
+{
+	auto it = _entries.find(sourceFile);
+
+	if (it == _entries.cend() || it->second.generatedFiles.empty() ||
+		it->second.sourceStatus != sourceStatus || it->second.generatedFiles.size() != generatedFiles.size())
+	{
+		return false;
+	}
+
+	for (size_t i = 0u; i < generatedFiles.size(); i++)
+	{
+		FileStatus generatedStatus;
+
+		//Generated files must be the expected ones and must not have been touched since they were recorded
+		if (it->second.generatedFiles[i].first != generatedFiles[i] ||
+			!FileStatus::query(generatedFiles[i], generatedStatus) ||
+			it->second.generatedFiles[i].second != generatedStatus)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void FileManifest::update(fs::path const& sourceFile, FileStatus const& sourceStatus, std::vector<fs::path> const& generatedFiles) noexcept
+{
+	Entry entry;
+	entry.sourceStatus = sourceStatus;
+	entry.generatedFiles.reserve(generatedFiles.size());
+
+	for (fs::path const& generatedFile : generatedFiles)
+	{
+		FileStatus generatedStatus;
+
+		//Don't record any generated file if one is missing so that the source is checked again by the CodeGenUnit next time
+		if (!FileStatus::query(generatedFile, generatedStatus))
+		{
+			entry.generatedFiles.clear();
+
+			break;
+		}
+
+		entry.generatedFiles.emplace_back(generatedFile, generatedStatus);
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	Entry& recordedEntry = _entries[sourceFile];
+
+	//Durations are kept, they are only updated when the file is processed
+	recordedEntry.sourceStatus		= entry.sourceStatus;
+	recordedEntry.generatedFiles	= std::move(entry.generatedFiles);
+}
+
+void FileManifest::setDurations(fs::path const& sourceFile, uint64 parseDuration, uint64 generationDuration) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _entries.find(sourceFile);
+
+	if (it != _entries.end())
+	{
+		it->second.parseDuration		= parseDuration;
+		it->second.generationDuration	= generationDuration;
+	}
+}
+
+bool FileManifest::getDurations(fs::path const& sourceFile, uint64& out_parseDuration, uint64& out_generationDuration) const noexcept
+{
+	auto it = _entries.find(sourceFile);
+
+	if (it == _entries.cend() || it->second.parseDuration + it->second.generationDuration == 0u)
+	{
+		return false;
+	}
+
+	out_parseDuration		= it->second.parseDuration;
+	out_generationDuration	= it->second.generationDuration;
+
+	return true;
+}
+
+void FileManifest::setTranslationUnitMemory(fs::path const& sourceFile, uint64 translationUnitMemory) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	auto it = _entries.find(sourceFile);
+
+	if (it != _entries.end())
+	{
+		it->second.translationUnitMemory = translationUnitMemory;
+	}
+}
+
+uint64 FileManifest::getTranslationUnitMemory(fs::path const& sourceFile) const noexcept
+{
+	auto it = _entries.find(sourceFile);
+
+	return (it != _entries.cend()) ? it->second.translationUnitMemory : 0u;
+}
+
+bool FileManifest::isInvalidated(fs::path const& sourceFile) const noexcept
+{
+	auto it = _entries.find(sourceFile);
+
+	//Entries recorded without any generated file keep the status of their source file
+	return it != _entries.cend() && it->second.generatedFiles.empty() && it->second.sourceStatus == FileStatus();
+}
+
+void FileManifest::invalidate(fs::path const& sourceFile) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	Entry& entry = _entries[sourceFile];
+
+	//An entry without any generated file never matches, but durations are kept to estimate the next processing cost
+	entry.sourceStatus = FileStatus();
+	entry.generatedFiles.clear();
+}
+
+std::vector<fs::path> FileManifest::prune(std::function<bool(fs::path const&)> const& shouldKeep) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	std::vector<fs::path> removedFiles;
+
+	for (auto it = _entries.begin(); it != _entries.end();)
+	{
+		if (shouldKeep(it->first))
+		{
+			it++;
+		}
+		else
+		{
+			removedFiles.push_back(it->first);
+			it = _entries.erase(it);
+		}
+	}
+
+	//Keep a stable order regardless of the entries hashing
+	std::sort(removedFiles.begin(), removedFiles.end());
+
+	return removedFiles;
+}
+
+void FileManifest::clear() noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_entries.clear();
+}
\ No newline at end of file
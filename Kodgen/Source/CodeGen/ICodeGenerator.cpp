@@ -10,4 +10,10 @@ int32 ICodeGenerator::getGenerationOrder() const noexcept
 uint8 ICodeGenerator::getIterationCount() const noexcept
 {
 	return 1u;
+}
+
+uint64 ICodeGenerator::getCacheFingerprint() const noexcept
+{
+	//Generated code is not cached by default
+	return 0u;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "Kodgen/CodeGen/CodeGenHelpers.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h"
 #include "Kodgen/CodeGen/Macro/MacroCodeGenModule.h"
+#include "Kodgen/Misc/HashHelpers.h"
 
 using namespace kodgen;
 
@@ -131,19 +132,30 @@ void MacroCodeGenUnit::generateHeaderFile(MacroCodeGenEnv& env) noexcept
 
 	//Write all struct/class footer macros
 	//We must iterate over all structs/class from scratch since registered generators are not guaranteed to traverse all struct/class
-	env.getFileParsingResult()->foreachEntityOfType(EEntityType::Class | EEntityType::Struct,
-													[this, &generatedHeader, castSettings](EntityInfo const& entity)
-													{
-														//Cast is safe since we only iterate on structs & classes
-														StructClassInfo const* struct_ = reinterpret_cast<StructClassInfo const*>(&entity);
+	auto writeClassFooter = [this, &generatedHeader, castSettings](EntityInfo const& entity)
+	{
+		//Cast is safe since we only iterate on structs & classes
+		StructClassInfo const* struct_ = reinterpret_cast<StructClassInfo const*>(&entity);
+
+		if (!struct_->isForwardDeclaration)
+		{
+			auto it = _classFooterGeneratedCode.find(struct_);
+
+			generatedHeader.writeMacro(castSettings->getClassFooterMacro(*struct_), (it != _classFooterGeneratedCode.end()) ? std::move(it->second) : std::string());
+		}
+	};
 
-														if (!struct_->isForwardDeclaration)
-														{
-															auto it = _classFooterGeneratedCode.find(struct_);
+	//The flat entity table is faster to filter, but is not filled for results which were not built by a FileParser
+	FileParsingResult const* parsingResult = env.getFileParsingResult();
 
-															generatedHeader.writeMacro(castSettings->getClassFooterMacro(*struct_), (it != _classFooterGeneratedCode.end()) ? std::move(it->second) : std::string());
-														}
-													});
+	if (!parsingResult->entityTable.empty())
+	{
+		parsingResult->entityTable.foreachEntityOfType(EEntityType::Class | EEntityType::Struct, writeClassFooter);
+	}
+	else
+	{
+		parsingResult->foreachEntityOfType(EEntityType::Class | EEntityType::Struct, writeClassFooter);
+	}
 
 	//Write header file footer code
 	generatedHeader.writeMacro(castSettings->getHeaderFileFooterMacro(env.getFileParsingResult()->parsedFile),
@@ -152,7 +164,21 @@ void MacroCodeGenUnit::generateHeaderFile(MacroCodeGenEnv& env) noexcept
 
 void MacroCodeGenUnit::generateSourceFile(MacroCodeGenEnv& env) noexcept
 {
-	GeneratedFile generatedFile(getGeneratedSourceFilePath(env.getFileParsingResult()->parsedFile), env.getFileParsingResult()->parsedFile);
+	fs::path const& parsedFile = env.getFileParsingResult()->parsedFile;
+
+	if (getSettings()->getAmalgamationMode() != EAmalgamationMode::None)
+	{
+		fs::path amalgamationFilePath = getGeneratedSourceFilePath(parsedFile);
+
+		//Include the header file from the amalgamation file, the code is written once all files have been processed
+		_amalgamatedFileWriter->addFragment(amalgamationFilePath, parsedFile,
+											"#include \"" + FilesystemHelpers::normalizeSeparator(parsedFile.lexically_relative(amalgamationFilePath.parent_path())).string() + "\"\n\n" +
+											std::move(_generatedCodePerLocation[static_cast<int>(ECodeGenLocation::SourceFileHeader)]));
+
+		return;
+	}
+
+	GeneratedFile generatedFile(getGeneratedSourceFilePath(parsedFile), parsedFile);
 
 	generatedFile.writeLine("#pragma once\n");
 
@@ -205,7 +231,53 @@ fs::path MacroCodeGenUnit::getGeneratedHeaderFilePath(fs::path const& sourceFile
 
 fs::path MacroCodeGenUnit::getGeneratedSourceFilePath(fs::path const& sourceFile) const noexcept
 {
-	return settings->getOutputDirectory() / getSettings()->getGeneratedSourceFileName(sourceFile);
+	return settings->getOutputDirectory() / ((getSettings()->getAmalgamationMode() != EAmalgamationMode::None) ?
+												getSettings()->getAmalgamationFileName(sourceFile) :
+												getSettings()->getGeneratedSourceFileName(sourceFile));
+}
+
+std::vector<fs::path> MacroCodeGenUnit::getGeneratedFilePaths(fs::path const& sourceFile) const noexcept
+{
+	return { getGeneratedHeaderFilePath(sourceFile), getGeneratedSourceFilePath(sourceFile) };
+}
+
+uint64 MacroCodeGenUnit::getCacheFingerprint() const noexcept
+{
+	MacroCodeGenUnitSettings const*	castSettings	= getSettings();
+	uint64							fingerprint		= CodeGenUnit::getCacheFingerprint();
+
+	//Amalgamation files gather the code generated from several source files
+	if (fingerprint == 0u || castSettings->getAmalgamationMode() != EAmalgamationMode::None)
+	{
+		return 0u;
+	}
+
+	fingerprint = HashHelpers::hashString(fingerprint, castSettings->getGeneratedHeaderFileNamePattern());
+	fingerprint = HashHelpers::hashString(fingerprint, castSettings->getGeneratedSourceFileNamePattern());
+	fingerprint = HashHelpers::hashString(fingerprint, castSettings->getClassFooterMacroPattern());
+	fingerprint = HashHelpers::hashString(fingerprint, castSettings->getHeaderFileFooterMacroPattern());
+	fingerprint = HashHelpers::hashString(fingerprint, castSettings->getExportSymbolMacroName());
+	fingerprint = HashHelpers::hashString(fingerprint, castSettings->getInternalSymbolMacroName());
+
+	return (fingerprint != 0u) ? fingerprint : 1u;
+}
+
+void MacroCodeGenUnit::preProcessFiles(std::vector<fs::path> const& removedFiles) noexcept
+{
+	_amalgamatedFileWriter->clear();
+
+	if (getSettings()->getAmalgamationMode() != EAmalgamationMode::None)
+	{
+		for (fs::path const& removedFile : removedFiles)
+		{
+			_amalgamatedFileWriter->removeFragment(getGeneratedSourceFilePath(removedFile), removedFile);
+		}
+	}
+}
+
+bool MacroCodeGenUnit::postProcessFiles() noexcept
+{
+	return _amalgamatedFileWriter->writeFiles(logger);
 }
 
 void MacroCodeGenUnit::addModule(MacroCodeGenModule& generationModule) noexcept
@@ -3,9 +3,13 @@
 #include <algorithm>
 #include <locale>		//std::isalpha
 #include <cctype>		//std::isdigit
+#include <sstream>
+#include <iomanip>		//std::setw, std::setfill
+#include <unordered_set>
 
 #include "Kodgen/InfoStructures/StructClassInfo.h"
 #include "Kodgen/Misc/TomlUtility.h"
+#include "Kodgen/Misc/HashHelpers.h"
 
 using namespace kodgen;
 
@@ -20,6 +24,7 @@ bool MacroCodeGenUnitSettings::loadSettingsValues(toml::value const& tomlData, I
 		loadHeaderFileFooterMacroPattern(tomlMacroCGUSettings, logger);
 		loadExportSymbolMacroName(tomlMacroCGUSettings, logger);
 		loadInternalSymbolMacroName(tomlMacroCGUSettings, logger);
+		loadAmalgamationSettings(tomlMacroCGUSettings, logger);
 
 		return true;
 	}
@@ -118,6 +123,86 @@ void MacroCodeGenUnitSettings::loadInternalSymbolMacroName(toml::value const& ge
 	}
 }
 
+void MacroCodeGenUnitSettings::loadAmalgamationSettings(toml::value const& generationSettings, ILogger* logger) noexcept
+{
+	std::string amalgamationMode;
+
+	//Load amalgamation mode
+	if (TomlUtility::updateSetting(generationSettings, "amalgamationMode", amalgamationMode, logger))
+	{
+		if (amalgamationMode == "None")
+		{
+			setAmalgamationMode(EAmalgamationMode::None);
+		}
+		else if (amalgamationMode == "PerDirectory")
+		{
+			setAmalgamationMode(EAmalgamationMode::PerDirectory);
+		}
+		else if (amalgamationMode == "Single")
+		{
+			setAmalgamationMode(EAmalgamationMode::Single);
+		}
+		else if (amalgamationMode == "PerModule")
+		{
+			setAmalgamationMode(EAmalgamationMode::PerModule);
+		}
+		else
+		{
+			if (logger != nullptr)
+			{
+				logger->log("[TOML] Failed to load amalgamation mode: " + amalgamationMode + " is not supported. Supported values are None, PerDirectory, Single and PerModule.", ILogger::ELogSeverity::Warning);
+			}
+
+			amalgamationMode.clear();
+		}
+
+		if (logger != nullptr && !amalgamationMode.empty())
+		{
+			logger->log("[TOML] Load amalgamation mode: " + amalgamationMode);
+		}
+	}
+
+	std::string amalgamationFileNamePattern;
+
+	//Load amalgamation file name pattern
+	if (TomlUtility::updateSetting(generationSettings, "amalgamationFileNamePattern", amalgamationFileNamePattern, logger))
+	{
+		setAmalgamationFileNamePattern(amalgamationFileNamePattern);
+
+		if (logger != nullptr)
+		{
+			logger->log("[TOML] Load amalgamation file name pattern: " + _amalgamationFileNamePattern);
+		}
+	}
+
+	std::unordered_set<fs::path, PathHash> moduleDirectories;
+
+	//Load amalgamation module directories
+	if (TomlUtility::updateSetting(generationSettings, "amalgamationModuleDirectories", moduleDirectories, logger))
+	{
+		clearAmalgamationModuleDirectories();
+
+		for (fs::path const& directory : moduleDirectories)
+		{
+			if (logger != nullptr)
+			{
+				if (addAmalgamationModuleDirectory(directory))
+				{
+					logger->log("[TOML] Load amalgamation module directory: " + _amalgamationModuleDirectories.back().string());
+				}
+				else
+				{
+					logger->log("[TOML] Failed to add amalgamation module directory as it doesn't exist, is not a directory or is already part of the list: " + directory.string(), ILogger::ELogSeverity::Warning);
+				}
+			}
+			else
+			{
+				addAmalgamationModuleDirectory(directory);
+			}
+		}
+	}
+}
+
 void MacroCodeGenUnitSettings::setGeneratedHeaderFileNamePattern(std::string const& generatedHeaderFileNamePattern) noexcept
 {
 	_generatedHeaderFileNamePattern = generatedHeaderFileNamePattern;
@@ -148,6 +233,36 @@ void MacroCodeGenUnitSettings::setInternalSymbolMacroName(std::string const& int
 	_internalSymbolMacroName = internalSymbolMacroName;
 }
 
+void MacroCodeGenUnitSettings::setAmalgamationMode(EAmalgamationMode amalgamationMode) noexcept
+{
+	_amalgamationMode = amalgamationMode;
+}
+
+void MacroCodeGenUnitSettings::setAmalgamationFileNamePattern(std::string const& amalgamationFileNamePattern) noexcept
+{
+	_amalgamationFileNamePattern = amalgamationFileNamePattern;
+}
+
+bool MacroCodeGenUnitSettings::addAmalgamationModuleDirectory(fs::path const& directory) noexcept
+{
+	fs::path sanitizedDirectory = FilesystemHelpers::sanitizePath(directory);
+
+	if (sanitizedDirectory.empty() || !fs::is_directory(sanitizedDirectory) ||
+		std::find(_amalgamationModuleDirectories.cbegin(), _amalgamationModuleDirectories.cend(), sanitizedDirectory) != _amalgamationModuleDirectories.cend())
+	{
+		return false;
+	}
+
+	_amalgamationModuleDirectories.push_back(std::move(sanitizedDirectory));
+
+	return true;
+}
+
+void MacroCodeGenUnitSettings::clearAmalgamationModuleDirectories() noexcept
+{
+	_amalgamationModuleDirectories.clear();
+}
+
 std::string const& MacroCodeGenUnitSettings::getGeneratedHeaderFileNamePattern() const noexcept
 {
 	return _generatedHeaderFileNamePattern;
@@ -225,6 +340,79 @@ std::string const& MacroCodeGenUnitSettings::getInternalSymbolMacroName() const
 	return _internalSymbolMacroName;
 }
 
+EAmalgamationMode MacroCodeGenUnitSettings::getAmalgamationMode() const noexcept
+{
+	return _amalgamationMode;
+}
+
+std::string const& MacroCodeGenUnitSettings::getAmalgamationFileNamePattern() const noexcept
+{
+	return _amalgamationFileNamePattern;
+}
+
+std::vector<fs::path> const& MacroCodeGenUnitSettings::getAmalgamationModuleDirectories() const noexcept
+{
+	return _amalgamationModuleDirectories;
+}
+
+std::string MacroCodeGenUnitSettings::getAmalgamationDirectoryName(fs::path const& directory) const noexcept
+{
+	fs::path relativeDirectory = directory.lexically_relative(getOutputDirectory());
+
+	//The relative path keeps the name identical on all machines, the absolute path is only used if there is no relative path (different drives)
+	std::string hashedPath = FilesystemHelpers::normalizeSeparator(relativeDirectory.empty() ? directory : relativeDirectory).string();
+
+	std::ostringstream nameStream;
+	nameStream << directory.filename().string() << "_" << std::hex << std::setw(16) << std::setfill('0') << HashHelpers::hashString(HashHelpers::initialHash, hashedPath);
+
+	return nameStream.str();
+}
+
+fs::path MacroCodeGenUnitSettings::getAmalgamationFileName(fs::path const& targetFile) const noexcept
+{
+	std::string filename	= _amalgamationFileNamePattern;
+	fs::path	directory	= targetFile.parent_path();
+
+	switch (_amalgamationMode)
+	{
+		case EAmalgamationMode::PerModule:
+			{
+				fs::path const* fileModuleDirectory = nullptr;
+
+				//The deepest module directory containing the file is used, so that nested modules get their own amalgamation
+				for (fs::path const& moduleDirectory : _amalgamationModuleDirectories)
+				{
+					if (FilesystemHelpers::isChildPath(targetFile, moduleDirectory) &&
+						(fileModuleDirectory == nullptr || FilesystemHelpers::isChildPath(moduleDirectory, *fileModuleDirectory)))
+					{
+						fileModuleDirectory = &moduleDirectory;
+					}
+				}
+
+				if (fileModuleDirectory != nullptr)
+				{
+					directory = *fileModuleDirectory;
+				}
+			}
+			[[fallthrough]];
+
+		case EAmalgamationMode::PerDirectory:
+			replaceTags(filename, dirNameTag, getAmalgamationDirectoryName(directory));
+			break;
+
+		case EAmalgamationMode::Single:
+			replaceTags(filename, dirNameTag, getOutputDirectory().filename().string());
+			break;
+
+		case EAmalgamationMode::None:
+			[[fallthrough]];
+		default:
+			return fs::path();
+	}
+
+	return filename;
+}
+
 bool MacroCodeGenUnitSettings::sanitizeMacroName(std::string& inout_macroName) noexcept
 {
 	bool altered = false;
@@ -1,6 +1,7 @@
 #include "Kodgen/InfoStructures/EntityInfo.h"
 
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 
 using namespace kodgen;
 
@@ -17,6 +18,23 @@ std::string EntityInfo::getFullName() const noexcept
 	return (outerEntity != nullptr) ? outerEntity->getFullName() + "::" + name : name;
 }
 
+uint64 EntityInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result = MemoryHelpers::getAllocatedMemory(name) + MemoryHelpers::getAllocatedMemory(id) + MemoryHelpers::getAllocatedMemory(properties);
+
+	for (Property const& property : properties)
+	{
+		result += MemoryHelpers::getAllocatedMemory(property.name) + MemoryHelpers::getAllocatedMemory(property.arguments);
+
+		for (std::string const& argument : property.arguments)
+		{
+			result += MemoryHelpers::getAllocatedMemory(argument);
+		}
+	}
+
+	return result;
+}
+
 std::string EntityInfo::getFullName(CXCursor const& cursor) noexcept
 {
 	CXCursor parentCursor = clang_getCursorLexicalParent(cursor);
@@ -0,0 +1,31 @@
+#include "Kodgen/InfoStructures/EntityTable.h"
+
+#include "Kodgen/Misc/MemoryHelpers.h"
+
+using namespace kodgen;
+
+uint32 EntityTable::addEntity(EntityInfo const& entity, uint32 parentIndex) noexcept
+{
+	_entities.push_back(&entity);
+	_entityTypes.push_back(entity.entityType);
+	_depths.push_back((parentIndex != invalidIndex) ? _depths[parentIndex] + 1u : 0u);
+	_parentIndices.push_back(parentIndex);
+
+	return static_cast<uint32>(_entities.size() - 1u);
+}
+
+void EntityTable::clear() noexcept
+{
+	_entities.clear();
+	_entityTypes.clear();
+	_depths.clear();
+	_parentIndices.clear();
+}
+
+uint64 EntityTable::getAllocatedMemory() const noexcept
+{
+	return	MemoryHelpers::getAllocatedMemory(_entities) +
+			MemoryHelpers::getAllocatedMemory(_entityTypes) +
+			MemoryHelpers::getAllocatedMemory(_depths) +
+			MemoryHelpers::getAllocatedMemory(_parentIndices);
+}
\ No newline at end of file
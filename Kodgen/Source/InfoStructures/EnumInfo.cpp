@@ -1,5 +1,7 @@
 #include "Kodgen/InfoStructures/EnumInfo.h"
 
+#include "Kodgen/Misc/MemoryHelpers.h"
+
 using namespace kodgen;
 
 EnumInfo::EnumInfo(CXCursor const& cursor, std::vector<Property>&& properties) noexcept:
@@ -15,4 +17,19 @@ void EnumInfo::refreshOuterEntity() noexcept
 	{
 		enumValue.outerEntity = this;
 	}
+}
+
+uint64 EnumInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result =	EntityInfo::getAllocatedMemory() +
+					type.getAllocatedMemory() +
+					underlyingType.getAllocatedMemory() +
+					MemoryHelpers::getAllocatedMemory(enumValues);
+
+	for (EnumValueInfo const& enumValue : enumValues)
+	{
+		result += enumValue.getAllocatedMemory();
+	}
+
+	return result;
 }
\ No newline at end of file
@@ -0,0 +1,286 @@
+#include "Kodgen/InfoStructures/FrozenStructClassTree.h"
+
+#include <queue>
+#include <utility>	//std::pair
+
+#include "Kodgen/Misc/MemoryHelpers.h"
+
+using namespace kodgen;
+
+FrozenStructClassTree::FrozenStructClassTree(StructClassTree const& structClassTree) noexcept
+{
+	build(structClassTree.getEntries());
+}
+
+FrozenStructClassTree::FrozenStructClassTree(std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> const& entries) noexcept
+{
+	build(entries);
+}
+
+void FrozenStructClassTree::build(std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> const& entries) noexcept
+{
+	using Parent = std::pair<uint32, EAccessSpecifier>;
+
+	enum class ENodeState : uint8
+	{
+		Unknown,
+		Visiting,
+		Forest,
+		Graph
+	};
+
+	auto getOrAddId = [this](std::string const& structClassName) -> uint32
+	{
+		return _ids.emplace(structClassName, static_cast<uint32>(_ids.size())).first->second;
+	};
+
+	//Give an id to all structs/classes, including those which are only inherited
+	for (auto const& [structClassName, inheritanceLinks] : entries)
+	{
+		getOrAddId(structClassName);
+
+		for (StructClassTree::InheritanceLink const& inheritanceLink : inheritanceLinks)
+		{
+			getOrAddId(inheritanceLink.inheritedStructClassName);
+		}
+	}
+
+	uint32								nodeCount = static_cast<uint32>(_ids.size());
+	std::vector<std::vector<Parent>>	parents(nodeCount);
+
+	for (auto const& [structClassName, inheritanceLinks] : entries)
+	{
+		std::vector<Parent>& nodeParents = parents[_ids[structClassName]];
+
+		nodeParents.reserve(inheritanceLinks.size());
+
+		for (StructClassTree::InheritanceLink const& inheritanceLink : inheritanceLinks)
+		{
+			nodeParents.emplace_back(_ids[inheritanceLink.inheritedStructClassName], inheritanceLink.inheritanceAccess);
+		}
+	}
+
+	//A node is in the forest if all its bases have at most one parent.
+	//Cycles can't exist in valid code, but are put in the graph so that they don't break the forest labelling.
+	std::vector<ENodeState>	states(nodeCount, ENodeState::Unknown);
+	std::vector<uint32>		path;
+
+	for (uint32 id = 0u; id < nodeCount; id++)
+	{
+		uint32 current = id;
+
+		while (states[current] == ENodeState::Unknown)
+		{
+			if (parents[current].size() > 1u)
+			{
+				states[current] = ENodeState::Graph;
+			}
+			else if (parents[current].empty())
+			{
+				states[current] = ENodeState::Forest;
+			}
+			else
+			{
+				states[current] = ENodeState::Visiting;
+				path.push_back(current);
+				current = parents[current].front().first;
+			}
+		}
+
+		ENodeState pathState = (states[current] == ENodeState::Visiting) ? ENodeState::Graph : states[current];
+
+		for (uint32 pathNode : path)
+		{
+			states[pathNode] = pathState;
+		}
+
+		path.clear();
+	}
+
+	_nodes.resize(nodeCount);
+
+	//Label the forest with the intervals of an Euler tour
+	std::vector<std::vector<uint32>>			children(nodeCount);
+	std::vector<std::pair<uint32, size_t>>		toVisit;
+	uint32										tourPosition = 0u;
+
+	for (uint32 id = 0u; id < nodeCount; id++)
+	{
+		if (states[id] == ENodeState::Forest && !parents[id].empty())
+		{
+			children[parents[id].front().first].push_back(id);
+		}
+	}
+
+	for (uint32 root = 0u; root < nodeCount; root++)
+	{
+		if (states[root] != ENodeState::Forest || !parents[root].empty())
+		{
+			continue;
+		}
+
+		_nodes[root].enter				= tourPosition++;
+		_nodes[root].ancestorAccesses	= static_cast<uint32>(_ancestorAccesses.size());
+		toVisit.emplace_back(root, 0u);
+
+		while (!toVisit.empty())
+		{
+			auto& [current, nextChild] = toVisit.back();
+
+			if (nextChild == children[current].size())
+			{
+				_nodes[current].exit = tourPosition++;
+				toVisit.pop_back();
+
+				continue;
+			}
+
+			uint32	child		= children[current][nextChild++];
+			Node&	parentNode	= _nodes[current];
+			Node&	childNode	= _nodes[child];
+
+			childNode.enter				= tourPosition++;
+			childNode.depth				= parentNode.depth + 1u;
+			childNode.ancestorAccesses	= static_cast<uint32>(_ancestorAccesses.size());
+
+			//Accesses are read by index since the vector can be reallocated while it is appended
+			for (uint32 i = 0u; i < parentNode.depth; i++)
+			{
+				_ancestorAccesses.push_back(_ancestorAccesses[parentNode.ancestorAccesses + i]);
+			}
+
+			_ancestorAccesses.push_back(parents[child].front().second);
+
+			toVisit.emplace_back(child, 0u);
+		}
+	}
+
+	//Fill a closure row for each node of the graph.
+	//Bases are traversed in the same order as StructClassTree::isBaseOf so that the same inheritance access is reported.
+	uint32				closureRowCount = 0u;
+	std::queue<uint32>	toCheck;
+
+	_closureRowSize = (nodeCount + 63u) / 64u;
+
+	for (uint32 id = 0u; id < nodeCount; id++)
+	{
+		if (states[id] == ENodeState::Graph)
+		{
+			_nodes[id].closureRow = closureRowCount++;
+		}
+	}
+
+	_closure.resize(static_cast<size_t>(closureRowCount) * _closureRowSize);
+	_closureAccesses.resize(static_cast<size_t>(closureRowCount) * _closureRowSize * 2u);
+
+	for (uint32 id = 0u; id < nodeCount; id++)
+	{
+		if (_nodes[id].closureRow == invalidId)
+		{
+			continue;
+		}
+
+		uint64* row			= _closure.data() + static_cast<size_t>(_nodes[id].closureRow) * _closureRowSize;
+		uint64* accessesRow	= _closureAccesses.data() + static_cast<size_t>(_nodes[id].closureRow) * _closureRowSize * 2u;
+
+		toCheck.push(id);
+
+		while (!toCheck.empty())
+		{
+			uint32 current = toCheck.front();
+			toCheck.pop();
+
+			for (auto const& [parent, inheritanceAccess] : parents[current])
+			{
+				uint64 bit = uint64(1u) << (parent % 64u);
+
+				if (parent == id || (row[parent / 64u] & bit) != 0u)
+				{
+					continue;
+				}
+
+				row[parent / 64u]			|= bit;
+				accessesRow[parent / 32u]	|= static_cast<uint64>(inheritanceAccess) << ((parent % 32u) * 2u);
+
+				toCheck.push(parent);
+			}
+		}
+	}
+}
+
+uint32 FrozenStructClassTree::getId(std::string const& structClassName) const noexcept
+{
+	auto it = _ids.find(structClassName);
+
+	return (it != _ids.cend()) ? it->second : invalidId;
+}
+
+bool FrozenStructClassTree::isBaseOf(uint32 baseStructClassId, uint32 childStructClassId, EAccessSpecifier* out_inheritanceAccess) const noexcept
+{
+	if (baseStructClassId >= _nodes.size() || childStructClassId >= _nodes.size())
+	{
+		return false;
+	}
+
+	EAccessSpecifier inheritanceAccess = EAccessSpecifier::Invalid;
+
+	if (baseStructClassId != childStructClassId)
+	{
+		Node const& baseNode	= _nodes[baseStructClassId];
+		Node const& childNode	= _nodes[childStructClassId];
+
+		if (childNode.closureRow == invalidId)
+		{
+			//The bases of a forest node are all in the forest, so a graph node can't be one of them
+			if (baseNode.enter == invalidId || baseNode.enter > childNode.enter || childNode.exit > baseNode.exit)
+			{
+				return false;
+			}
+
+			inheritanceAccess = _ancestorAccesses[childNode.ancestorAccesses + baseNode.depth];
+		}
+		else
+		{
+			size_t rowOffset = static_cast<size_t>(childNode.closureRow) * _closureRowSize;
+
+			if (((_closure[rowOffset + baseStructClassId / 64u] >> (baseStructClassId % 64u)) & 1u) == 0u)
+			{
+				return false;
+			}
+
+			inheritanceAccess = static_cast<EAccessSpecifier>((_closureAccesses[rowOffset * 2u + baseStructClassId / 32u] >> ((baseStructClassId % 32u) * 2u)) & 3u);
+		}
+	}
+
+	if (out_inheritanceAccess != nullptr)
+	{
+		*out_inheritanceAccess = inheritanceAccess;
+	}
+
+	return true;
+}
+
+bool FrozenStructClassTree::isBaseOf(std::string const& baseStructClassName, std::string const& childStructClassName, EAccessSpecifier* out_inheritanceAccess) const noexcept
+{
+	return isBaseOf(getId(baseStructClassName), getId(childStructClassName), out_inheritanceAccess);
+}
+
+uint32 FrozenStructClassTree::getNodeCount() const noexcept
+{
+	return static_cast<uint32>(_nodes.size());
+}
+
+uint64 FrozenStructClassTree::getAllocatedMemory() const noexcept
+{
+	//Bucket array, then one node (next pointer + cached hash + key/value pair) per id
+	uint64 result = _ids.bucket_count() * sizeof(void*);
+
+	for (auto const& [structClassName, id] : _ids)
+	{
+		result += sizeof(void*) + sizeof(size_t) + sizeof(std::pair<std::string const, uint32>);
+		result += MemoryHelpers::getAllocatedMemory(structClassName);
+	}
+
+	return result + MemoryHelpers::getAllocatedMemory(_nodes) + MemoryHelpers::getAllocatedMemory(_ancestorAccesses) +
+		   MemoryHelpers::getAllocatedMemory(_closure) + MemoryHelpers::getAllocatedMemory(_closureAccesses);
+}
\ No newline at end of file
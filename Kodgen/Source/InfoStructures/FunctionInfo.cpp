@@ -4,6 +4,7 @@
 #include <algorithm>
 
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 
 using namespace kodgen;
 
@@ -73,5 +74,20 @@ std::string FunctionInfo::getParameterTypes() const noexcept
 	//Remove everything after ) including )
 	result.erase(result.find_first_of(')'));
 
+	return result;
+}
+
+uint64 FunctionInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result =	EntityInfo::getAllocatedMemory() +
+					MemoryHelpers::getAllocatedMemory(prototype) +
+					returnType.getAllocatedMemory() +
+					MemoryHelpers::getAllocatedMemory(parameters);
+
+	for (FunctionParamInfo const& parameter : parameters)
+	{
+		result += parameter.type.getAllocatedMemory() + MemoryHelpers::getAllocatedMemory(parameter.name);
+	}
+
 	return result;
 }
\ No newline at end of file
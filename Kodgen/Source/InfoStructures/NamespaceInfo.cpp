@@ -1,5 +1,7 @@
 #include "Kodgen/InfoStructures/NamespaceInfo.h"
 
+#include "Kodgen/Misc/MemoryHelpers.h"
+
 using namespace kodgen;
 
 NamespaceInfo::NamespaceInfo(CXCursor const& cursor, std::vector<Property>&& properties) noexcept:
@@ -42,4 +44,47 @@ void NamespaceInfo::refreshOuterEntity() noexcept
 	{
 		variableInfo.outerEntity = this;
 	}
+}
+
+uint64 NamespaceInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result =	EntityInfo::getAllocatedMemory() +
+					MemoryHelpers::getAllocatedMemory(namespaces) +
+					MemoryHelpers::getAllocatedMemory(structs) +
+					MemoryHelpers::getAllocatedMemory(classes) +
+					MemoryHelpers::getAllocatedMemory(enums) +
+					MemoryHelpers::getAllocatedMemory(functions) +
+					MemoryHelpers::getAllocatedMemory(variables);
+
+	for (NamespaceInfo const& namespace_ : namespaces)
+	{
+		result += namespace_.getAllocatedMemory();
+	}
+
+	for (StructClassInfo const& struct_ : structs)
+	{
+		result += struct_.getAllocatedMemory();
+	}
+
+	for (StructClassInfo const& class_ : classes)
+	{
+		result += class_.getAllocatedMemory();
+	}
+
+	for (EnumInfo const& enum_ : enums)
+	{
+		result += enum_.getAllocatedMemory();
+	}
+
+	for (FunctionInfo const& function : functions)
+	{
+		result += function.getAllocatedMemory();
+	}
+
+	for (VariableInfo const& variable : variables)
+	{
+		result += variable.getAllocatedMemory();
+	}
+
+	return result;
 }
\ No newline at end of file
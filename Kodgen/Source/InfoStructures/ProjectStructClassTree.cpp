@@ -0,0 +1,288 @@
+#include "Kodgen/InfoStructures/ProjectStructClassTree.h"
+
+#include <queue>
+#include <unordered_set>
+#include <fstream>
+#include <sstream>
+#include <mutex>	//std::unique_lock
+
+using namespace kodgen;
+
+ProjectStructClassTree::Shard& ProjectStructClassTree::getShard(std::string const& structClassName) noexcept
+{
+	return _shards[std::hash<std::string>()(structClassName) & (_shardCount - 1u)];
+}
+
+ProjectStructClassTree::Shard const& ProjectStructClassTree::getShard(std::string const& structClassName) const noexcept
+{
+	return _shards[std::hash<std::string>()(structClassName) & (_shardCount - 1u)];
+}
+
+void ProjectStructClassTree::addInheritanceLinks(fs::path const& sourceFile, StructClassTree const& structClassTree) noexcept
+{
+	for (auto const& [structClassName, inheritanceLinks] : structClassTree.getEntries())
+	{
+		//Entries without links only exist as the target of other links
+		if (inheritanceLinks.empty())
+		{
+			continue;
+		}
+
+		Shard& shard = getShard(structClassName);
+
+		std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+		Entry& entry = shard.entries[structClassName];
+
+		entry.sourceFile		= sourceFile;
+		entry.inheritanceLinks	= inheritanceLinks;
+	}
+}
+
+bool ProjectStructClassTree::isBaseOf(std::string const& baseStructClassName, std::string const& childStructClassName, EAccessSpecifier* out_inheritanceAccess) const noexcept
+{
+	if (baseStructClassName == childStructClassName)
+	{
+		if (out_inheritanceAccess != nullptr)
+		{
+			*out_inheritanceAccess = EAccessSpecifier::Invalid;
+		}
+
+		return true;
+	}
+
+	std::queue<std::string>			toCheck;
+	std::unordered_set<std::string>	checked;
+
+	toCheck.push(childStructClassName);
+	checked.insert(childStructClassName);
+
+	//Traverse the parents of childStruct until we find the base class, locking one shard at a time
+	while (!toCheck.empty())
+	{
+		std::string const&	currentName	= toCheck.front();
+		Shard const&		shard		= getShard(currentName);
+
+		{
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+			auto it = shard.entries.find(currentName);
+
+			if (it != shard.entries.cend())
+			{
+				for (StructClassTree::InheritanceLink const& inheritanceLink : it->second.inheritanceLinks)
+				{
+					if (inheritanceLink.inheritedStructClassName == baseStructClassName)
+					{
+						if (out_inheritanceAccess != nullptr)
+						{
+							*out_inheritanceAccess = inheritanceLink.inheritanceAccess;
+						}
+
+						return true;
+					}
+
+					//Parents shared by several children (diamonds) are only checked once
+					if (checked.insert(inheritanceLink.inheritedStructClassName).second)
+					{
+						toCheck.push(inheritanceLink.inheritedStructClassName);
+					}
+				}
+			}
+		}
+
+		toCheck.pop();
+	}
+
+	return false;
+}
+
+std::vector<StructClassTree::InheritanceLink> ProjectStructClassTree::getInheritanceLinks(std::string const& structClassName) const noexcept
+{
+	Shard const& shard = getShard(structClassName);
+
+	std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+	auto it = shard.entries.find(structClassName);
+
+	return (it != shard.entries.cend()) ? it->second.inheritanceLinks : std::vector<StructClassTree::InheritanceLink>();
+}
+
+void ProjectStructClassTree::freeze() noexcept
+{
+	std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> entries;
+
+	for (Shard const& shard : _shards)
+	{
+		std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+		for (auto const& [structClassName, entry] : shard.entries)
+		{
+			entries.emplace(structClassName, entry.inheritanceLinks);
+		}
+	}
+
+	_frozenTree = FrozenStructClassTree(entries);
+}
+
+FrozenStructClassTree const& ProjectStructClassTree::getFrozenTree() const noexcept
+{
+	return _frozenTree;
+}
+
+void ProjectStructClassTree::prune(std::function<bool(fs::path const&)> const& shouldKeep) noexcept
+{
+	for (Shard& shard : _shards)
+	{
+		std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+		for (auto it = shard.entries.begin(); it != shard.entries.end();)
+		{
+			if (shouldKeep(it->second.sourceFile))
+			{
+				++it;
+			}
+			else
+			{
+				it = shard.entries.erase(it);
+			}
+		}
+	}
+}
+
+void ProjectStructClassTree::clear() noexcept
+{
+	for (Shard& shard : _shards)
+	{
+		std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+		shard.entries.clear();
+	}
+
+	_frozenTree = FrozenStructClassTree();
+}
+
+size_t ProjectStructClassTree::getEntryCount() const noexcept
+{
+	size_t result = 0u;
+
+	for (Shard const& shard : _shards)
+	{
+		std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+		result += shard.entries.size();
+	}
+
+	return result;
+}
+
+bool ProjectStructClassTree::load(fs::path const& treeFile) noexcept
+{
+	clear();
+
+	std::ifstream	stream(treeFile);
+	std::string		line;
+
+	if (!std::getline(stream, line) || line != _header)
+	{
+		return false;
+	}
+
+	fs::path	sourceFile;
+	Entry*		currentEntry = nullptr;
+
+	//Each line is a kind followed by a value which can contain spaces
+	while (std::getline(stream, line))
+	{
+		if (line.size() < 2u || line[1] != ' ')
+		{
+			clear();
+
+			return false;
+		}
+
+		std::string value = line.substr(2u);
+
+		switch (line[0])
+		{
+			case 'S':
+				sourceFile		= value;
+				currentEntry	= nullptr;
+				break;
+
+			case 'C':
+				currentEntry				= &getShard(value).entries[value];
+				currentEntry->sourceFile	= sourceFile;
+				currentEntry->inheritanceLinks.clear();
+				break;
+
+			case 'L':
+				{
+					std::istringstream	valueStream(value);
+					uint32				inheritanceAccess = 0u;
+					std::string			parentName;
+
+					valueStream >> inheritanceAccess;
+					valueStream.get();
+					std::getline(valueStream, parentName);
+
+					if (currentEntry == nullptr || valueStream.fail() || parentName.empty())
+					{
+						clear();
+
+						return false;
+					}
+
+					currentEntry->inheritanceLinks.emplace_back(StructClassTree::InheritanceLink{ std::move(parentName), static_cast<EAccessSpecifier>(inheritanceAccess) });
+				}
+				break;
+
+			default:
+				clear();
+
+				return false;
+		}
+	}
+
+	return true;
+}
+
+bool ProjectStructClassTree::save(fs::path const& treeFile) const noexcept
+{
+	std::ofstream stream(treeFile, std::ios::out | std::ios::trunc);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	//Group entries by source file to write each path once
+	std::unordered_map<fs::path, std::vector<std::pair<std::string const*, Entry const*>>, PathHash> entriesPerFile;
+
+	for (Shard const& shard : _shards)
+	{
+		for (auto const& [structClassName, entry] : shard.entries)
+		{
+			entriesPerFile[entry.sourceFile].emplace_back(&structClassName, &entry);
+		}
+	}
+
+	stream << _header << "\n";
+
+	for (auto const& [sourceFile, entries] : entriesPerFile)
+	{
+		stream << "S " << sourceFile.string() << "\n";
+
+		for (auto const& [structClassName, entry] : entries)
+		{
+			stream << "C " << *structClassName << "\n";
+
+			for (StructClassTree::InheritanceLink const& inheritanceLink : entry->inheritanceLinks)
+			{
+				stream << "L " << static_cast<uint32>(inheritanceLink.inheritanceAccess) << " " << inheritanceLink.inheritedStructClassName << "\n";
+			}
+		}
+	}
+
+	return stream.good();
+}
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include <cassert>
 
 #include "Kodgen/InfoStructures/NestedStructClassInfo.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 
 using namespace kodgen;
 
@@ -77,4 +78,49 @@ void StructClassInfo::refreshOuterEntity() noexcept
 	{
 		method.outerEntity = this;
 	}
+}
+
+uint64 StructClassInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result =	EntityInfo::getAllocatedMemory() +
+					type.getAllocatedMemory() +
+					MemoryHelpers::getAllocatedMemory(parents) +
+					MemoryHelpers::getAllocatedMemory(nestedClasses) +
+					MemoryHelpers::getAllocatedMemory(nestedStructs) +
+					MemoryHelpers::getAllocatedMemory(nestedEnums) +
+					MemoryHelpers::getAllocatedMemory(fields) +
+					MemoryHelpers::getAllocatedMemory(methods);
+
+	for (ParentInfo const& parent : parents)
+	{
+		result += parent.type.getAllocatedMemory();
+	}
+
+	//Nested structs/classes are allocated with their shared_ptr control block
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : nestedClasses)
+	{
+		result += sizeof(NestedStructClassInfo) + 2u * sizeof(long) + nestedClass->getAllocatedMemory();
+	}
+
+	for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : nestedStructs)
+	{
+		result += sizeof(NestedStructClassInfo) + 2u * sizeof(long) + nestedStruct->getAllocatedMemory();
+	}
+
+	for (NestedEnumInfo const& nestedEnum : nestedEnums)
+	{
+		result += nestedEnum.getAllocatedMemory();
+	}
+
+	for (FieldInfo const& field : fields)
+	{
+		result += field.getAllocatedMemory();
+	}
+
+	for (MethodInfo const& method : methods)
+	{
+		result += method.getAllocatedMemory();
+	}
+
+	return result;
 }
\ No newline at end of file
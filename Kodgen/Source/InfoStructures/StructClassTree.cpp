@@ -4,6 +4,8 @@
 #include <algorithm> //std::none_of
 #include <queue>
 
+#include "Kodgen/Misc/MemoryHelpers.h"
+
 using namespace kodgen;
 
 bool StructClassTree::addInheritanceLink(std::string const& childStructClassName, std::string const& parentStructClassName, EAccessSpecifier inheritanceAccess) noexcept
@@ -87,4 +89,23 @@ bool StructClassTree::isBaseOf(std::string const& baseStructClassName, std::stri
 std::unordered_map<std::string, std::vector<StructClassTree::InheritanceLink>> const& StructClassTree::getEntries() const noexcept
 {
 	return entries;
+}
+
+uint64 StructClassTree::getAllocatedMemory() const noexcept
+{
+	//Bucket array, then one node (next pointer + cached hash + key/value pair) per entry
+	uint64 result = entries.bucket_count() * sizeof(void*);
+
+	for (auto const& [structClassName, inheritanceLinks] : entries)
+	{
+		result += sizeof(void*) + sizeof(size_t) + sizeof(std::pair<std::string const, std::vector<InheritanceLink>>);
+		result += MemoryHelpers::getAllocatedMemory(structClassName) + MemoryHelpers::getAllocatedMemory(inheritanceLinks);
+
+		for (InheritanceLink const& inheritanceLink : inheritanceLinks)
+		{
+			result += MemoryHelpers::getAllocatedMemory(inheritanceLink.inheritedStructClassName);
+		}
+	}
+
+	return result;
 }
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "Kodgen/InfoStructures/TypeInfo.h"
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 
 using namespace kodgen;
 
@@ -30,4 +31,16 @@ ETemplateParameterKind TemplateParamInfo::getTemplateParamKind(CXCursorKind curs
 		default:
 			return ETemplateParameterKind::Undefined;
 	}
+}
+
+uint64 TemplateParamInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result = MemoryHelpers::getAllocatedMemory(name);
+
+	if (type != nullptr)
+	{
+		result += sizeof(TypeInfo) + type->getAllocatedMemory();
+	}
+
+	return result;
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include <algorithm>
 
 #include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 
 using namespace kodgen;
 
@@ -433,4 +434,19 @@ std::ostream& kodgen::operator<<(std::ostream& out_stream, TypeInfo const& typeI
 	out_stream << typeInfo.getName(false, false);
 
 	return out_stream;
+}
+
+uint64 TypeInfo::getAllocatedMemory() const noexcept
+{
+	uint64 result =	MemoryHelpers::getAllocatedMemory(_fullName) +
+					MemoryHelpers::getAllocatedMemory(_canonicalFullName) +
+					MemoryHelpers::getAllocatedMemory(_templateParameters) +
+					MemoryHelpers::getAllocatedMemory(typeParts);
+
+	for (TemplateParamInfo const& templateParameter : _templateParameters)
+	{
+		result += templateParameter.getAllocatedMemory();
+	}
+
+	return result;
 }
\ No newline at end of file
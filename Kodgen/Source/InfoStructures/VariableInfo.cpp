@@ -17,4 +17,9 @@ VariableInfo::VariableInfo(CXCursor const& cursor, std::vector<Property>&& prope
 	assert(cursor.kind == CXCursorKind::CXCursor_VarDecl);
 
 	isStatic = clang_getCursorLinkage(cursor) == CXLinkage_Internal;
+}
+
+uint64 VariableInfo::getAllocatedMemory() const noexcept
+{
+	return EntityInfo::getAllocatedMemory() + type.getAllocatedMemory();
 }
\ No newline at end of file
@@ -0,0 +1,179 @@
+#include "Kodgen/Misc/AsyncLogger.h"
+
+#include <chrono>
+
+using namespace kodgen;
+
+AsyncLogger::AsyncLogger(ILogger& sink, uint32 capacity) noexcept:
+	_sink{sink}
+{
+	uint64 slotCount = 2u;
+
+	while (slotCount < capacity)
+	{
+		slotCount <<= 1u;
+	}
+
+	_slots			= std::vector<Slot>(static_cast<size_t>(slotCount));
+	_positionMask	= slotCount - 1u;
+
+	//Each slot is first written for its own position
+	for (uint64 i = 0u; i < slotCount; i++)
+	{
+		_slots[static_cast<size_t>(i)].sequence.store(i, std::memory_order_relaxed);
+	}
+
+	_flusher = std::thread(&AsyncLogger::flusherRoutine, this);
+}
+
+AsyncLogger::~AsyncLogger() noexcept
+{
+	_mutex.lock();
+	_stopRequested = true;
+	_mutex.unlock();
+
+	_messageCondition.notify_one();
+
+	if (_flusher.joinable())
+	{
+		_flusher.join();
+	}
+}
+
+void AsyncLogger::log(std::string const& message, ELogSeverity logSeverity) noexcept
+{
+	if (!isLogged(logSeverity))
+	{
+		return;
+	}
+
+	uint64	position	= _enqueuePosition.load(std::memory_order_relaxed);
+	Slot*	slot;
+
+	//Claim the slot of the next position
+	while (true)
+	{
+		slot = &_slots[static_cast<size_t>(position & _positionMask)];
+
+		uint64 sequence = slot->sequence.load(std::memory_order_acquire);
+
+		if (sequence == position)
+		{
+			if (_enqueuePosition.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (sequence < position)
+		{
+			//The slot still holds a message of the previous lap: the ring buffer is full
+			_droppedCount.fetch_add(1u, std::memory_order_relaxed);
+
+			return;
+		}
+		else
+		{
+			//Another thread claimed this position
+			position = _enqueuePosition.load(std::memory_order_relaxed);
+		}
+	}
+
+	slot->message	= message;
+	slot->severity	= logSeverity;
+
+	//Publish the message to the flusher thread
+	slot->sequence.store(position + 1u, std::memory_order_release);
+
+	if (_flusherSleeping.load(std::memory_order_relaxed))
+	{
+		_messageCondition.notify_one();
+	}
+}
+
+void AsyncLogger::flush() noexcept
+{
+	uint64 position = _enqueuePosition.load(std::memory_order_relaxed);
+
+	std::unique_lock lock(_mutex);
+
+	_messageCondition.notify_one();
+	_flushedCondition.wait(lock, [this, position]() { return _flushedPosition >= position; });
+}
+
+void AsyncLogger::flusherRoutine() noexcept
+{
+	bool hasUnflushedMessages = false;
+
+	std::unique_lock lock(_mutex);
+
+	while (true)
+	{
+		lock.unlock();
+
+		if (forwardMessages())
+		{
+			hasUnflushedMessages = true;
+
+			lock.lock();
+
+			continue;
+		}
+
+		//All published messages are forwarded, flush the sink once instead of after each message
+		if (hasUnflushedMessages)
+		{
+			_sink.flush();
+
+			hasUnflushedMessages = false;
+		}
+
+		lock.lock();
+
+		_flushedPosition = _dequeuePosition;
+		_flushedCondition.notify_all();
+
+		if (_stopRequested)
+		{
+			break;
+		}
+
+		_flusherSleeping.store(true, std::memory_order_relaxed);
+		_messageCondition.wait_for(lock, std::chrono::milliseconds(_maxSleepDuration));
+		_flusherSleeping.store(false, std::memory_order_relaxed);
+	}
+}
+
+bool AsyncLogger::forwardMessages() noexcept
+{
+	bool forwarded = false;
+
+	while (true)
+	{
+		Slot& slot = _slots[static_cast<size_t>(_dequeuePosition & _positionMask)];
+
+		if (slot.sequence.load(std::memory_order_acquire) != _dequeuePosition + 1u)
+		{
+			//The next message is not published yet
+			break;
+		}
+
+		_sink.log(slot.message, slot.severity);
+
+		//Release the slot for the next lap
+		slot.sequence.store(_dequeuePosition + _slots.size(), std::memory_order_release);
+
+		_dequeuePosition++;
+		forwarded = true;
+	}
+
+	uint64 droppedCount = _droppedCount.exchange(0u, std::memory_order_relaxed);
+
+	if (droppedCount != 0u)
+	{
+		_sink.log(std::to_string(droppedCount) + " log message(s) dropped since the logger buffer was full.", ELogSeverity::Warning);
+
+		forwarded = true;
+	}
+
+	return forwarded;
+}
\ No newline at end of file
@@ -6,21 +6,29 @@ using namespace kodgen;
 
 void DefaultLogger::logInfo(std::string const& message) noexcept
 {
-	std::cout << "[Info] " << message << std::endl;
+	std::cout << "[Info] " << message << '\n';
 }
 
 void DefaultLogger::logWarning(std::string const& message) noexcept
 {
-	std::cout << "[Warning] " << message << std::endl;
+	std::cout << "[Warning] " << message << '\n';
 }
 
 void DefaultLogger::logError(std::string const& message) noexcept
 {
+	//Keep errors ordered with the messages previously written to std::cout
+	std::cout.flush();
+
 	std::cerr << "[Error] " << message << std::endl;
 }
 
 void DefaultLogger::log(std::string const& message, ELogSeverity logSeverity) noexcept
 {
+	if (!isLogged(logSeverity))
+	{
+		return;
+	}
+
 	switch (logSeverity)
 	{
 		case ELogSeverity::Info:
@@ -35,4 +43,9 @@ void DefaultLogger::log(std::string const& message, ELogSeverity logSeverity) no
 			logError(message);
 			break;
 	}
+}
+
+void DefaultLogger::flush() noexcept
+{
+	std::cout.flush();
 }
\ No newline at end of file
@@ -0,0 +1,54 @@
+#include "Kodgen/Misc/FileStatus.h"
+
+#if !_WIN32
+#include <sys/stat.h>
+#endif
+
+using namespace kodgen;
+
+bool FileStatus::query(fs::path const& path, FileStatus& out_status) noexcept
+{
+#if _WIN32
+	std::error_code errorCode;
+
+	if (!fs::is_regular_file(path, errorCode))
+	{
+		return false;
+	}
+
+	out_status.size				= static_cast<uint64>(fs::file_size(path, errorCode));
+	out_status.lastWriteTime	= static_cast<int64>(fs::last_write_time(path, errorCode).time_since_epoch().count());
+	out_status.inode			= 0u;
+
+	return !errorCode;
+#else
+	struct stat fileStat;
+
+	//A single stat call retrieves everything we need
+	if (::stat(path.c_str(), &fileStat) != 0 || !S_ISREG(fileStat.st_mode))
+	{
+		return false;
+	}
+
+	out_status.size		= static_cast<uint64>(fileStat.st_size);
+	out_status.inode	= static_cast<uint64>(fileStat.st_ino);
+
+#if defined(__APPLE__)
+	out_status.lastWriteTime = static_cast<int64>(fileStat.st_mtimespec.tv_sec) * 1000000000 + fileStat.st_mtimespec.tv_nsec;
+#else
+	out_status.lastWriteTime = static_cast<int64>(fileStat.st_mtim.tv_sec) * 1000000000 + fileStat.st_mtim.tv_nsec;
+#endif
+
+	return true;
+#endif
+}
+
+bool FileStatus::operator==(FileStatus const& other) const noexcept
+{
+	return size == other.size && lastWriteTime == other.lastWriteTime && inode == other.inode;
+}
+
+bool FileStatus::operator!=(FileStatus const& other) const noexcept
+{
+	return !(*this == other);
+}
\ No newline at end of file
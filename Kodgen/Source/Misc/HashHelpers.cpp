@@ -0,0 +1,27 @@
+#include "Kodgen/Misc/HashHelpers.h"
+
+using namespace kodgen;
+
+uint64 HashHelpers::hashBytes(uint64 hash, void const* data, size_t size) noexcept
+{
+	uint8 const* bytes = static_cast<uint8 const*>(data);
+
+	for (size_t i = 0u; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211u;
+	}
+
+	return hash;
+}
+
+uint64 HashHelpers::hashString(uint64 hash, std::string const& value) noexcept
+{
+	//The size separates consecutive strings, so that "ab" + "c" and "a" + "bc" give different hashes
+	return hashBytes(hashValue(hash, value.size()), value.data(), value.size());
+}
+
+uint64 HashHelpers::hashValue(uint64 hash, uint64 value) noexcept
+{
+	return hashBytes(hash, &value, sizeof(value));
+}
\ No newline at end of file
@@ -0,0 +1,132 @@
+#include "Kodgen/Misc/MappedFile.h"
+
+#include <utility>	//std::swap
+
+#if _WIN32
+#include <Windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace kodgen;
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+MappedFile::~MappedFile() noexcept
+{
+	close();
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+{
+	std::swap(_data, other._data);
+	std::swap(_size, other._size);
+
+#if _WIN32
+	std::swap(_mappingHandle, other._mappingHandle);
+#endif
+
+	return *this;
+}
+
+bool MappedFile::open(fs::path const& file) noexcept
+{
+	close();
+
+#if _WIN32
+	HANDLE fileHandle = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+	if (fileHandle == INVALID_HANDLE_VALUE)
+	{
+		return false;
+	}
+
+	LARGE_INTEGER fileSize;
+
+	if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+	{
+		_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (_mappingHandle != nullptr)
+		{
+			_data = static_cast<uint8 const*>(MapViewOfFile(_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+			_size = static_cast<size_t>(fileSize.QuadPart);
+		}
+	}
+
+	//The mapping keeps a reference to the file
+	CloseHandle(fileHandle);
+#else
+	int fileDescriptor = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+
+	if (fileDescriptor < 0)
+	{
+		return false;
+	}
+
+	struct stat fileStat;
+
+	if (::fstat(fileDescriptor, &fileStat) == 0 && fileStat.st_size > 0)
+	{
+		void* data = ::mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+		if (data != MAP_FAILED)
+		{
+			_data = static_cast<uint8 const*>(data);
+			_size = static_cast<size_t>(fileStat.st_size);
+		}
+	}
+
+	//The mapping keeps a reference to the file
+	::close(fileDescriptor);
+#endif
+
+	if (_data == nullptr)
+	{
+		close();
+
+		return false;
+	}
+
+	return true;
+}
+
+void MappedFile::close() noexcept
+{
+#if _WIN32
+	if (_data != nullptr)
+	{
+		UnmapViewOfFile(_data);
+	}
+
+	if (_mappingHandle != nullptr)
+	{
+		CloseHandle(_mappingHandle);
+		_mappingHandle = nullptr;
+	}
+#else
+	if (_data != nullptr)
+	{
+		::munmap(const_cast<uint8*>(_data), _size);
+	}
+#endif
+
+	_data = nullptr;
+	_size = 0u;
+}
+
+uint8 const* MappedFile::getData() const noexcept
+{
+	return _data;
+}
+
+size_t MappedFile::getSize() const noexcept
+{
+	return _size;
+}
\ No newline at end of file
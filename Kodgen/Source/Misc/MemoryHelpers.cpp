@@ -0,0 +1,47 @@
+#include "Kodgen/Misc/MemoryHelpers.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+using namespace kodgen;
+
+uint64 MemoryHelpers::getTranslationUnitMemory(CXTranslationUnit translationUnit) noexcept
+{
+	uint64				result	= 0u;
+	CXTUResourceUsage	usage	= clang_getCXTUResourceUsage(translationUnit);
+
+	for (unsigned int i = 0u; i < usage.numEntries; i++)
+	{
+		result += usage.entries[i].amount;
+	}
+
+	clang_disposeCXTUResourceUsage(usage);
+
+	return result;
+}
+
+uint64 MemoryHelpers::getPeakResidentSetSize() noexcept
+{
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS counters;
+
+	return (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) ? static_cast<uint64>(counters.PeakWorkingSetSize) : 0u;
+#else
+	rusage usage;
+
+	if (getrusage(RUSAGE_SELF, &usage) != 0)
+	{
+		return 0u;
+	}
+
+	#if defined(__APPLE__)
+	return static_cast<uint64>(usage.ru_maxrss);			//Already in bytes on macOS
+	#else
+	return static_cast<uint64>(usage.ru_maxrss) * 1024u;	//KiB on Linux
+	#endif
+#endif
+}
\ No newline at end of file
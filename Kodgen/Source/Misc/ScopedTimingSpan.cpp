@@ -0,0 +1,20 @@
+#include "Kodgen/Misc/ScopedTimingSpan.h"
+
+using namespace kodgen;
+
+ScopedTimingSpan::ScopedTimingSpan(TimingReport* report, char const* category, char const* name, std::string detail) noexcept:
+	_report{report},
+	_category{category},
+	_name{name},
+	_detail{std::move(detail)},
+	_start{(report != nullptr) ? TimingReport::Clock::now() : TimingReport::Clock::time_point()}
+{
+}
+
+ScopedTimingSpan::~ScopedTimingSpan() noexcept
+{
+	if (_report != nullptr)
+	{
+		_report->addSpan(_category, _name, std::move(_detail), _start, TimingReport::Clock::now());
+	}
+}
\ No newline at end of file
@@ -4,9 +4,51 @@
 #include <array>
 #include <memory>	//std::unique_ptr
 #include <cstdio>	//std::fgets
+#include <fstream>
+#include <vector>
+#include <limits>
+#include <algorithm>	//std::min
+#include <cstdlib>		//std::strtoull
+
+#include "Kodgen/Misc/Filesystem.h"
 
 using namespace kodgen;
 
+/**
+*	@brief Get the directory of the cgroup v2 of the process and the directories of its parent cgroups.
+*
+*	@param cgroupFile	File listing the cgroups of the process, in the /proc/self/cgroup format.
+*	@param cgroupRoot	Directory where the cgroup v2 hierarchy is mounted.
+*
+*	@return The cgroup directories, from the process cgroup to the root cgroup. Empty if cgroup v2 is not available.
+*/
+static std::vector<fs::path> getCgroupDirectories(fs::path const& cgroupFile, fs::path const& cgroupRoot) noexcept
+{
+	std::vector<fs::path>	result;
+	std::ifstream			stream(cgroupFile);
+	std::string				line;
+
+	//The cgroup v2 entry is "0::/path/of/the/cgroup"
+	while (std::getline(stream, line))
+	{
+		if (line.rfind("0::", 0u) == 0u)
+		{
+			fs::path cgroup = cgroupRoot / fs::path(line.substr(3u)).relative_path();
+
+			for (; cgroup != cgroupRoot && !cgroup.empty(); cgroup = cgroup.parent_path())
+			{
+				result.push_back(cgroup);
+			}
+
+			result.push_back(cgroupRoot);
+
+			break;
+		}
+	}
+
+	return result;
+}
+
 std::string System::executeCommand(std::string const& cmd)
 {
 	constexpr int const bufferSize = 128;
@@ -31,4 +73,62 @@ std::string System::executeCommand(std::string const& cmd)
 	}
 
 	return result;
+}
+
+uint32 System::getCpuQuota() noexcept
+{
+	return getCpuQuota("/proc/self/cgroup", "/sys/fs/cgroup");
+}
+
+uint32 System::getCpuQuota(fs::path const& cgroupFile, fs::path const& cgroupRoot) noexcept
+{
+	uint32 result = 0u;
+
+	for (fs::path const& cgroup : getCgroupDirectories(cgroupFile, cgroupRoot))
+	{
+		//cpu.max contains "max period" or "quota period" in microseconds
+		std::ifstream	stream(cgroup / "cpu.max");
+		std::string		quota;
+		uint64			period = 0u;
+
+		if (stream >> quota >> period && quota != "max" && period != 0u)
+		{
+			uint32 cpuCount = static_cast<uint32>((std::strtoull(quota.c_str(), nullptr, 10) + period - 1u) / period);
+
+			if (cpuCount != 0u && (result == 0u || cpuCount < result))
+			{
+				result = cpuCount;
+			}
+		}
+	}
+
+	return result;
+}
+
+uint64 System::getAvailableMemory() noexcept
+{
+	return getAvailableMemory("/proc/self/cgroup", "/sys/fs/cgroup");
+}
+
+uint64 System::getAvailableMemory(fs::path const& cgroupFile, fs::path const& cgroupRoot) noexcept
+{
+	uint64 result = std::numeric_limits<uint64>::max();
+
+	for (fs::path const& cgroup : getCgroupDirectories(cgroupFile, cgroupRoot))
+	{
+		std::ifstream	limitStream(cgroup / "memory.max");
+		std::ifstream	usageStream(cgroup / "memory.current");
+		std::string		limit;
+		uint64			usage = 0u;
+
+		if (limitStream >> limit && limit != "max" && usageStream >> usage)
+		{
+			uint64 limitValue = std::strtoull(limit.c_str(), nullptr, 10);
+
+			//Keep at least 1 byte so that a reached limit is not mistaken for no limit
+			result = std::min(result, (limitValue > usage + 1u) ? limitValue - usage : 1u);
+		}
+	}
+
+	return (result == std::numeric_limits<uint64>::max()) ? 0u : result;
 }
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "Kodgen/Misc/TimingReport.h"
+
+#include <fstream>
+#include <thread>
+#include <map>
+#include <algorithm>	//std::min, std::sort
+#include <cstdio>		//std::snprintf
+#include <cstdlib>		//std::free
+#include <cstring>		//std::strcmp
+
+#if defined(__GNUC__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
+using namespace kodgen;
+
+void TimingReport::addSpan(char const* category, char const* name, std::string detail, Clock::time_point start, Clock::time_point end) noexcept
+{
+	TimingSpan& span = spans.emplace_back();
+
+	span.category	= category;
+	span.name		= name;
+	span.detail		= std::move(detail);
+	span.start		= std::chrono::duration_cast<std::chrono::microseconds>(start.time_since_epoch()).count();
+	span.duration	= std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+	span.threadId	= static_cast<uint32>(std::hash<std::thread::id>()(std::this_thread::get_id()));
+}
+
+void TimingReport::mergeReport(TimingReport&& otherReport) noexcept
+{
+	spans.insert(spans.cend(), std::make_move_iterator(otherReport.spans.begin()), std::make_move_iterator(otherReport.spans.end()));
+
+	otherReport.spans.clear();
+}
+
+bool TimingReport::exportChromeTrace(fs::path const& path) const noexcept
+{
+	auto escape = [](std::string const& str)
+	{
+		std::string result;
+		result.reserve(str.size());
+
+		for (char c : str)
+		{
+			if (c == '"' || c == '\\')
+			{
+				result += '\\';
+			}
+
+			result += c;
+		}
+
+		return result;
+	};
+
+	std::ofstream stream(path, std::ios::out | std::ios::trunc);
+
+	if (!stream.is_open())
+	{
+		return false;
+	}
+
+	//Timestamps are made relative to the first span to keep them small
+	uint64 origin = spans.empty() ? 0u : spans.front().start;
+
+	for (TimingSpan const& span : spans)
+	{
+		origin = std::min(origin, span.start);
+	}
+
+	stream << "{\"traceEvents\":[";
+
+	for (size_t i = 0u; i < spans.size(); i++)
+	{
+		TimingSpan const& span = spans[i];
+
+		stream	<< ((i == 0u) ? "\n" : ",\n")
+				<< "{\"name\":\"" << escape(getReadableName(span.name))
+				<< "\",\"cat\":\"" << escape(span.category)
+				<< "\",\"ph\":\"X\",\"ts\":" << (span.start - origin)
+				<< ",\"dur\":" << span.duration
+				<< ",\"pid\":1,\"tid\":" << span.threadId;
+
+		if (!span.detail.empty())
+		{
+			stream << ",\"args\":{\"detail\":\"" << escape(span.detail) << "\"}";
+		}
+
+		stream << "}";
+	}
+
+	stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+	return stream.good();
+}
+
+std::string TimingReport::getSummary(size_t slowestFilesCount) const noexcept
+{
+	struct Aggregate
+	{
+		uint64	count		= 0u;
+		uint64	total		= 0u;
+		uint64	max			= 0u;
+	};
+
+	std::map<std::pair<std::string, std::string>, Aggregate>	aggregates;
+	std::map<std::string, uint64>								filesDuration;
+
+	for (TimingSpan const& span : spans)
+	{
+		Aggregate& aggregate = aggregates[{ span.category, getReadableName(span.name) }];
+
+		aggregate.count++;
+		aggregate.total	+= span.duration;
+		aggregate.max	= std::max(aggregate.max, span.duration);
+
+		//Only top level file spans are accumulated to avoid counting nested spans twice
+		if (!span.detail.empty() && std::strcmp(span.category, "File") == 0)
+		{
+			filesDuration[span.detail] += span.duration;
+		}
+	}
+
+	std::string	result;
+	char		line[512];
+
+	std::snprintf(line, sizeof(line), "%-10s %-40s %8s %12s %12s %12s\n", "Category", "Name", "Count", "Total (ms)", "Mean (ms)", "Max (ms)");
+	result += line;
+
+	for (auto const& [key, aggregate] : aggregates)
+	{
+		std::snprintf(line, sizeof(line), "%-10s %-40s %8llu %12.3f %12.3f %12.3f\n",
+					  key.first.c_str(), key.second.c_str(), static_cast<unsigned long long>(aggregate.count),
+					  aggregate.total * 0.001, aggregate.total * 0.001 / aggregate.count, aggregate.max * 0.001);
+		result += line;
+	}
+
+	if (!filesDuration.empty() && slowestFilesCount != 0u)
+	{
+		std::vector<std::pair<std::string, uint64>> slowestFiles(filesDuration.cbegin(), filesDuration.cend());
+
+		std::sort(slowestFiles.begin(), slowestFiles.end(), [](auto const& lhs, auto const& rhs) { return lhs.second > rhs.second; });
+		slowestFiles.resize(std::min(slowestFiles.size(), slowestFilesCount));
+
+		result += "\nSlowest files:\n";
+
+		for (auto const& [file, duration] : slowestFiles)
+		{
+			std::snprintf(line, sizeof(line), "%12.3f ms  ", duration * 0.001);
+			result += line;
+			result += file;
+			result += '\n';
+		}
+	}
+
+	return result;
+}
+
+std::string TimingReport::getReadableName(char const* name) noexcept
+{
+	if (name == nullptr)
+	{
+		return std::string();
+	}
+
+#if defined(__GNUC__) || defined(__clang__)
+	int		status		= 0;
+	char*	demangled	= abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+	if (demangled != nullptr)
+	{
+		std::string result = (status == 0) ? demangled : name;
+
+		std::free(demangled);
+
+		return result;
+	}
+#endif
+
+	return name;
+}
\ No newline at end of file
@@ -0,0 +1,249 @@
+#include "Kodgen/Parsing/CompilationDatabase.h"
+
+#include <map>
+#include <array>
+#include <cstring>	//std::strlen
+
+#include <clang-c/CXCompilationDatabase.h>
+
+#include "Kodgen/Misc/Helpers.h"
+#include "Kodgen/Misc/ILogger.h"
+
+using namespace kodgen;
+
+fs::path CompilationDatabase::normalizePath(fs::path const& path, fs::path const& directory) noexcept
+{
+	fs::path absolutePath = (path.is_absolute()) ? path : directory / path;
+
+	std::error_code errorCode;
+	fs::path		canonicalPath = fs::canonical(absolutePath, errorCode);
+
+	return (errorCode) ? absolutePath.lexically_normal() : canonicalPath;
+}
+
+fs::path CompilationDatabase::getCommonRoot(opt::optional<fs::path> const& root, fs::path const& path) noexcept
+{
+	if (!root.has_value())
+	{
+		return path;
+	}
+
+	fs::path result;
+
+	for (auto rootIt = root->begin(), pathIt = path.begin(); rootIt != root->end() && pathIt != path.end() && *rootIt == *pathIt; rootIt++, pathIt++)
+	{
+		result /= *rootIt;
+	}
+
+	return result;
+}
+
+std::vector<std::string> CompilationDatabase::extractParsingArguments(std::vector<std::string> const& arguments, fs::path const& directory) noexcept
+{
+	//Arguments followed by a path, which can also be glued to the argument
+	static std::array<char const*, 7> const pathArguments		= { "-isystem", "-iquote", "-idirafter", "-imacros", "-include", "-I", "-F" };
+
+	//Arguments followed by a value, which can also be glued to the argument
+	static std::array<char const*, 2> const valueArguments		= { "-D", "-U" };
+
+	std::vector<std::string> result;
+
+	//The first argument is the compiler
+	for (size_t i = 1u; i < arguments.size(); i++)
+	{
+		std::string argument = arguments[i];
+
+		//MSVC style arguments
+		if (argument.size() > 2u && argument[0] == '/' && (argument[1] == 'I' || argument[1] == 'D' || argument[1] == 'U'))
+		{
+			argument[0] = '-';
+		}
+		else if (argument.rfind("/std:c++", 0u) == 0u)
+		{
+			argument = "-std=c++" + argument.substr(8u);
+		}
+
+		if (argument.rfind("-std=", 0u) == 0u || argument.rfind("-nostdinc", 0u) == 0u)
+		{
+			result.emplace_back(std::move(argument));
+
+			continue;
+		}
+
+		bool found = false;
+
+		for (char const* pathArgument : pathArguments)
+		{
+			if (argument.rfind(pathArgument, 0u) == 0u)
+			{
+				std::string path = argument.substr(std::strlen(pathArgument));
+
+				if (path.empty() && i + 1u < arguments.size())
+				{
+					path = arguments[++i];
+				}
+
+				result.emplace_back(std::string(pathArgument) + normalizePath(path, directory).string());
+				found = true;
+
+				break;
+			}
+		}
+
+		if (found)
+		{
+			continue;
+		}
+
+		for (char const* valueArgument : valueArguments)
+		{
+			if (argument.rfind(valueArgument, 0u) == 0u)
+			{
+				std::string value = argument.substr(std::strlen(valueArgument));
+
+				if (value.empty() && i + 1u < arguments.size())
+				{
+					value = arguments[++i];
+				}
+
+				result.emplace_back(std::string(valueArgument) + value);
+
+				break;
+			}
+		}
+	}
+
+	return result;
+}
+
+bool CompilationDatabase::load(fs::path const& directory, ILogger* logger) noexcept
+{
+	clear();
+
+	CXCompilationDatabase_Error	error;
+	CXCompilationDatabase		database = clang_CompilationDatabase_fromDirectory(directory.string().c_str(), &error);
+
+	if (error != CXCompilationDatabase_NoError)
+	{
+		if (logger != nullptr)
+		{
+			logger->log("Failed to load the compilation database from " + directory.string() + ".", ILogger::ELogSeverity::Warning);
+		}
+
+		clang_CompilationDatabase_dispose(database);
+
+		return false;
+	}
+
+	CXCompileCommands	commands		= clang_CompilationDatabase_getAllCompileCommands(database);
+	uint32				commandCount	= clang_CompileCommands_getSize(commands);
+
+	//Files sorted by path so that headers always get the arguments of the same compiled file
+	std::map<fs::path, uint32>								files;
+	std::map<std::vector<std::string>, uint32>				argumentSetIndices;
+	std::vector<std::string>								arguments;
+	opt::optional<fs::path>									projectRoot;
+
+	for (uint32 i = 0u; i < commandCount; i++)
+	{
+		CXCompileCommand	command				= clang_CompileCommands_getCommand(commands, i);
+		fs::path			commandDirectory	= Helpers::getString(clang_CompileCommand_getDirectory(command));
+		uint32				argumentCount		= clang_CompileCommand_getNumArgs(command);
+
+		arguments.clear();
+
+		for (uint32 j = 0u; j < argumentCount; j++)
+		{
+			arguments.emplace_back(Helpers::getString(clang_CompileCommand_getArg(command, j)));
+		}
+
+		//Files of the same target share the same arguments
+		std::vector<std::string> parsingArguments = extractParsingArguments(arguments, commandDirectory);
+
+		auto [it, inserted] = argumentSetIndices.try_emplace(std::move(parsingArguments), static_cast<uint32>(_argumentSets.size()));
+
+		if (inserted)
+		{
+			_argumentSets.emplace_back(it->first);
+		}
+
+		//A file compiled several times keeps its first command
+		fs::path file = normalizePath(Helpers::getString(clang_CompileCommand_getFilename(command)), commandDirectory);
+
+		projectRoot = getCommonRoot(getCommonRoot(projectRoot, file.parent_path()), normalizePath(commandDirectory, fs::current_path()));
+
+		files.emplace(std::move(file), it->second);
+	}
+
+	clang_CompileCommands_dispose(commands);
+	clang_CompilationDatabase_dispose(database);
+
+	for (auto const& [file, argumentSetIndex] : files)
+	{
+		_fileArgumentSets.emplace(file, argumentSetIndex);
+
+		//Register the file in all its parent directories up to the project root which don't have arguments yet,
+		//so that files outside of the project keep the default arguments
+		for (fs::path parent = file.parent_path(); !parent.empty(); parent = parent.parent_path())
+		{
+			if (!_directoryArgumentSets.emplace(parent, argumentSetIndex).second || parent == *projectRoot || parent == parent.root_path())
+			{
+				break;
+			}
+		}
+	}
+
+	if (logger != nullptr)
+	{
+		logger->log("Load compilation database: " + std::to_string(commandCount) + " command(s), " + std::to_string(_argumentSets.size()) + " distinct argument set(s).");
+	}
+
+	return true;
+}
+
+void CompilationDatabase::clear() noexcept
+{
+	_argumentSets.clear();
+	_fileArgumentSets.clear();
+	_directoryArgumentSets.clear();
+}
+
+opt::optional<uint32> CompilationDatabase::findArgumentSet(fs::path const& file) const noexcept
+{
+	if (_argumentSets.empty())
+	{
+		return opt::nullopt;
+	}
+
+	fs::path normalizedFile = normalizePath(file, fs::current_path());
+
+	decltype(_fileArgumentSets)::const_iterator it = _fileArgumentSets.find(normalizedFile);
+
+	if (it != _fileArgumentSets.cend())
+	{
+		return it->second;
+	}
+
+	//Use the arguments of the nearest compiled file
+	for (fs::path parent = normalizedFile.parent_path(); !parent.empty(); parent = parent.parent_path())
+	{
+		it = _directoryArgumentSets.find(parent);
+
+		if (it != _directoryArgumentSets.cend())
+		{
+			return it->second;
+		}
+
+		if (parent == parent.root_path())
+		{
+			break;
+		}
+	}
+
+	return opt::nullopt;
+}
+
+std::vector<std::vector<std::string>> const& CompilationDatabase::getArgumentSets() const noexcept
+{
+	return _argumentSets;
+}
\ No newline at end of file
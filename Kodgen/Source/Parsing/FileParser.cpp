@@ -5,6 +5,8 @@
 #include "Kodgen/Misc/Helpers.h"
 #include "Kodgen/Misc/DisableWarningMacros.h"
 #include "Kodgen/Misc/TomlUtility.h"
+#include "Kodgen/Misc/ScopedTimingSpan.h"
+#include "Kodgen/Misc/MemoryHelpers.h"
 
 using namespace kodgen;
 
@@ -41,12 +43,15 @@ FileParser::~FileParser() noexcept
 	}
 }
 
-bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_result) noexcept
+bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_result, CancellationToken const& cancellationToken) noexcept
 {
 	assert(_settings.use_count() != 0);
 
 	bool isSuccess = false;
 
+	_cancellationToken	= cancellationToken;
+	_deadline			= TimingReport::Clock::now() + std::chrono::milliseconds(_settings->parsingTimeout);
+
 	preParse(toParseFile);
 
 	if (fs::exists(toParseFile) && !fs::is_directory(toParseFile))
@@ -55,10 +60,20 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 		out_result.parsedFile = FilesystemHelpers::sanitizePath(toParseFile);
 
 		//Parse the given file
-		CXTranslationUnit translationUnit = clang_parseTranslationUnit(_clangIndex, toParseFile.string().c_str(), _settings->getCompilationArguments().data(), static_cast<int32>(_settings->getCompilationArguments().size()), nullptr, 0, CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing);
+		TimingReport::Clock::time_point	parseStart		= TimingReport::Clock::now();
+		std::vector<char const*> const&	arguments		= _settings->getCompilationArguments(out_result.parsedFile);
+		CXTranslationUnit				translationUnit	= clang_parseTranslationUnit(_clangIndex, toParseFile.string().c_str(), arguments.data(), static_cast<int32>(arguments.size()), nullptr, 0, CXTranslationUnit_SkipFunctionBodies | CXTranslationUnit_Incomplete | CXTranslationUnit_KeepGoing);
+
+		out_result.timings.addSpan("Parsing", "clang_parseTranslationUnit", out_result.parsedFile.string(), parseStart, TimingReport::Clock::now());
 
-		if (translationUnit != nullptr)
+		if (translationUnit != nullptr && checkInterruption(out_result))
+		{
+			clang_disposeTranslationUnit(translationUnit);
+		}
+		else if (translationUnit != nullptr)
 		{
+			ScopedTimingSpan visitSpan(&out_result.timings, "Parsing", "AST visit", out_result.parsedFile.string());
+
 			ParsingContext& context = pushContext(translationUnit, out_result);
 
 			if (clang_visitChildren(context.rootCursor, &FileParser::parseNestedEntity, this) || !out_result.errors.empty())
@@ -70,6 +85,13 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 				//Refresh all outer entities contained in the final result
 				refreshOuterEntity(out_result);
 
+				out_result.buildEntityTable();
+
+				if (_settings->shouldBuildEntityIndex)
+				{
+					out_result.buildEntityIndex();
+				}
+
 				isSuccess = true;
 			}
 
@@ -83,6 +105,8 @@ bool FileParser::parse(fs::path const& toParseFile, FileParsingResult& out_resul
 				logDiagnostic(translationUnit);
 			}
 
+			out_result.translationUnitMemory = MemoryHelpers::getTranslationUnitMemory(translationUnit);
+
 			clang_disposeTranslationUnit(translationUnit);
 		}
 		else
@@ -111,6 +135,11 @@ CXChildVisitResult FileParser::parseNestedEntity(CXCursor cursor, CXCursor /* pa
 
 	DISABLE_WARNING_POP
 
+	if (parser->checkInterruption(*parser->getParsingResult()))
+	{
+		return CXChildVisitResult::CXChildVisit_Break;
+	}
+
 	//Parse the given file ONLY, ignore headers
 	if (clang_Location_isFromMainFile(clang_getCursorLocation(cursor)))
 	{
@@ -150,6 +179,24 @@ CXChildVisitResult FileParser::parseNestedEntity(CXCursor cursor, CXCursor /* pa
 	return visitResult;
 }
 
+bool FileParser::checkInterruption(FileParsingResult& out_result) noexcept
+{
+	if (_cancellationToken.isCancellationRequested())
+	{
+		out_result.errors.emplace_back("Parsing of " + out_result.parsedFile.string() + " was cancelled.");
+
+		return true;
+	}
+	else if (_settings->parsingTimeout != 0u && TimingReport::Clock::now() > _deadline)
+	{
+		out_result.errors.emplace_back("Parsing of " + out_result.parsedFile.string() + " timed out after " + std::to_string(_settings->parsingTimeout) + " ms.");
+
+		return true;
+	}
+
+	return false;
+}
+
 ParsingContext& FileParser::pushContext(CXTranslationUnit const& translationUnit, FileParsingResult& out_result) noexcept
 {
 	_propertyParser.setup(_settings->propertyParsingSettings);
@@ -270,7 +317,8 @@ void FileParser::postParse(fs::path const&, FileParsingResult const&) noexcept
 
 bool FileParser::logDiagnostic(CXTranslationUnit const& translationUnit) const noexcept
 {
-	if (logger != nullptr)
+	//Diagnostics are logged as warnings, don't format them if warnings are discarded
+	if (logger != nullptr && logger->isLogged(ILogger::ELogSeverity::Warning))
 	{
 		CXDiagnosticSet diagnostics = clang_getDiagnosticSetFromTU(translationUnit);
 
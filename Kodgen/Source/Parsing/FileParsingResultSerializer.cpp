@@ -0,0 +1,758 @@
+#include "Kodgen/Parsing/FileParsingResultSerializer.h"
+
+#include <fstream>
+#include <cstring>	//std::memcpy
+
+#include "Kodgen/InfoStructures/NestedStructClassInfo.h"
+
+using namespace kodgen;
+
+using Format = FileParsingResultFormat;
+
+Format::StringRef FileParsingResultSerializer::addString(Writer& writer, std::string_view value) noexcept
+{
+	auto it = writer.stringRefsByValue.find(value);
+
+	if (it != writer.stringRefsByValue.cend())
+	{
+		return it->second;
+	}
+
+	Format::StringRef ref{ static_cast<uint32>(writer.strings.size()), static_cast<uint32>(value.size()) };
+
+	writer.strings.insert(writer.strings.cend(), value.cbegin(), value.cend());
+	writer.stringRefsByValue.emplace(value, ref);
+
+	return ref;
+}
+
+uint32 FileParsingResultSerializer::addType(Writer& writer, TypeInfo const& type) noexcept
+{
+	uint32				index = static_cast<uint32>(writer.types.size());
+	Format::TypeRecord	record;
+
+	writer.types.emplace_back();
+
+	record.fullName				= addString(writer, type._fullName);
+	record.canonicalFullName	= addString(writer, type._canonicalFullName);
+	record.sizeInBytes			= type.sizeInBytes;
+	record.typeParts			= Format::Range{ static_cast<uint32>(writer.typeParts.size()), static_cast<uint32>(type.typeParts.size()) };
+	writer.typeParts.insert(writer.typeParts.cend(), type.typeParts.cbegin(), type.typeParts.cend());
+
+	//Reserve the template parameters block first so that the types of the parameters are stored after it
+	record.templateParams = Format::Range{ static_cast<uint32>(writer.templateParams.size()), static_cast<uint32>(type._templateParameters.size()) };
+	writer.templateParams.resize(writer.templateParams.size() + type._templateParameters.size());
+
+	for (uint32 i = 0u; i < record.templateParams.count; i++)
+	{
+		TemplateParamInfo const&	templateParam = type._templateParameters[i];
+		Format::TemplateParamRecord	templateParamRecord;
+
+		templateParamRecord.kind	= static_cast<int32>(templateParam.kind);
+		templateParamRecord.name	= addString(writer, templateParam.name);
+		templateParamRecord.type	= (templateParam.type != nullptr) ? addType(writer, *templateParam.type) : Format::invalidIndex;
+
+		writer.templateParams[record.templateParams.first + i] = templateParamRecord;
+	}
+
+	writer.types[index] = record;
+
+	return index;
+}
+
+Format::Range FileParsingResultSerializer::addProperties(Writer& writer, std::vector<Property> const& properties) noexcept
+{
+	Format::Range range{ static_cast<uint32>(writer.properties.size()), static_cast<uint32>(properties.size()) };
+
+	for (Property const& property : properties)
+	{
+		Format::PropertyRecord& record = writer.properties.emplace_back();
+
+		record.name			= addString(writer, property.name);
+		record.arguments	= Format::Range{ static_cast<uint32>(writer.stringRefs.size()), static_cast<uint32>(property.arguments.size()) };
+
+		for (std::string const& argument : property.arguments)
+		{
+			writer.stringRefs.emplace_back(addString(writer, argument));
+		}
+	}
+
+	return range;
+}
+
+Format::Range FileParsingResultSerializer::addEntities(Writer& writer, std::vector<PendingEntity> const& entities, uint32 outerEntity) noexcept
+{
+	Format::Range range{ static_cast<uint32>(writer.entities.size()), static_cast<uint32>(entities.size()) };
+
+	for (PendingEntity const& pendingEntity : entities)
+	{
+		Format::EntityRecord record{};
+
+		record.accessSpecifier	= static_cast<uint8>(pendingEntity.accessSpecifier);
+		record.outerEntity		= outerEntity;
+		fillEntityRecord(writer, *pendingEntity.entity, record);
+
+		writer.entities.push_back(record);
+		writer.encodedEntities.push_back(pendingEntity.entity);
+	}
+
+	return range;
+}
+
+void FileParsingResultSerializer::fillEntityRecord(Writer& writer, EntityInfo const& entity, Format::EntityRecord& out_record) noexcept
+{
+	out_record.entityType		= static_cast<uint16>(entity.entityType);
+	out_record.name				= addString(writer, entity.name);
+	out_record.id				= addString(writer, entity.id);
+	out_record.properties		= addProperties(writer, entity.properties);
+	out_record.type				= Format::invalidIndex;
+	out_record.underlyingType	= Format::invalidIndex;
+
+	switch (entity.entityType)
+	{
+		case EEntityType::Field:
+			{
+				FieldInfo const& field = static_cast<FieldInfo const&>(entity);
+
+				out_record.accessSpecifier	= static_cast<uint8>(field.accessSpecifier);
+				out_record.value			= field.memoryOffset;
+				out_record.flags			|= field.isMutable ? Format::IsMutable : 0u;
+			}
+			[[fallthrough]];
+
+		case EEntityType::Variable:
+			{
+				VariableInfo const& variable = static_cast<VariableInfo const&>(entity);
+
+				out_record.type		= addType(writer, variable.type);
+				out_record.flags	|= variable.isStatic ? Format::IsStatic : 0u;
+			}
+			break;
+
+		case EEntityType::Method:
+			{
+				MethodInfo const& method = static_cast<MethodInfo const&>(entity);
+
+				out_record.accessSpecifier	= static_cast<uint8>(method.accessSpecifier);
+				out_record.flags			|=	(method.isDefault ? Format::IsDefault : 0u) |
+												(method.isVirtual ? Format::IsVirtual : 0u) |
+												(method.isPureVirtual ? Format::IsPureVirtual : 0u) |
+												(method.isOverride ? Format::IsOverride : 0u) |
+												(method.isFinal ? Format::IsFinal : 0u) |
+												(method.isConst ? Format::IsConst : 0u);
+			}
+			[[fallthrough]];
+
+		case EEntityType::Function:
+			{
+				FunctionInfo const& function = static_cast<FunctionInfo const&>(entity);
+
+				out_record.prototype	= addString(writer, function.prototype);
+				out_record.type			= addType(writer, function.returnType);
+				out_record.flags		|=	(function.isInline ? Format::IsInline : 0u) |
+											(function.isStatic ? Format::IsStatic : 0u);
+				out_record.parameters	= Format::Range{ static_cast<uint32>(writer.functionParams.size()), static_cast<uint32>(function.parameters.size()) };
+
+				for (FunctionParamInfo const& parameter : function.parameters)
+				{
+					Format::FunctionParamRecord& parameterRecord = writer.functionParams.emplace_back();
+
+					parameterRecord.type	= addType(writer, parameter.type);
+					parameterRecord.padding	= 0u;
+					parameterRecord.name	= addString(writer, parameter.name);
+				}
+			}
+			break;
+
+		case EEntityType::EnumValue:
+			out_record.value = static_cast<EnumValueInfo const&>(entity).value;
+			break;
+
+		case EEntityType::Enum:
+			{
+				EnumInfo const& enumInfo = static_cast<EnumInfo const&>(entity);
+
+				out_record.type				= addType(writer, enumInfo.type);
+				out_record.underlyingType	= addType(writer, enumInfo.underlyingType);
+			}
+			break;
+
+		case EEntityType::Struct:
+			[[fallthrough]];
+		case EEntityType::Class:
+			{
+				StructClassInfo const& structClass = static_cast<StructClassInfo const&>(entity);
+
+				out_record.type		= addType(writer, structClass.type);
+				out_record.flags	|=	(structClass.qualifiers.isFinal ? Format::IsFinal : 0u) |
+										(structClass.isForwardDeclaration ? Format::IsForwardDeclaration : 0u) |
+										(structClass.isImportExport ? Format::IsImportExport : 0u);
+				out_record.parents	= Format::Range{ static_cast<uint32>(writer.parents.size()), static_cast<uint32>(structClass.parents.size()) };
+
+				for (StructClassInfo::ParentInfo const& parent : structClass.parents)
+				{
+					writer.parents.push_back(Format::ParentRecord{ static_cast<uint32>(parent.inheritanceAccess), addType(writer, parent.type) });
+				}
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+void FileParsingResultSerializer::collectChildren(EntityInfo const& entity, std::vector<PendingEntity>& out_children) noexcept
+{
+	out_children.clear();
+
+	switch (entity.entityType)
+	{
+		case EEntityType::Namespace:
+			{
+				NamespaceInfo const& namespaceInfo = static_cast<NamespaceInfo const&>(entity);
+
+				for (NamespaceInfo const& nestedNamespace : namespaceInfo.namespaces)
+				{
+					out_children.push_back(PendingEntity{ &nestedNamespace, EAccessSpecifier::Invalid });
+				}
+
+				for (StructClassInfo const& structInfo : namespaceInfo.structs)
+				{
+					out_children.push_back(PendingEntity{ &structInfo, EAccessSpecifier::Invalid });
+				}
+
+				for (StructClassInfo const& classInfo : namespaceInfo.classes)
+				{
+					out_children.push_back(PendingEntity{ &classInfo, EAccessSpecifier::Invalid });
+				}
+
+				for (EnumInfo const& enumInfo : namespaceInfo.enums)
+				{
+					out_children.push_back(PendingEntity{ &enumInfo, EAccessSpecifier::Invalid });
+				}
+
+				for (FunctionInfo const& function : namespaceInfo.functions)
+				{
+					out_children.push_back(PendingEntity{ &function, EAccessSpecifier::Invalid });
+				}
+
+				for (VariableInfo const& variable : namespaceInfo.variables)
+				{
+					out_children.push_back(PendingEntity{ &variable, EAccessSpecifier::Invalid });
+				}
+			}
+			break;
+
+		case EEntityType::Struct:
+			[[fallthrough]];
+		case EEntityType::Class:
+			{
+				StructClassInfo const& structClass = static_cast<StructClassInfo const&>(entity);
+
+				for (std::shared_ptr<NestedStructClassInfo> const& nestedStruct : structClass.nestedStructs)
+				{
+					out_children.push_back(PendingEntity{ nestedStruct.get(), nestedStruct->accessSpecifier });
+				}
+
+				for (std::shared_ptr<NestedStructClassInfo> const& nestedClass : structClass.nestedClasses)
+				{
+					out_children.push_back(PendingEntity{ nestedClass.get(), nestedClass->accessSpecifier });
+				}
+
+				for (NestedEnumInfo const& nestedEnum : structClass.nestedEnums)
+				{
+					out_children.push_back(PendingEntity{ &nestedEnum, nestedEnum.accessSpecifier });
+				}
+
+				//Fields and methods store their own access specifier
+				for (FieldInfo const& field : structClass.fields)
+				{
+					out_children.push_back(PendingEntity{ &field, EAccessSpecifier::Invalid });
+				}
+
+				for (MethodInfo const& method : structClass.methods)
+				{
+					out_children.push_back(PendingEntity{ &method, EAccessSpecifier::Invalid });
+				}
+			}
+			break;
+
+		case EEntityType::Enum:
+			for (EnumValueInfo const& enumValue : static_cast<EnumInfo const&>(entity).enumValues)
+			{
+				out_children.push_back(PendingEntity{ &enumValue, EAccessSpecifier::Invalid });
+			}
+			break;
+
+		default:
+			break;
+	}
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Type const& view, TypeInfo& out_value) noexcept
+{
+	out_value._fullName				= view.getFullName();
+	out_value._canonicalFullName	= view.getCanonicalFullName();
+	out_value.sizeInBytes			= static_cast<size_t>(view.getSizeInBytes());
+	out_value.typeParts.assign(view.getTypeParts(), view.getTypeParts() + view.getTypePartCount());
+
+	out_value._templateParameters.clear();
+	out_value._templateParameters.reserve(view.getTemplateParams().size());
+
+	for (FileParsingResultView::TemplateParam templateParamView : view.getTemplateParams())
+	{
+		TemplateParamInfo& templateParam = out_value._templateParameters.emplace_back();
+
+		templateParam.kind = templateParamView.getKind();
+		templateParam.name = templateParamView.getName();
+
+		if (templateParamView.getType().isValid())
+		{
+			templateParam.type = std::make_unique<TypeInfo>();
+			read(templateParamView.getType(), *templateParam.type);
+		}
+	}
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, EntityInfo& out_value) noexcept
+{
+	out_value.entityType	= view.getEntityType();
+	out_value.name			= view.getName();
+	out_value.id			= view.getId();
+	out_value.outerEntity	= nullptr;
+
+	out_value.properties.clear();
+	out_value.properties.reserve(view.getProperties().size());
+
+	for (FileParsingResultView::Property propertyView : view.getProperties())
+	{
+		Property& property = out_value.properties.emplace_back();
+
+		property.name = propertyView.getName();
+		property.arguments.reserve(propertyView.getArgumentCount());
+
+		for (uint32 i = 0u; i < propertyView.getArgumentCount(); i++)
+		{
+			property.arguments.emplace_back(propertyView.getArgument(i));
+		}
+	}
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, VariableInfo& out_value) noexcept
+{
+	read(view, static_cast<EntityInfo&>(out_value));
+	out_value.isStatic = view.hasFlag(Format::IsStatic);
+	read(view.getType(), out_value.type);
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, FieldInfo& out_value) noexcept
+{
+	read(view, static_cast<VariableInfo&>(out_value));
+	out_value.isMutable			= view.hasFlag(Format::IsMutable);
+	out_value.accessSpecifier	= view.getAccessSpecifier();
+	out_value.memoryOffset		= view.getValue();
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, FunctionInfo& out_value) noexcept
+{
+	read(view, static_cast<EntityInfo&>(out_value));
+	out_value.prototype	= view.getPrototype();
+	out_value.isInline	= view.hasFlag(Format::IsInline);
+	out_value.isStatic	= view.hasFlag(Format::IsStatic);
+	read(view.getType(), out_value.returnType);
+
+	out_value.parameters.clear();
+	out_value.parameters.reserve(view.getParameters().size());
+
+	for (FileParsingResultView::FunctionParam parameterView : view.getParameters())
+	{
+		FunctionParamInfo& parameter = out_value.parameters.emplace_back();
+
+		parameter.name = parameterView.getName();
+		read(parameterView.getType(), parameter.type);
+	}
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, MethodInfo& out_value) noexcept
+{
+	read(view, static_cast<FunctionInfo&>(out_value));
+	out_value.accessSpecifier	= view.getAccessSpecifier();
+	out_value.isDefault			= view.hasFlag(Format::IsDefault);
+	out_value.isVirtual			= view.hasFlag(Format::IsVirtual);
+	out_value.isPureVirtual		= view.hasFlag(Format::IsPureVirtual);
+	out_value.isOverride		= view.hasFlag(Format::IsOverride);
+	out_value.isFinal			= view.hasFlag(Format::IsFinal);
+	out_value.isConst			= view.hasFlag(Format::IsConst);
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, EnumValueInfo& out_value) noexcept
+{
+	read(view, static_cast<EntityInfo&>(out_value));
+	out_value.value = view.getValue();
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, EnumInfo& out_value) noexcept
+{
+	read(view, static_cast<EntityInfo&>(out_value));
+	read(view.getType(), out_value.type);
+	read(view.getUnderlyingType(), out_value.underlyingType);
+
+	out_value.enumValues.clear();
+	out_value.enumValues.reserve(view.getChildren().size());
+
+	for (FileParsingResultView::Entity child : view.getChildren())
+	{
+		if (child.getEntityType() == EEntityType::EnumValue)
+		{
+			read(child, out_value.enumValues.emplace_back());
+		}
+	}
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, StructClassInfo& out_value) noexcept
+{
+	read(view, static_cast<EntityInfo&>(out_value));
+	out_value.qualifiers.isFinal	= view.hasFlag(Format::IsFinal);
+	out_value.isForwardDeclaration	= view.hasFlag(Format::IsForwardDeclaration);
+	out_value.isImportExport		= view.hasFlag(Format::IsImportExport);
+	read(view.getType(), out_value.type);
+
+	out_value.parents.clear();
+	out_value.parents.reserve(view.getParents().size());
+
+	for (FileParsingResultView::Parent parentView : view.getParents())
+	{
+		TypeInfo parentType;
+
+		read(parentView.getType(), parentType);
+
+		out_value.parents.emplace_back(parentView.getInheritanceAccess(), std::move(parentType));
+	}
+
+	out_value.nestedStructs.clear();
+	out_value.nestedClasses.clear();
+	out_value.nestedEnums.clear();
+	out_value.fields.clear();
+	out_value.methods.clear();
+
+	for (FileParsingResultView::Entity child : view.getChildren())
+	{
+		switch (child.getEntityType())
+		{
+			case EEntityType::Struct:
+				[[fallthrough]];
+			case EEntityType::Class:
+				{
+					StructClassInfo nestedStructClass;
+
+					read(child, nestedStructClass);
+
+					((child.getEntityType() == EEntityType::Struct) ? out_value.nestedStructs : out_value.nestedClasses)
+						.emplace_back(std::make_shared<NestedStructClassInfo>(std::move(nestedStructClass), child.getAccessSpecifier()));
+				}
+				break;
+
+			case EEntityType::Enum:
+				{
+					EnumInfo nestedEnum;
+
+					read(child, nestedEnum);
+
+					out_value.nestedEnums.emplace_back(std::move(nestedEnum), child.getAccessSpecifier());
+				}
+				break;
+
+			case EEntityType::Field:
+				read(child, out_value.fields.emplace_back());
+				break;
+
+			case EEntityType::Method:
+				read(child, out_value.methods.emplace_back());
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+void FileParsingResultSerializer::read(FileParsingResultView::Entity const& view, NamespaceInfo& out_value) noexcept
+{
+	read(view, static_cast<EntityInfo&>(out_value));
+
+	out_value.namespaces.clear();
+	out_value.structs.clear();
+	out_value.classes.clear();
+	out_value.enums.clear();
+	out_value.functions.clear();
+	out_value.variables.clear();
+
+	for (FileParsingResultView::Entity child : view.getChildren())
+	{
+		switch (child.getEntityType())
+		{
+			case EEntityType::Namespace:
+				read(child, out_value.namespaces.emplace_back());
+				break;
+
+			case EEntityType::Struct:
+				read(child, out_value.structs.emplace_back());
+				break;
+
+			case EEntityType::Class:
+				read(child, out_value.classes.emplace_back());
+				break;
+
+			case EEntityType::Enum:
+				read(child, out_value.enums.emplace_back());
+				break;
+
+			case EEntityType::Function:
+				read(child, out_value.functions.emplace_back());
+				break;
+
+			case EEntityType::Variable:
+				read(child, out_value.variables.emplace_back());
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+bool FileParsingResultSerializer::serialize(FileParsingResult const& result, std::vector<uint8>& out_buffer) noexcept
+{
+	Writer						writer;
+	std::vector<PendingEntity>	pendingEntities;
+	std::string					parsedFile = result.parsedFile.string();
+	Format::Header				header{};
+
+	header.magic					= Format::magic;
+	header.version					= Format::version;
+	header.translationUnitMemory	= result.translationUnitMemory;
+	header.parsedFile				= addString(writer, parsedFile);
+
+	for (ParsingError const& error : result.errors)
+	{
+		writer.errors.push_back(Format::ErrorRecord{ addString(writer, error.getDescription()), addString(writer, error.getFilename()),
+													 error.getLine(), error.getColumn() });
+	}
+
+	//Top-level entities are stored in the same order as the children of a namespace
+	for (NamespaceInfo const& namespaceInfo : result.namespaces)
+	{
+		pendingEntities.push_back(PendingEntity{ &namespaceInfo, EAccessSpecifier::Invalid });
+	}
+
+	for (StructClassInfo const& structInfo : result.structs)
+	{
+		pendingEntities.push_back(PendingEntity{ &structInfo, EAccessSpecifier::Invalid });
+	}
+
+	for (StructClassInfo const& classInfo : result.classes)
+	{
+		pendingEntities.push_back(PendingEntity{ &classInfo, EAccessSpecifier::Invalid });
+	}
+
+	for (EnumInfo const& enumInfo : result.enums)
+	{
+		pendingEntities.push_back(PendingEntity{ &enumInfo, EAccessSpecifier::Invalid });
+	}
+
+	for (FunctionInfo const& function : result.functions)
+	{
+		pendingEntities.push_back(PendingEntity{ &function, EAccessSpecifier::Invalid });
+	}
+
+	for (VariableInfo const& variable : result.variables)
+	{
+		pendingEntities.push_back(PendingEntity{ &variable, EAccessSpecifier::Invalid });
+	}
+
+	header.rootEntities = addEntities(writer, pendingEntities, Format::invalidIndex);
+
+	//Breadth-first traversal: the children of each entity are appended as a contiguous block after all previous entities
+	for (uint32 i = 0u; i < writer.encodedEntities.size(); i++)
+	{
+		collectChildren(*writer.encodedEntities[i], pendingEntities);
+
+		if (!pendingEntities.empty())
+		{
+			Format::Range children = addEntities(writer, pendingEntities, i);
+
+			writer.entities[i].children = children;
+		}
+	}
+
+	for (auto const& [childName, inheritanceLinks] : result.structClassTree.getEntries())
+	{
+		for (StructClassTree::InheritanceLink const& inheritanceLink : inheritanceLinks)
+		{
+			writer.inheritanceLinks.push_back(Format::InheritanceLinkRecord{ addString(writer, childName),
+																			 addString(writer, inheritanceLink.inheritedStructClassName),
+																			 static_cast<uint32>(inheritanceLink.inheritanceAccess), 0u });
+		}
+	}
+
+	//Lay the sections out after the header
+	uint64 size = sizeof(Format::Header);
+
+	auto placeSection = [&size](Format::Section& out_section, size_t count, size_t recordSize)
+	{
+		size = (size + 7u) & ~static_cast<uint64>(7u);
+
+		out_section.offset	= static_cast<uint32>(size);
+		out_section.count	= static_cast<uint32>(count);
+
+		size += static_cast<uint64>(count) * recordSize;
+	};
+
+	placeSection(header.strings,			writer.strings.size(),			1u);
+	placeSection(header.stringRefs,			writer.stringRefs.size(),		sizeof(Format::StringRef));
+	placeSection(header.errors,				writer.errors.size(),			sizeof(Format::ErrorRecord));
+	placeSection(header.entities,			writer.entities.size(),			sizeof(Format::EntityRecord));
+	placeSection(header.types,				writer.types.size(),			sizeof(Format::TypeRecord));
+	placeSection(header.typeParts,			writer.typeParts.size(),		sizeof(TypePart));
+	placeSection(header.templateParams,		writer.templateParams.size(),	sizeof(Format::TemplateParamRecord));
+	placeSection(header.properties,			writer.properties.size(),		sizeof(Format::PropertyRecord));
+	placeSection(header.functionParams,		writer.functionParams.size(),	sizeof(Format::FunctionParamRecord));
+	placeSection(header.parents,			writer.parents.size(),			sizeof(Format::ParentRecord));
+	placeSection(header.inheritanceLinks,	writer.inheritanceLinks.size(),	sizeof(Format::InheritanceLinkRecord));
+
+	header.size = size;
+
+	//Section offsets are stored on 32 bits
+	if (size > 0xFFFFFFFFu)
+	{
+		out_buffer.clear();
+
+		return false;
+	}
+
+	out_buffer.assign(static_cast<size_t>(size), 0u);
+
+	auto copySection = [&out_buffer](Format::Section const& section, void const* data, size_t recordSize)
+	{
+		if (section.count != 0u)
+		{
+			std::memcpy(out_buffer.data() + section.offset, data, section.count * recordSize);
+		}
+	};
+
+	std::memcpy(out_buffer.data(), &header, sizeof(Format::Header));
+	copySection(header.strings,				writer.strings.data(),			1u);
+	copySection(header.stringRefs,			writer.stringRefs.data(),		sizeof(Format::StringRef));
+	copySection(header.errors,				writer.errors.data(),			sizeof(Format::ErrorRecord));
+	copySection(header.entities,			writer.entities.data(),			sizeof(Format::EntityRecord));
+	copySection(header.types,				writer.types.data(),			sizeof(Format::TypeRecord));
+	copySection(header.typeParts,			writer.typeParts.data(),		sizeof(TypePart));
+	copySection(header.templateParams,		writer.templateParams.data(),	sizeof(Format::TemplateParamRecord));
+	copySection(header.properties,			writer.properties.data(),		sizeof(Format::PropertyRecord));
+	copySection(header.functionParams,		writer.functionParams.data(),	sizeof(Format::FunctionParamRecord));
+	copySection(header.parents,				writer.parents.data(),			sizeof(Format::ParentRecord));
+	copySection(header.inheritanceLinks,	writer.inheritanceLinks.data(),	sizeof(Format::InheritanceLinkRecord));
+
+	return true;
+}
+
+bool FileParsingResultSerializer::serialize(FileParsingResult const& result, fs::path const& file) noexcept
+{
+	std::vector<uint8> buffer;
+
+	if (!serialize(result, buffer))
+	{
+		return false;
+	}
+
+	std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+
+	stream.write(reinterpret_cast<char const*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+
+	return stream.good();
+}
+
+bool FileParsingResultSerializer::deserialize(uint8 const* data, size_t size, FileParsingResult& out_result) noexcept
+{
+	FileParsingResultView view;
+
+	out_result = FileParsingResult();
+
+	if (!view.open(data, size))
+	{
+		return false;
+	}
+
+	out_result.parsedFile				= view.getParsedFile();
+	out_result.translationUnitMemory	= view.getTranslationUnitMemory();
+
+	for (FileParsingResultView::ParsingError errorView : view.getErrors())
+	{
+		out_result.errors.emplace_back(std::string(errorView.getDescription()), std::string(errorView.getFilename()), errorView.getLine(), errorView.getColumn());
+	}
+
+	for (FileParsingResultView::Entity entityView : view.getRootEntities())
+	{
+		switch (entityView.getEntityType())
+		{
+			case EEntityType::Namespace:
+				read(entityView, out_result.namespaces.emplace_back());
+				break;
+
+			case EEntityType::Struct:
+				read(entityView, out_result.structs.emplace_back());
+				break;
+
+			case EEntityType::Class:
+				read(entityView, out_result.classes.emplace_back());
+				break;
+
+			case EEntityType::Enum:
+				read(entityView, out_result.enums.emplace_back());
+				break;
+
+			case EEntityType::Function:
+				read(entityView, out_result.functions.emplace_back());
+				break;
+
+			case EEntityType::Variable:
+				read(entityView, out_result.variables.emplace_back());
+				break;
+
+			default:
+				break;
+		}
+	}
+
+	for (FileParsingResultView::InheritanceLink linkView : view.getInheritanceLinks())
+	{
+		out_result.structClassTree.addInheritanceLink(std::string(linkView.getChildStructClassName()),
+													  std::string(linkView.getInheritedStructClassName()),
+													  linkView.getInheritanceAccess());
+	}
+
+	//Entities have been moved into their final location, so outer entities can be linked now
+	for (NamespaceInfo& namespaceInfo : out_result.namespaces)
+	{
+		namespaceInfo.refreshOuterEntity();
+	}
+
+	for (StructClassInfo& classInfo : out_result.classes)
+	{
+		classInfo.refreshOuterEntity();
+	}
+
+	for (StructClassInfo& structInfo : out_result.structs)
+	{
+		structInfo.refreshOuterEntity();
+	}
+
+	for (EnumInfo& enumInfo : out_result.enums)
+	{
+		enumInfo.refreshOuterEntity();
+	}
+
+	out_result.buildEntityTable();
+
+	return true;
+}
\ No newline at end of file
@@ -20,6 +20,14 @@ ParsingError::ParsingError(std::string errorDescription, CXSourceLocation errorS
 	}
 }
 
+ParsingError::ParsingError(std::string errorDescription, std::string filename, unsigned line, unsigned column) noexcept:
+	_line{line},
+	_column{column},
+	_filename{std::move(filename)},
+	_description{std::move(errorDescription)}
+{
+}
+
 std::string const& ParsingError::getFilename() const noexcept
 {
 	return _filename;
@@ -0,0 +1,129 @@
+#include "Kodgen/Parsing/ParsingResults/FileParsingResult.h"
+
+#include "Kodgen/Misc/MemoryHelpers.h"
+
+#include <vector>
+
+using namespace kodgen;
+
+static constexpr EEntityType allEntityTypes =	EEntityType::Namespace | EEntityType::Class | EEntityType::Struct | EEntityType::Enum | EEntityType::EnumValue |
+												EEntityType::Variable | EEntityType::Field | EEntityType::Function | EEntityType::Method;
+
+void FileParsingResult::buildEntityTable() noexcept
+{
+	//Entities containing the currently visited entity, with their index in the table
+	std::vector<std::pair<EntityInfo const*, uint32>> outerEntities;
+
+	entityTable.clear();
+
+	//Entities are visited in pre-order, so the outer entity of a visited entity is always on the stack
+	foreachEntityOfType(allEntityTypes, [this, &outerEntities](EntityInfo const& entity)
+						{
+							while (!outerEntities.empty() && outerEntities.back().first != entity.outerEntity)
+							{
+								outerEntities.pop_back();
+							}
+
+							uint32 parentIndex = outerEntities.empty() ? EntityTable::invalidIndex : outerEntities.back().second;
+
+							outerEntities.emplace_back(&entity, entityTable.addEntity(entity, parentIndex));
+						});
+}
+
+void FileParsingResult::buildEntityIndex() noexcept
+{
+	_entitiesById.clear();
+	_entitiesByFullName.clear();
+
+	foreachEntityOfType(allEntityTypes, [this](EntityInfo const& entity)
+						{
+							_entitiesById.emplace(entity.id, &entity);
+							_entitiesByFullName.emplace(entity.getFullName(), &entity);
+						});
+
+	_hasEntityIndex = true;
+}
+
+bool FileParsingResult::hasEntityIndex() const noexcept
+{
+	return _hasEntityIndex;
+}
+
+EntityInfo const* FileParsingResult::findEntityById(std::string_view id) const noexcept
+{
+	auto it = _entitiesById.find(id);
+
+	return (it != _entitiesById.cend()) ? it->second : nullptr;
+}
+
+EntityInfo const* FileParsingResult::findEntityByFullName(std::string const& fullName, EEntityType entityMask) const noexcept
+{
+	auto [it, end] = _entitiesByFullName.equal_range(fullName);
+
+	for (; it != end; it++)
+	{
+		if (entityMask && it->second->entityType)
+		{
+			return it->second;
+		}
+	}
+
+	return nullptr;
+}
+
+uint64 FileParsingResult::getMemorySize() const noexcept
+{
+	uint64 result =	sizeof(FileParsingResult) +
+					MemoryHelpers::getAllocatedMemory(parsedFile.native()) +
+					MemoryHelpers::getAllocatedMemory(errors) +
+					MemoryHelpers::getAllocatedMemory(namespaces) +
+					MemoryHelpers::getAllocatedMemory(classes) +
+					MemoryHelpers::getAllocatedMemory(structs) +
+					MemoryHelpers::getAllocatedMemory(enums) +
+					MemoryHelpers::getAllocatedMemory(functions) +
+					MemoryHelpers::getAllocatedMemory(variables) +
+					MemoryHelpers::getAllocatedMemory(timings.spans) +
+					structClassTree.getAllocatedMemory() +
+					entityTable.getAllocatedMemory();
+
+	//Bucket arrays, then one node (next pointer + cached hash + key/value pair) per indexed entity
+	result += (_entitiesById.bucket_count() + _entitiesByFullName.bucket_count()) * sizeof(void*);
+	result += _entitiesById.size() * (sizeof(void*) + sizeof(size_t) + sizeof(std::pair<std::string_view const, EntityInfo const*>));
+
+	for (auto const& [fullName, entity] : _entitiesByFullName)
+	{
+		result += sizeof(void*) + sizeof(size_t) + sizeof(std::pair<std::string const, EntityInfo const*>) + MemoryHelpers::getAllocatedMemory(fullName);
+	}
+
+	for (NamespaceInfo const& namespace_ : namespaces)
+	{
+		result += namespace_.getAllocatedMemory();
+	}
+
+	for (StructClassInfo const& class_ : classes)
+	{
+		result += class_.getAllocatedMemory();
+	}
+
+	for (StructClassInfo const& struct_ : structs)
+	{
+		result += struct_.getAllocatedMemory();
+	}
+
+	for (EnumInfo const& enum_ : enums)
+	{
+		result += enum_.getAllocatedMemory();
+	}
+
+	for (FunctionInfo const& function : functions)
+	{
+		result += function.getAllocatedMemory();
+	}
+
+	for (VariableInfo const& variable : variables)
+	{
+		result += variable.getAllocatedMemory();
+	}
+
+	return result;
+}
\ No newline at end of file
@@ -0,0 +1,427 @@
+#include "Kodgen/Parsing/ParsingResults/FileParsingResultView.h"
+
+#include <algorithm>	//std::min
+#include <cstdint>		//uintptr_t
+
+using namespace kodgen;
+
+using Format = FileParsingResultFormat;
+
+FileParsingResultView::TemplateParam::TemplateParam(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::TemplateParamRecord>(result->getHeader().templateParams, index)},
+	_index{index}
+{
+}
+
+ETemplateParameterKind FileParsingResultView::TemplateParam::getKind() const noexcept
+{
+	return (_record != nullptr) ? static_cast<ETemplateParameterKind>(_record->kind) : ETemplateParameterKind::Undefined;
+}
+
+std::string_view FileParsingResultView::TemplateParam::getName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->name) : std::string_view();
+}
+
+FileParsingResultView::Type FileParsingResultView::TemplateParam::getType() const noexcept
+{
+	if (_record == nullptr)
+	{
+		return Type(_result, Format::invalidIndex);
+	}
+
+	Format::TypeRecord const* typeRecord = _result->getRecord<Format::TypeRecord>(_result->getHeader().types, _record->type);
+
+	//The template parameters of the type must be stored after this parameter, else a corrupted buffer could loop
+	if (typeRecord != nullptr && typeRecord->templateParams.count != 0u && typeRecord->templateParams.first <= _index)
+	{
+		return Type(_result, Format::invalidIndex);
+	}
+
+	return Type(_result, _record->type);
+}
+
+FileParsingResultView::Type::Type(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::TypeRecord>(result->getHeader().types, index)}
+{
+}
+
+bool FileParsingResultView::Type::isValid() const noexcept
+{
+	return _record != nullptr;
+}
+
+std::string_view FileParsingResultView::Type::getFullName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->fullName) : std::string_view();
+}
+
+std::string_view FileParsingResultView::Type::getCanonicalFullName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->canonicalFullName) : std::string_view();
+}
+
+uint64 FileParsingResultView::Type::getSizeInBytes() const noexcept
+{
+	return (_record != nullptr) ? _record->sizeInBytes : 0u;
+}
+
+FileParsingResultView::Range<FileParsingResultView::TemplateParam> FileParsingResultView::Type::getTemplateParams() const noexcept
+{
+	if (_record == nullptr)
+	{
+		return Range<TemplateParam>();
+	}
+
+	Format::Range range = _result->clampRange(_result->getHeader().templateParams, _record->templateParams);
+
+	return Range<TemplateParam>(_result, range.first, range.count);
+}
+
+TypePart const* FileParsingResultView::Type::getTypeParts() const noexcept
+{
+	return (_record != nullptr) ? _result->getRecord<TypePart>(_result->getHeader().typeParts, _record->typeParts.first) : nullptr;
+}
+
+uint32 FileParsingResultView::Type::getTypePartCount() const noexcept
+{
+	return (_record != nullptr) ? _result->clampRange(_result->getHeader().typeParts, _record->typeParts).count : 0u;
+}
+
+FileParsingResultView::Property::Property(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::PropertyRecord>(result->getHeader().properties, index)}
+{
+}
+
+std::string_view FileParsingResultView::Property::getName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->name) : std::string_view();
+}
+
+uint32 FileParsingResultView::Property::getArgumentCount() const noexcept
+{
+	return (_record != nullptr) ? _result->clampRange(_result->getHeader().stringRefs, _record->arguments).count : 0u;
+}
+
+std::string_view FileParsingResultView::Property::getArgument(uint32 index) const noexcept
+{
+	if (index >= getArgumentCount())
+	{
+		return std::string_view();
+	}
+
+	return _result->getString(*_result->getRecord<Format::StringRef>(_result->getHeader().stringRefs, _record->arguments.first + index));
+}
+
+FileParsingResultView::FunctionParam::FunctionParam(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::FunctionParamRecord>(result->getHeader().functionParams, index)}
+{
+}
+
+std::string_view FileParsingResultView::FunctionParam::getName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->name) : std::string_view();
+}
+
+FileParsingResultView::Type FileParsingResultView::FunctionParam::getType() const noexcept
+{
+	return Type(_result, (_record != nullptr) ? _record->type : Format::invalidIndex);
+}
+
+FileParsingResultView::Parent::Parent(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::ParentRecord>(result->getHeader().parents, index)}
+{
+}
+
+EAccessSpecifier FileParsingResultView::Parent::getInheritanceAccess() const noexcept
+{
+	return (_record != nullptr) ? static_cast<EAccessSpecifier>(_record->inheritanceAccess) : EAccessSpecifier::Invalid;
+}
+
+FileParsingResultView::Type FileParsingResultView::Parent::getType() const noexcept
+{
+	return Type(_result, (_record != nullptr) ? _record->type : Format::invalidIndex);
+}
+
+FileParsingResultView::Entity::Entity(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::EntityRecord>(result->getHeader().entities, index)},
+	_index{index}
+{
+}
+
+bool FileParsingResultView::Entity::isValid() const noexcept
+{
+	return _record != nullptr;
+}
+
+uint32 FileParsingResultView::Entity::getIndex() const noexcept
+{
+	return _index;
+}
+
+EEntityType FileParsingResultView::Entity::getEntityType() const noexcept
+{
+	return (_record != nullptr) ? static_cast<EEntityType>(_record->entityType) : EEntityType::Undefined;
+}
+
+std::string_view FileParsingResultView::Entity::getName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->name) : std::string_view();
+}
+
+std::string_view FileParsingResultView::Entity::getId() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->id) : std::string_view();
+}
+
+FileParsingResultView::Range<FileParsingResultView::Property> FileParsingResultView::Entity::getProperties() const noexcept
+{
+	if (_record == nullptr)
+	{
+		return Range<Property>();
+	}
+
+	Format::Range range = _result->clampRange(_result->getHeader().properties, _record->properties);
+
+	return Range<Property>(_result, range.first, range.count);
+}
+
+FileParsingResultView::Entity FileParsingResultView::Entity::getOuterEntity() const noexcept
+{
+	//Outer entities are always stored before their children
+	return Entity(_result, (_record != nullptr && _record->outerEntity < _index) ? _record->outerEntity : Format::invalidIndex);
+}
+
+FileParsingResultView::Range<FileParsingResultView::Entity> FileParsingResultView::Entity::getChildren() const noexcept
+{
+	//Children are always stored after their outer entity
+	if (_record == nullptr || _record->children.first <= _index)
+	{
+		return Range<Entity>();
+	}
+
+	Format::Range range = _result->clampRange(_result->getHeader().entities, _record->children);
+
+	return Range<Entity>(_result, range.first, range.count);
+}
+
+EAccessSpecifier FileParsingResultView::Entity::getAccessSpecifier() const noexcept
+{
+	return (_record != nullptr) ? static_cast<EAccessSpecifier>(_record->accessSpecifier) : EAccessSpecifier::Invalid;
+}
+
+bool FileParsingResultView::Entity::hasFlag(Format::EEntityFlags flag) const noexcept
+{
+	return _record != nullptr && (_record->flags & flag) != 0u;
+}
+
+FileParsingResultView::Type FileParsingResultView::Entity::getType() const noexcept
+{
+	return Type(_result, (_record != nullptr) ? _record->type : Format::invalidIndex);
+}
+
+FileParsingResultView::Type FileParsingResultView::Entity::getUnderlyingType() const noexcept
+{
+	return Type(_result, (_record != nullptr) ? _record->underlyingType : Format::invalidIndex);
+}
+
+std::string_view FileParsingResultView::Entity::getPrototype() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->prototype) : std::string_view();
+}
+
+FileParsingResultView::Range<FileParsingResultView::FunctionParam> FileParsingResultView::Entity::getParameters() const noexcept
+{
+	if (_record == nullptr)
+	{
+		return Range<FunctionParam>();
+	}
+
+	Format::Range range = _result->clampRange(_result->getHeader().functionParams, _record->parameters);
+
+	return Range<FunctionParam>(_result, range.first, range.count);
+}
+
+FileParsingResultView::Range<FileParsingResultView::Parent> FileParsingResultView::Entity::getParents() const noexcept
+{
+	if (_record == nullptr)
+	{
+		return Range<Parent>();
+	}
+
+	Format::Range range = _result->clampRange(_result->getHeader().parents, _record->parents);
+
+	return Range<Parent>(_result, range.first, range.count);
+}
+
+int64 FileParsingResultView::Entity::getValue() const noexcept
+{
+	return (_record != nullptr) ? _record->value : 0;
+}
+
+FileParsingResultView::ParsingError::ParsingError(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::ErrorRecord>(result->getHeader().errors, index)}
+{
+}
+
+std::string_view FileParsingResultView::ParsingError::getDescription() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->description) : std::string_view();
+}
+
+std::string_view FileParsingResultView::ParsingError::getFilename() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->filename) : std::string_view();
+}
+
+uint32 FileParsingResultView::ParsingError::getLine() const noexcept
+{
+	return (_record != nullptr) ? _record->line : 0u;
+}
+
+uint32 FileParsingResultView::ParsingError::getColumn() const noexcept
+{
+	return (_record != nullptr) ? _record->column : 0u;
+}
+
+FileParsingResultView::InheritanceLink::InheritanceLink(FileParsingResultView const* result, uint32 index) noexcept:
+	_result{result},
+	_record{result->getRecord<Format::InheritanceLinkRecord>(result->getHeader().inheritanceLinks, index)}
+{
+}
+
+std::string_view FileParsingResultView::InheritanceLink::getChildStructClassName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->childStructClassName) : std::string_view();
+}
+
+std::string_view FileParsingResultView::InheritanceLink::getInheritedStructClassName() const noexcept
+{
+	return (_record != nullptr) ? _result->getString(_record->inheritedStructClassName) : std::string_view();
+}
+
+EAccessSpecifier FileParsingResultView::InheritanceLink::getInheritanceAccess() const noexcept
+{
+	return (_record != nullptr) ? static_cast<EAccessSpecifier>(_record->inheritanceAccess) : EAccessSpecifier::Invalid;
+}
+
+bool FileParsingResultView::isValidSection(Format::Section const& section, size_t recordSize) const noexcept
+{
+	return section.offset % 8u == 0u &&
+		   static_cast<uint64>(section.offset) + static_cast<uint64>(section.count) * recordSize <= _header->size;
+}
+
+std::string_view FileParsingResultView::getString(Format::StringRef const& ref) const noexcept
+{
+	if (_data == nullptr || static_cast<uint64>(ref.offset) + ref.size > _header->strings.count)
+	{
+		return std::string_view();
+	}
+
+	return std::string_view(reinterpret_cast<char const*>(_data + _header->strings.offset + ref.offset), ref.size);
+}
+
+Format::Range FileParsingResultView::clampRange(Format::Section const& section, Format::Range const& range) const noexcept
+{
+	if (range.first >= section.count)
+	{
+		return Format::Range();
+	}
+
+	return Format::Range{ range.first, std::min(range.count, section.count - range.first) };
+}
+
+Format::Header const& FileParsingResultView::getHeader() const noexcept
+{
+	static Format::Header const emptyHeader{};
+
+	return (_data != nullptr) ? *_header : emptyHeader;
+}
+
+bool FileParsingResultView::open(uint8 const* data, size_t size) noexcept
+{
+	_data	= nullptr;
+	_header	= nullptr;
+
+	if (data == nullptr || reinterpret_cast<uintptr_t>(data) % 8u != 0u || size < sizeof(Format::Header))
+	{
+		return false;
+	}
+
+	_header = reinterpret_cast<Format::Header const*>(data);
+
+	bool isValid =	_header->magic == Format::magic &&
+					_header->version == Format::version &&
+					_header->size <= size &&
+					isValidSection(_header->strings,			1u) &&
+					isValidSection(_header->stringRefs,			sizeof(Format::StringRef)) &&
+					isValidSection(_header->errors,				sizeof(Format::ErrorRecord)) &&
+					isValidSection(_header->entities,			sizeof(Format::EntityRecord)) &&
+					isValidSection(_header->types,				sizeof(Format::TypeRecord)) &&
+					isValidSection(_header->typeParts,			sizeof(TypePart)) &&
+					isValidSection(_header->templateParams,		sizeof(Format::TemplateParamRecord)) &&
+					isValidSection(_header->properties,			sizeof(Format::PropertyRecord)) &&
+					isValidSection(_header->functionParams,		sizeof(Format::FunctionParamRecord)) &&
+					isValidSection(_header->parents,			sizeof(Format::ParentRecord)) &&
+					isValidSection(_header->inheritanceLinks,	sizeof(Format::InheritanceLinkRecord));
+
+	if (!isValid)
+	{
+		_header = nullptr;
+
+		return false;
+	}
+
+	_data = data;
+
+	return true;
+}
+
+bool FileParsingResultView::isValid() const noexcept
+{
+	return _data != nullptr;
+}
+
+std::string_view FileParsingResultView::getParsedFile() const noexcept
+{
+	return (_data != nullptr) ? getString(_header->parsedFile) : std::string_view();
+}
+
+uint64 FileParsingResultView::getTranslationUnitMemory() const noexcept
+{
+	return (_data != nullptr) ? _header->translationUnitMemory : 0u;
+}
+
+FileParsingResultView::Range<FileParsingResultView::ParsingError> FileParsingResultView::getErrors() const noexcept
+{
+	return (_data != nullptr) ? Range<ParsingError>(this, 0u, _header->errors.count) : Range<ParsingError>();
+}
+
+FileParsingResultView::Range<FileParsingResultView::Entity> FileParsingResultView::getRootEntities() const noexcept
+{
+	if (_data == nullptr)
+	{
+		return Range<Entity>();
+	}
+
+	Format::Range range = clampRange(_header->entities, _header->rootEntities);
+
+	return Range<Entity>(this, range.first, range.count);
+}
+
+FileParsingResultView::Range<FileParsingResultView::Entity> FileParsingResultView::getEntities() const noexcept
+{
+	return (_data != nullptr) ? Range<Entity>(this, 0u, _header->entities.count) : Range<Entity>();
+}
+
+FileParsingResultView::Range<FileParsingResultView::InheritanceLink> FileParsingResultView::getInheritanceLinks() const noexcept
+{
+	return (_data != nullptr) ? Range<InheritanceLink>(this, 0u, _header->inheritanceLinks.count) : Range<InheritanceLink>();
+}
\ No newline at end of file
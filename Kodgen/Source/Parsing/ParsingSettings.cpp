@@ -124,10 +124,41 @@ void ParsingSettings::refreshCompilationArguments(ILogger* logger) noexcept
 	_compilationArguments.emplace_back(_enumPropertyMacro.data());
 	_compilationArguments.emplace_back(_enumValuePropertyMacro.data());
 
+	size_t targetArgumentsPosition = _compilationArguments.size();
+
 	for (std::string const& includeDir : _projectIncludeDirs)
 	{
 		_compilationArguments.emplace_back(includeDir.data());
 	}
+
+	//Build the arguments of each target once, its include directories and macros taking precedence over the global ones
+	_argumentSetCompilationArguments.clear();
+
+	if (compilationDatabaseDirectory.empty())
+	{
+		_compilationDatabase.clear();
+	}
+	else
+	{
+		_compilationDatabase.load(compilationDatabaseDirectory, logger);
+	}
+
+	_argumentSetCompilationArguments.reserve(_compilationDatabase.getArgumentSets().size());
+
+	for (std::vector<std::string> const& argumentSet : _compilationDatabase.getArgumentSets())
+	{
+		std::vector<char const*>& arguments = _argumentSetCompilationArguments.emplace_back();
+
+		arguments.reserve(_compilationArguments.size() + argumentSet.size());
+		arguments.insert(arguments.end(), _compilationArguments.cbegin(), _compilationArguments.cbegin() + targetArgumentsPosition);
+
+		for (std::string const& argument : argumentSet)
+		{
+			arguments.emplace_back(argument.data());
+		}
+
+		arguments.insert(arguments.end(), _compilationArguments.cbegin() + targetArgumentsPosition, _compilationArguments.cend());
+	}
 }
 
 bool ParsingSettings::loadSettingsValues(toml::value const& tomlData, ILogger* logger) noexcept
@@ -140,8 +171,11 @@ bool ParsingSettings::loadSettingsValues(toml::value const& tomlData, ILogger* l
 		loadShouldParseAllEntities(tomlParsingSettings, logger);
 		loadShouldAbortParsingOnFirstError(tomlParsingSettings, logger);
 		loadShouldLogDiagnostic(tomlParsingSettings, logger);
+		loadShouldBuildEntityIndex(tomlParsingSettings, logger);
+		loadParsingTimeout(tomlParsingSettings, logger);
 		loadCompilerExeName(tomlParsingSettings, logger);
 		loadProjectIncludeDirectories(tomlParsingSettings, logger);
+		loadCompilationDatabaseDirectory(tomlParsingSettings, logger);
 
 		return propertyParsingSettings.loadSettingsValues(tomlParsingSettings, logger);
 	}
@@ -242,6 +276,22 @@ void ParsingSettings::loadShouldLogDiagnostic(toml::value const& tomlFileParsing
 	}
 }
 
+void ParsingSettings::loadShouldBuildEntityIndex(toml::value const& tomlFileParsingSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(tomlFileParsingSettings, "shouldBuildEntityIndex", shouldBuildEntityIndex, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load shouldBuildEntityIndex: " + Helpers::toString(shouldBuildEntityIndex));
+	}
+}
+
+void ParsingSettings::loadParsingTimeout(toml::value const& tomlFileParsingSettings, ILogger* logger) noexcept
+{
+	if (TomlUtility::updateSetting(tomlFileParsingSettings, "parsingTimeout", parsingTimeout, logger) && logger != nullptr)
+	{
+		logger->log("[TOML] Load parsingTimeout: " + std::to_string(parsingTimeout));
+	}
+}
+
 void ParsingSettings::loadCompilerExeName(toml::value const& parsingSettings, ILogger* logger) noexcept
 {
 	std::string compilerExeName;
@@ -298,6 +348,28 @@ void ParsingSettings::loadProjectIncludeDirectories(toml::value const& parsingSe
 	}
 }
 
+void ParsingSettings::loadCompilationDatabaseDirectory(toml::value const& parsingSettings, ILogger* logger) noexcept
+{
+	std::string loadedDirectory;
+
+	if (TomlUtility::updateSetting(parsingSettings, "compilationDatabaseDirectory", loadedDirectory, logger))
+	{
+		if (loadedDirectory.empty() || fs::is_directory(loadedDirectory))
+		{
+			compilationDatabaseDirectory = loadedDirectory;
+
+			if (logger != nullptr)
+			{
+				logger->log("[TOML] Load compilationDatabaseDirectory: " + loadedDirectory);
+			}
+		}
+		else if (logger != nullptr)
+		{
+			logger->log("[TOML] Discard compilationDatabaseDirectory as it doesn't exist or is not a directory: " + loadedDirectory, ILogger::ELogSeverity::Warning);
+		}
+	}
+}
+
 bool ParsingSettings::addProjectIncludeDirectory(fs::path const& directoryPath) noexcept
 {
 	fs::path sanitizedPath = FilesystemHelpers::sanitizePath(directoryPath);
@@ -335,6 +407,13 @@ std::vector<char const*> const& ParsingSettings::getCompilationArguments() const
 	return _compilationArguments;
 }
 
+std::vector<char const*> const& ParsingSettings::getCompilationArguments(fs::path const& file) const noexcept
+{
+	opt::optional<uint32> argumentSetIndex = _compilationDatabase.findArgumentSet(file);
+
+	return (argumentSetIndex.has_value()) ? _argumentSetCompilationArguments[argumentSetIndex.value()] : _compilationArguments;
+}
+
 bool ParsingSettings::setCompilerExeName(std::string const& compilerExeName) noexcept
 {
 	if (CompilerHelpers::isSupportedCompiler(compilerExeName))
@@ -0,0 +1,719 @@
+#include "Kodgen/Parsing/ParsingWorkerPool.h"
+
+#include <cstdio>	//std::fflush
+#include <cstdlib>	//EXIT_SUCCESS, EXIT_FAILURE
+#include <cerrno>
+#include <iostream>	//std::cout, std::cerr
+#include <chrono>
+#include <algorithm>	//std::min
+#include <cstring>	//std::memcpy, std::memset
+
+#if !_WIN32
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <signal.h>
+#endif
+
+#include "Kodgen/Parsing/FileParsingResultSerializer.h"
+
+using namespace kodgen;
+
+ParsingWorkerPool::~ParsingWorkerPool() noexcept
+{
+	stop();
+}
+
+bool ParsingWorkerPool::isSupported() noexcept
+{
+#if _WIN32
+	return false;
+#else
+	return true;
+#endif
+}
+
+bool ParsingWorkerPool::start(uint32 workerCount, uint32 maxFilesPerWorker, ParseFunction parseFunction) noexcept
+{
+	if (!isSupported() || workerCount == 0u || isRunning())
+	{
+		return false;
+	}
+
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_parseFunction		= std::move(parseFunction);
+	_maxFilesPerWorker	= maxFilesPerWorker;
+
+#if !_WIN32
+	int sockets[2];
+
+	if (!createSocketPair(sockets))
+	{
+		return false;
+	}
+
+	//Flush buffered logs so that they are not written again by the helper and the workers
+	std::cout.flush();
+	std::cerr.flush();
+	std::fflush(nullptr);
+
+	pid_t processId = ::fork();
+
+	if (processId == 0)
+	{
+		::close(sockets[0]);
+
+		runHelper(sockets[1], _parseFunction, _maxFilesPerWorker);
+	}
+
+	::close(sockets[1]);
+
+	if (processId < 0)
+	{
+		::close(sockets[0]);
+
+		return false;
+	}
+
+	//Processes started later by the pool process must not keep the helper alive
+	::fcntl(sockets[0], F_SETFD, FD_CLOEXEC);
+
+	_helperProcessId	= processId;
+	_helperSocket		= sockets[0];
+#endif
+
+	//Reserve all workers now so that references to workers stay valid
+	_workers.resize(workerCount);
+	_idleWorkers.reserve(workerCount);
+
+	for (size_t i = 0u; i < _workers.size(); i++)
+	{
+		if (!spawnWorker(_workers[i]))
+		{
+			break;
+		}
+
+		_idleWorkers.push_back(i);
+	}
+
+	_runningWorkerCount = _idleWorkers.size();
+
+	if (_idleWorkers.size() != _workers.size())
+	{
+		stopProcesses();
+
+		return false;
+	}
+
+	return true;
+}
+
+bool ParsingWorkerPool::parse(fs::path const& file, FileParsingResult& out_result, uint32 timeout, CancellationToken const& cancellationToken) noexcept
+{
+	size_t workerIndex;
+
+	//Acquire an idle worker
+	{
+		std::unique_lock<std::mutex> lock(_mutex);
+
+		_idleWorkerCondition.wait(lock, [this]() { return !_idleWorkers.empty() || _runningWorkerCount == 0u; });
+
+		if (_idleWorkers.empty())
+		{
+			out_result.parsedFile = file;
+			out_result.errors.emplace_back("No parsing worker left to parse file " + file.string() + ".");
+
+			return false;
+		}
+
+		workerIndex = _idleWorkers.back();
+		_idleWorkers.pop_back();
+	}
+
+	Worker&				worker		= _workers[workerIndex];
+	std::string			path		= file.string();
+	uint64				pathSize	= path.size();
+	uint64				resultSize	= 0u;
+	std::vector<uint8>	buffer;
+	EWaitResult			waitResult	= EWaitResult::Failed;
+	bool				received	= sendAll(worker.socket, &pathSize, sizeof(pathSize)) &&
+									  sendAll(worker.socket, path.data(), path.size()) &&
+									  (waitResult = waitForData(worker.socket, timeout, cancellationToken)) == EWaitResult::Ready &&
+									  receiveAll(worker.socket, &resultSize, sizeof(resultSize));
+
+	if (received)
+	{
+		buffer.resize(static_cast<size_t>(resultSize));
+		received = receiveAll(worker.socket, buffer.data(), buffer.size());
+	}
+
+	//The worker is still parsing the file, it must be killed before it can be replaced
+	bool interrupted = waitResult == EWaitResult::TimedOut || waitResult == EWaitResult::Cancelled;
+
+#if !_WIN32
+	if (interrupted)
+	{
+		::kill(worker.processId, SIGKILL);
+	}
+#endif
+
+	bool succeeded		= received && FileParsingResultSerializer::deserialize(buffer.data(), buffer.size(), out_result);
+	bool shouldRespawn	= !received || (_maxFilesPerWorker != 0u && ++worker.parsedFileCount >= _maxFilesPerWorker);
+
+	if (!succeeded)
+	{
+		out_result = FileParsingResult();
+		out_result.parsedFile = file;
+
+		if (waitResult == EWaitResult::TimedOut)
+		{
+			out_result.errors.emplace_back("Parsing of " + path + " timed out after " + std::to_string(timeout) + " ms.");
+		}
+		else if (waitResult == EWaitResult::Cancelled)
+		{
+			out_result.errors.emplace_back("Parsing of " + path + " was cancelled.");
+		}
+		else
+		{
+			out_result.errors.emplace_back("Parsing worker failed to parse file " + path + ".");
+		}
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		//Replace workers which crashed or reached their maximum number of files
+		if (shouldRespawn)
+		{
+			std::string exitDescription = stopWorker(worker);
+
+			if (!received && !interrupted && logger != nullptr)
+			{
+				logger->log("Parsing worker " + exitDescription + " while parsing " + path + ".", ILogger::ELogSeverity::Error);
+			}
+
+			if (spawnWorker(worker))
+			{
+				_idleWorkers.push_back(workerIndex);
+			}
+			else
+			{
+				//Remaining files are handled by the other workers, or reported as failed if there is no worker left
+				_runningWorkerCount--;
+
+				if (logger != nullptr)
+				{
+					logger->log("Failed to spawn a new parsing worker.", ILogger::ELogSeverity::Error);
+				}
+			}
+		}
+		else
+		{
+			_idleWorkers.push_back(workerIndex);
+		}
+	}
+
+	//Waiting threads must also be notified when the last worker is lost
+	_idleWorkerCondition.notify_all();
+
+	return succeeded;
+}
+
+void ParsingWorkerPool::stop() noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	stopProcesses();
+
+	_parseFunction = nullptr;
+}
+
+bool ParsingWorkerPool::isRunning() const noexcept
+{
+	return _helperProcessId > 0;
+}
+
+void ParsingWorkerPool::stopProcesses() noexcept
+{
+	for (Worker& worker : _workers)
+	{
+		stopWorker(worker);
+	}
+
+	_workers.clear();
+	_idleWorkers.clear();
+	_runningWorkerCount = 0u;
+
+#if !_WIN32
+	if (_helperSocket != -1)
+	{
+		//The helper exits when its socket is closed
+		::close(_helperSocket);
+		_helperSocket = -1;
+	}
+
+	if (_helperProcessId > 0)
+	{
+		::waitpid(_helperProcessId, nullptr, 0);
+		_helperProcessId = -1;
+	}
+#endif
+}
+
+bool ParsingWorkerPool::spawnWorker(Worker& out_worker) noexcept
+{
+#if _WIN32
+	(void)out_worker;
+
+	return false;
+#else
+	EHelperCommand	command		= EHelperCommand::SpawnWorker;
+	int32			processId	= -1;
+
+	if (!sendAll(_helperSocket, &command, sizeof(command)) || !receiveAll(_helperSocket, &processId, sizeof(processId)) || processId <= 0)
+	{
+		return false;
+	}
+
+	Worker worker;
+	worker.processId	= processId;
+	worker.socket		= receiveDescriptor(_helperSocket);
+
+	if (worker.socket == -1)
+	{
+		//The worker exits since nobody holds the other end of its socket anymore
+		stopWorker(worker);
+
+		return false;
+	}
+
+	//Processes started later by the pool process must not keep the worker alive
+	::fcntl(worker.socket, F_SETFD, FD_CLOEXEC);
+
+	out_worker = worker;
+
+	return true;
+#endif
+}
+
+std::string ParsingWorkerPool::stopWorker(Worker& worker) noexcept
+{
+	std::string result = "stopped";
+
+#if !_WIN32
+	if (worker.socket != -1)
+	{
+		//The worker exits when its socket is closed
+		::close(worker.socket);
+		worker.socket = -1;
+	}
+
+	if (worker.processId > 0)
+	{
+		//Workers are children of the helper process, so only the helper can wait for them
+		EHelperCommand	command		= EHelperCommand::WaitWorker;
+		int32			processId	= worker.processId;
+		int32			waitResult[2];	//Whether the worker was waited for, and its status
+
+		if (sendAll(_helperSocket, &command, sizeof(command)) && sendAll(_helperSocket, &processId, sizeof(processId)) &&
+			receiveAll(_helperSocket, waitResult, sizeof(waitResult)) && waitResult[0] != 0)
+		{
+			int status = waitResult[1];
+
+			if (WIFSIGNALED(status))
+			{
+				result = "crashed with signal " + std::to_string(WTERMSIG(status));
+			}
+			else if (WIFEXITED(status))
+			{
+				result = "exited with code " + std::to_string(WEXITSTATUS(status));
+			}
+		}
+
+		worker.processId = -1;
+	}
+#endif
+
+	return result;
+}
+
+void ParsingWorkerPool::runHelper(int socket, ParseFunction const& parseFunction, uint32 maxFilesPerWorker) noexcept
+{
+#if _WIN32
+	(void)socket;
+	(void)parseFunction;
+	(void)maxFilesPerWorker;
+
+	std::abort();
+#else
+	EHelperCommand command;
+
+	//Exit when the pool closes the socket
+	while (receiveAll(socket, &command, sizeof(command)))
+	{
+		if (command == EHelperCommand::SpawnWorker)
+		{
+			int		sockets[2]	= { -1, -1 };
+			int32	processId	= -1;
+
+			if (createSocketPair(sockets))
+			{
+				processId = ::fork();
+
+				if (processId == 0)
+				{
+					//Worker process: only keep its own socket so that it exits when the pool closes it
+					::close(socket);
+					::close(sockets[0]);
+
+					runWorker(sockets[1], parseFunction, maxFilesPerWorker);
+				}
+
+				::close(sockets[1]);
+			}
+
+			bool sent = sendAll(socket, &processId, sizeof(processId)) && (processId <= 0 || sendDescriptor(socket, sockets[0]));
+
+			if (sockets[0] != -1)
+			{
+				::close(sockets[0]);
+			}
+
+			if (!sent)
+			{
+				break;
+			}
+		}
+		else if (command == EHelperCommand::WaitWorker)
+		{
+			int32	processId;
+			int		status		= 0;
+			int32	waitResult[2];
+
+			if (!receiveAll(socket, &processId, sizeof(processId)))
+			{
+				break;
+			}
+
+			waitResult[0] = ::waitpid(processId, &status, 0) == processId;
+			waitResult[1] = status;
+
+			if (!sendAll(socket, waitResult, sizeof(waitResult)))
+			{
+				break;
+			}
+		}
+	}
+
+	//Remaining workers exit once the pool closes their socket
+	while (::wait(nullptr) > 0 || errno == EINTR)
+	{
+	}
+
+	::_exit(EXIT_SUCCESS);
+#endif
+}
+
+void ParsingWorkerPool::runWorker(int socket, ParseFunction const& parseFunction, uint32 maxFilesPerWorker) noexcept
+{
+#if _WIN32
+	(void)socket;
+	(void)parseFunction;
+	(void)maxFilesPerWorker;
+
+	std::abort();
+#else
+	std::vector<uint8>	buffer;
+	std::string			path;
+	uint64				pathSize;
+	uint32				parsedFileCount = 0u;
+
+	//Exit when the pool closes the socket
+	while (receiveAll(socket, &pathSize, sizeof(pathSize)))
+	{
+		path.resize(static_cast<size_t>(pathSize));
+
+		if (!receiveAll(socket, path.data(), path.size()))
+		{
+			break;
+		}
+
+		//Destroy the result before sending it to keep the worker memory low
+		{
+			FileParsingResult result;
+
+			parseFunction(path, result);
+
+			//An empty buffer is rejected by the pool, which reports the file as failed
+			FileParsingResultSerializer::serialize(result, buffer);
+		}
+
+		uint64 bufferSize = buffer.size();
+
+		if (!sendAll(socket, &bufferSize, sizeof(bufferSize)) || !sendAll(socket, buffer.data(), buffer.size()))
+		{
+			::_exit(EXIT_FAILURE);
+		}
+
+		if (maxFilesPerWorker != 0u && ++parsedFileCount >= maxFilesPerWorker)
+		{
+			break;
+		}
+	}
+
+	//Don't run the destructors of the objects copied from the pool process
+	std::cout.flush();
+	std::cerr.flush();
+	::_exit(EXIT_SUCCESS);
+#endif
+}
+
+ParsingWorkerPool::EWaitResult ParsingWorkerPool::waitForData(int socket, uint32 timeout, CancellationToken const& cancellationToken) noexcept
+{
+#if _WIN32
+	(void)socket;
+	(void)timeout;
+	(void)cancellationToken;
+
+	return EWaitResult::Failed;
+#else
+	//Poll in short slices so that cancellation is noticed without waiting for the worker
+	constexpr int const pollSlice = 50;
+
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+	pollfd pollDescriptor;
+	pollDescriptor.fd		= socket;
+	pollDescriptor.events	= POLLIN;
+
+	while (true)
+	{
+		if (cancellationToken.isCancellationRequested())
+		{
+			return EWaitResult::Cancelled;
+		}
+
+		int sliceDuration = pollSlice;
+
+		if (timeout != 0u)
+		{
+			std::chrono::milliseconds remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+
+			if (remaining.count() <= 0)
+			{
+				return EWaitResult::TimedOut;
+			}
+
+			sliceDuration = std::min(sliceDuration, static_cast<int>(remaining.count()));
+		}
+
+		pollDescriptor.revents = 0;
+
+		int pollResult = ::poll(&pollDescriptor, 1, sliceDuration);
+
+		if (pollResult > 0)
+		{
+			//Errors and hang-ups are reported by the following read
+			return EWaitResult::Ready;
+		}
+		else if (pollResult < 0 && errno != EINTR)
+		{
+			return EWaitResult::Failed;
+		}
+	}
+#endif
+}
+
+bool ParsingWorkerPool::sendAll(int socket, void const* data, size_t size) noexcept
+{
+#if _WIN32
+	(void)socket;
+	(void)data;
+
+	return size == 0u;
+#else
+	#if defined(MSG_NOSIGNAL)
+	constexpr int const flags = MSG_NOSIGNAL;	//A crashed worker must not kill the pool process with SIGPIPE
+	#else
+	constexpr int const flags = 0;
+	#endif
+
+	uint8 const* bytes = static_cast<uint8 const*>(data);
+
+	while (size > 0u)
+	{
+		ssize_t sentSize = ::send(socket, bytes, size, flags);
+
+		if (sentSize < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (sentSize <= 0)
+		{
+			return false;
+		}
+
+		bytes	+= sentSize;
+		size	-= static_cast<size_t>(sentSize);
+	}
+
+	return true;
+#endif
+}
+
+bool ParsingWorkerPool::receiveAll(int socket, void* out_data, size_t size) noexcept
+{
+#if _WIN32
+	(void)socket;
+	(void)out_data;
+
+	return size == 0u;
+#else
+	uint8* bytes = static_cast<uint8*>(out_data);
+
+	while (size > 0u)
+	{
+		ssize_t receivedSize = ::recv(socket, bytes, size, 0);
+
+		if (receivedSize < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		else if (receivedSize <= 0)
+		{
+			return false;
+		}
+
+		bytes	+= receivedSize;
+		size	-= static_cast<size_t>(receivedSize);
+	}
+
+	return true;
+#endif
+}
+
+bool ParsingWorkerPool::createSocketPair(int* out_sockets) noexcept
+{
+#if _WIN32
+	(void)out_sockets;
+
+	return false;
+#else
+	if (::socketpair(AF_UNIX, SOCK_STREAM, 0, out_sockets) != 0)
+	{
+		return false;
+	}
+
+#if defined(__APPLE__)
+	//MSG_NOSIGNAL doesn't exist on Apple platforms, so disable SIGPIPE on the socket itself
+	int noSigPipe = 1;
+	::setsockopt(out_sockets[0], SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+	::setsockopt(out_sockets[1], SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+
+	return true;
+#endif
+}
+
+bool ParsingWorkerPool::sendDescriptor(int socket, int descriptor) noexcept
+{
+#if _WIN32
+	(void)socket;
+	(void)descriptor;
+
+	return false;
+#else
+	#if defined(MSG_NOSIGNAL)
+	constexpr int const flags = MSG_NOSIGNAL;
+	#else
+	constexpr int const flags = 0;
+	#endif
+
+	//At least one byte of data must be sent along with the descriptor
+	char	data = 0;
+	iovec	dataVector;
+	dataVector.iov_base	= &data;
+	dataVector.iov_len	= sizeof(data);
+
+	union
+	{
+		cmsghdr	header;
+		char	buffer[CMSG_SPACE(sizeof(int))];
+	} control;
+
+	std::memset(&control, 0, sizeof(control));
+
+	msghdr message;
+	std::memset(&message, 0, sizeof(message));
+	message.msg_iov			= &dataVector;
+	message.msg_iovlen		= 1;
+	message.msg_control		= control.buffer;
+	message.msg_controllen	= sizeof(control.buffer);
+
+	cmsghdr* controlMessage = CMSG_FIRSTHDR(&message);
+	controlMessage->cmsg_level	= SOL_SOCKET;
+	controlMessage->cmsg_type	= SCM_RIGHTS;
+	controlMessage->cmsg_len	= CMSG_LEN(sizeof(int));
+	std::memcpy(CMSG_DATA(controlMessage), &descriptor, sizeof(int));
+
+	ssize_t sentSize;
+
+	do
+	{
+		sentSize = ::sendmsg(socket, &message, flags);
+	} while (sentSize < 0 && errno == EINTR);
+
+	return sentSize == sizeof(data);
+#endif
+}
+
+int ParsingWorkerPool::receiveDescriptor(int socket) noexcept
+{
+#if _WIN32
+	(void)socket;
+
+	return -1;
+#else
+	char	data;
+	iovec	dataVector;
+	dataVector.iov_base	= &data;
+	dataVector.iov_len	= sizeof(data);
+
+	union
+	{
+		cmsghdr	header;
+		char	buffer[CMSG_SPACE(sizeof(int))];
+	} control;
+
+	msghdr message;
+	std::memset(&message, 0, sizeof(message));
+	message.msg_iov			= &dataVector;
+	message.msg_iovlen		= 1;
+	message.msg_control		= control.buffer;
+	message.msg_controllen	= sizeof(control.buffer);
+
+	ssize_t receivedSize;
+
+	do
+	{
+		receivedSize = ::recvmsg(socket, &message, 0);
+	} while (receivedSize < 0 && errno == EINTR);
+
+	cmsghdr* controlMessage = (receivedSize == sizeof(data)) ? CMSG_FIRSTHDR(&message) : nullptr;
+
+	if (controlMessage == nullptr || controlMessage->cmsg_level != SOL_SOCKET || controlMessage->cmsg_type != SCM_RIGHTS ||
+		controlMessage->cmsg_len != CMSG_LEN(sizeof(int)))
+	{
+		return -1;
+	}
+
+	int descriptor;
+	std::memcpy(&descriptor, CMSG_DATA(controlMessage), sizeof(int));
+
+	return descriptor;
+#endif
+}
\ No newline at end of file
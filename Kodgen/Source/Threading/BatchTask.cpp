@@ -0,0 +1,82 @@
+#include "Kodgen/Threading/BatchTask.h"
+
+#include <algorithm>	//std::min, std::max
+
+using namespace kodgen;
+
+BatchTaskBase::BatchTaskBase(char const* name, uint64 count, uint64 chunkSize, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken) noexcept:
+	TaskBase(name, std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps), std::move(cancellationToken)),
+	_count{count},
+	_chunkSize{std::max<uint64>(chunkSize, 1u)},
+	_remainingCount{(count == 0u) ? 0u : count + 1u}	//The extra count is released once the cancelled flag is set
+{
+}
+
+bool BatchTaskBase::isReadyToExecute() const noexcept
+{
+	for (std::shared_ptr<TaskBase> const& dependency : dependencies)
+	{
+		if (!dependency->hasFinished())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void BatchTaskBase::execute() noexcept
+{
+	while (true)
+	{
+		uint64 begin = _nextIndex.fetch_add(_chunkSize, std::memory_order_relaxed);
+
+		if (begin >= _count)
+		{
+			return;
+		}
+
+		uint64 end = std::min(begin + _chunkSize, _count);
+
+		if (shouldSkip())
+		{
+			_skippedChunk.store(true, std::memory_order_relaxed);
+		}
+		else
+		{
+			executeRange(begin, end);
+		}
+
+		//The last processed chunk finishes the batch
+		if (_remainingCount.fetch_sub(end - begin, std::memory_order_acq_rel) == end - begin + 1u)
+		{
+			cancelled = _skippedChunk.load(std::memory_order_relaxed);
+
+			//Publish the cancelled flag with the end of the batch
+			_finishedMutex.lock();
+			_remainingCount.store(0u, std::memory_order_release);
+			_finishedMutex.unlock();
+
+			_finishedCondition.notify_all();
+		}
+	}
+}
+
+bool BatchTaskBase::hasFinished() const noexcept
+{
+	return _remainingCount.load(std::memory_order_acquire) == 0u;
+}
+
+void BatchTaskBase::wait() const noexcept
+{
+	std::unique_lock lock(_finishedMutex);
+
+	_finishedCondition.wait(lock, [this]() { return hasFinished(); });
+}
+
+uint64 BatchTaskBase::getParallelism(uint64 workerCount) const noexcept
+{
+	uint64 chunkCount = (_count + _chunkSize - 1u) / _chunkSize;
+
+	return std::max<uint64>(std::min(chunkCount, workerCount), 1u);
+}
\ No newline at end of file
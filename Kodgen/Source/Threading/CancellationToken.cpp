@@ -0,0 +1,33 @@
+#include "Kodgen/Threading/CancellationToken.h"
+
+using namespace kodgen;
+
+CancellationToken::CancellationToken(std::shared_ptr<std::atomic_bool const> isCancelled) noexcept:
+	_isCancelled{std::move(isCancelled)}
+{
+}
+
+bool CancellationToken::isCancellationRequested() const noexcept
+{
+	return _isCancelled != nullptr && _isCancelled->load(std::memory_order_relaxed);
+}
+
+CancellationSource::CancellationSource() noexcept:
+	_isCancelled{std::make_shared<std::atomic_bool>(false)}
+{
+}
+
+void CancellationSource::cancel() noexcept
+{
+	_isCancelled->store(true, std::memory_order_relaxed);
+}
+
+bool CancellationSource::isCancellationRequested() const noexcept
+{
+	return _isCancelled->load(std::memory_order_relaxed);
+}
+
+CancellationToken CancellationSource::getToken() const noexcept
+{
+	return CancellationToken(_isCancelled);
+}
\ No newline at end of file
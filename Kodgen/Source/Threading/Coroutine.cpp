@@ -0,0 +1,99 @@
+#if KODGEN_COROUTINES
+
+#include "Kodgen/Threading/Coroutine.h"
+
+using namespace kodgen;
+
+CoroutineCompletion::CoroutineCompletion() noexcept:
+	TaskBase("Coroutine end")
+{
+}
+
+void CoroutineCompletion::finish() noexcept
+{
+	_finished.store(true, std::memory_order_release);
+	_finished.notify_all();
+}
+
+bool CoroutineCompletion::isReadyToExecute() const noexcept
+{
+	//Never executed, it only finishes when the coroutine completes
+	return false;
+}
+
+void CoroutineCompletion::execute() noexcept
+{
+}
+
+bool CoroutineCompletion::hasFinished() const noexcept
+{
+	return _finished.load(std::memory_order_acquire);
+}
+
+void CoroutineCompletion::wait() const noexcept
+{
+	_finished.wait(false, std::memory_order_acquire);
+}
+
+CoroutineResumption::CoroutineResumption(std::coroutine_handle<> coroutine, std::shared_ptr<TaskBase> awaitedTask) noexcept:
+	TaskBase("Coroutine step"),
+	_coroutine{coroutine},
+	_awaitedTask{std::move(awaitedTask)}
+{
+}
+
+bool CoroutineResumption::isReadyToExecute() const noexcept
+{
+	return _awaitedTask == nullptr || _awaitedTask->hasFinished();
+}
+
+void CoroutineResumption::execute() noexcept
+{
+	//The coroutine can run for long, or even complete and be destroyed, so the resumption finishes first
+	_finished.store(true, std::memory_order_release);
+	_finished.notify_all();
+
+	_coroutine.resume();
+}
+
+bool CoroutineResumption::hasFinished() const noexcept
+{
+	return _finished.load(std::memory_order_acquire);
+}
+
+void CoroutineResumption::wait() const noexcept
+{
+	_finished.wait(false, std::memory_order_acquire);
+}
+
+void CoroutineHelper::ScheduleAwaitable::await_suspend(std::coroutine_handle<> coroutine) const noexcept
+{
+	executor.enqueueTask(std::make_shared<CoroutineResumption>(coroutine, nullptr), priority);
+}
+
+bool CoroutineHelper::TaskAwaitable::await_ready() const noexcept
+{
+	return task->hasFinished();
+}
+
+void CoroutineHelper::TaskAwaitable::await_suspend(std::coroutine_handle<> coroutine) const noexcept
+{
+	executor.enqueueTask(std::make_shared<CoroutineResumption>(coroutine, task), ETaskPriority::Normal);
+}
+
+bool CoroutineHelper::TaskAwaitable::await_resume() const noexcept
+{
+	return !task->wasCancelled();
+}
+
+CoroutineHelper::ScheduleAwaitable CoroutineHelper::schedule(IExecutor& executor, ETaskPriority priority) noexcept
+{
+	return ScheduleAwaitable{ executor, priority };
+}
+
+CoroutineHelper::TaskAwaitable CoroutineHelper::awaitTask(IExecutor& executor, std::shared_ptr<TaskBase> task) noexcept
+{
+	return TaskAwaitable{ executor, std::move(task) };
+}
+
+#endif
\ No newline at end of file
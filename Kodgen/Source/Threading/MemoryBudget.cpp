@@ -0,0 +1,126 @@
+#include "Kodgen/Threading/MemoryBudget.h"
+
+#include <iterator>	//std::next
+#include <algorithm>	//std::min, std::max
+
+#include "Kodgen/Misc/System.h"
+
+using namespace kodgen;
+
+MemoryBudget::Admission::~Admission() noexcept
+{
+	release();
+}
+
+void MemoryBudget::Admission::release() noexcept
+{
+	if (_budget != nullptr)
+	{
+		MemoryBudget* budget = _budget;
+
+		_budget = nullptr;
+
+		budget->release(_amount);
+	}
+}
+
+uint64 MemoryBudget::Admission::getAmount() const noexcept
+{
+	return _amount;
+}
+
+MemoryBudget::MemoryBudget(uint64 capacity) noexcept:
+	_capacity{capacity}
+{
+}
+
+bool MemoryBudget::fits(uint64 amount) const noexcept
+{
+	return _admitted == 0u || _admitted + amount <= _capacity;
+}
+
+void MemoryBudget::admit(std::shared_ptr<Admission> const& admission, uint64 amount, std::function<void()>&& onAdmitted) noexcept
+{
+	std::unique_lock lock(_mutex);
+
+	if (_capacity == 0u)
+	{
+		lock.unlock();
+
+		onAdmitted();
+
+		return;
+	}
+
+	//Admit at least 1 byte so that the work is accounted for
+	amount = std::min(std::max<uint64>(amount, 1u), _capacity);
+
+	if (!fits(amount))
+	{
+		_pendingAdmissions.push_back(PendingAdmission{ admission, amount, std::move(onAdmitted) });
+
+		return;
+	}
+
+	_admitted			+= amount;
+	admission->_budget	= this;
+	admission->_amount	= amount;
+
+	lock.unlock();
+
+	onAdmitted();
+}
+
+void MemoryBudget::release(uint64 amount) noexcept
+{
+	std::list<PendingAdmission> admittedWork;
+
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+
+		_admitted -= amount;
+
+		//Admit the pending work which now fits, in admission order
+		for (auto it = _pendingAdmissions.begin(); it != _pendingAdmissions.end() && _admitted < _capacity;)
+		{
+			auto next = std::next(it);
+
+			if (fits(it->amount))
+			{
+				_admitted				+= it->amount;
+				it->admission->_budget	= this;
+				it->admission->_amount	= it->amount;
+
+				admittedWork.splice(admittedWork.end(), _pendingAdmissions, it);
+			}
+
+			it = next;
+		}
+	}
+
+	//Work is started outside of the lock since it can release memory itself
+	for (PendingAdmission& pendingAdmission : admittedWork)
+	{
+		pendingAdmission.onAdmitted();
+	}
+}
+
+void MemoryBudget::setCapacity(uint64 capacity) noexcept
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+
+	_capacity = capacity;
+}
+
+uint64 MemoryBudget::getCapacity() const noexcept
+{
+	return _capacity;
+}
+
+MemoryBudget& MemoryBudget::getProcessBudget() noexcept
+{
+	//Keep a quarter of the memory left by the cgroup limit for the rest of the process
+	static MemoryBudget processBudget(System::getAvailableMemory() / 4u * 3u);
+
+	return processBudget;
+}
\ No newline at end of file
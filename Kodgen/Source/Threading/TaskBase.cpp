@@ -2,12 +2,42 @@
 
 using namespace kodgen;
 
-TaskBase::TaskBase(char const* name, std::vector<std::shared_ptr<TaskBase>>&& deps) noexcept:
+TaskBase::TaskBase(char const* name, std::vector<std::shared_ptr<TaskBase>>&& deps, CancellationToken cancellationToken) noexcept:
 	_name{name},
+	_cancellationToken{std::move(cancellationToken)},
 	dependencies{std::forward<std::vector<std::shared_ptr<TaskBase>>>(deps)}
 {
 }
 
+bool TaskBase::shouldSkip() const noexcept
+{
+	if (_cancellationToken.isCancellationRequested())
+	{
+		return true;
+	}
+
+	//Tasks depending on a skipped task can't get its result
+	for (std::shared_ptr<TaskBase> const& dependency : dependencies)
+	{
+		if (dependency->cancelled)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool TaskBase::isCancellationRequested() const noexcept
+{
+	return _cancellationToken.isCancellationRequested();
+}
+
+bool TaskBase::wasCancelled() const noexcept
+{
+	return cancelled;
+}
+
 std::string const& TaskBase::getName() const noexcept
 {
 	return _name;
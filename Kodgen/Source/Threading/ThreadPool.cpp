@@ -4,6 +4,9 @@
 
 using namespace kodgen;
 
+/** Pool owning the calling thread, nullptr if the calling thread is not a worker. */
+static thread_local ThreadPool const* currentThreadPool = nullptr;
+
 ThreadPool::ThreadPool(uint32 threadCount, ETerminationMode	terminationMode) noexcept:
 	_destructorCalled{false},
 	_workingWorkers{threadCount},
@@ -41,6 +44,8 @@ ThreadPool::~ThreadPool() noexcept
 
 void ThreadPool::workerRoutine() noexcept
 {
+	currentThreadPool = this;
+
 	std::unique_lock lock(_taskMutex);
 
 	while (shouldKeepRunning())
@@ -58,6 +63,18 @@ void ThreadPool::workerRoutine() noexcept
 				task->execute();
 
 				lock.lock();
+
+				notifyTaskFinished();
+			}
+			else
+			{
+				//No task is ready: sleep until a task finishes, since it may be the dependency of a queued task.
+				//Tasks can also depend on tasks finishing outside of this pool, so workers check queued tasks again after a while
+				_workingWorkers.fetch_sub(1u);
+
+				_taskCondition.wait_for(lock, _readinessCheckPeriod);
+
+				_workingWorkers.fetch_add(1u);
 			}
 		}
 
@@ -74,23 +91,114 @@ void ThreadPool::workerRoutine() noexcept
 	}
 }
 
+void ThreadPool::notifyTaskFinished() noexcept
+{
+	//Workers only wait for a task to finish when queued tasks are not ready
+	if (!_tasks.empty())
+	{
+		_taskCondition.notify_all();
+	}
+}
+
 std::shared_ptr<TaskBase> ThreadPool::getTask() noexcept
 {
+	decltype(_tasks)::iterator	pickedTask	= _tasks.end();
+	uint64						pickedScore	= 0u;
+	uint64						maxPriority	= static_cast<uint64>(ETaskPriority::High);
+
+	while (maxPriority > 0u && _queuedTaskCounts[maxPriority] == 0u)
+	{
+		maxPriority--;
+	}
+
 	//Iterate over all tasks
 	for (decltype(_tasks)::iterator it = _tasks.begin(); it != _tasks.end(); it++)
 	{
-		//Get the first ready task
-		if ((*it)->isReadyToExecute())
+		//Tasks gain a priority level every _agingStep picked tasks they wait for
+		uint64 waitedTaskCount = _pickedTaskCount - it->submissionIndex;
+
+		//Tasks are sorted by submission order, so the remaining tasks can't have a higher score than a task of the highest queued priority with this waiting time
+		if (pickedTask != _tasks.end() && pickedScore >= maxPriority * _agingStep + waitedTaskCount)
+		{
+			break;
+		}
+
+		if (it->task->isReadyToExecute())
+		{
+			uint64 score = static_cast<uint64>(it->priority) * _agingStep + waitedTaskCount;
+
+			//Keep the oldest task for equal scores
+			if (pickedTask == _tasks.end() || score > pickedScore)
+			{
+				pickedTask	= it;
+				pickedScore	= score;
+			}
+		}
+	}
+
+	if (pickedTask == _tasks.end())
+	{
+		return nullptr;
+	}
+
+	std::shared_ptr<TaskBase> result = std::move(pickedTask->task);
+
+	_queuedTaskCounts[static_cast<size_t>(pickedTask->priority)]--;
+	_tasks.erase(pickedTask);
+	_pickedTaskCount++;
+
+	return result;
+}
+
+void ThreadPool::enqueueTask(std::shared_ptr<TaskBase> task, ETaskPriority priority) noexcept
+{
+	_taskMutex.lock();
+	_tasks.push_back(QueuedTask{ std::move(task), priority, _pickedTaskCount });
+	_queuedTaskCounts[static_cast<size_t>(priority)]++;
+	_taskMutex.unlock();
+
+	_taskCondition.notify_one();
+}
+
+void ThreadPool::waitTask(TaskBase const& task) noexcept
+{
+	//Threads which are not workers of this pool can't starve the pool, so they simply block
+	if (currentThreadPool != this)
+	{
+		task.wait();
+
+		return;
+	}
+
+	std::unique_lock lock(_taskMutex);
+
+	while (!task.hasFinished())
+	{
+		std::shared_ptr<TaskBase> readyTask = (_isRunning && !_tasks.empty()) ? getTask() : nullptr;
+
+		lock.unlock();
+
+		if (readyTask != nullptr)
 		{
-			std::shared_ptr<TaskBase> result = std::move(*it);
+			readyTask->execute();
 
-			_tasks.erase(it);
+			lock.lock();
 
-			return result;
+			notifyTaskFinished();
+		}
+		else
+		{
+			//The waited task is being executed by another worker
+			std::this_thread::yield();
+
+			lock.lock();
 		}
 	}
+}
 
-	return nullptr;
+uint32 ThreadPool::getWorkerCount() const noexcept
+{
+	return static_cast<uint32>(_workers.size());
 }
 
 void ThreadPool::joinWorkers() noexcept
@@ -0,0 +1,1115 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <fstream>
+#include <sstream>
+#include <atomic>
+#include <future>
+#include <algorithm>
+#include <set>
+#include <map>
+#include <thread>
+
+#include <Kodgen/Parsing/FileParser.h>
+#include <Kodgen/CodeGen/CodeGenManager.h>
+#include <Kodgen/CodeGen/ArtifactCache.h>
+#include <Kodgen/CodeGen/FileManifest.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnit.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenUnitSettings.h>
+#include <Kodgen/CodeGen/Macro/MacroCodeGenModule.h>
+#include <Kodgen/CodeGen/Macro/MacroPropertyCodeGen.h>
+#include <Kodgen/InfoStructures/FieldInfo.h>
+#include <Kodgen/Misc/DefaultLogger.h>
+#include <Kodgen/Threading/ThreadPool.h>
+#include <Kodgen/Threading/TaskHelper.h>
+
+using namespace kodgen;
+
+#define CHECK(condition)																	\
+	if (!(condition))																		\
+	{																						\
+		std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl;	\
+		return false;																		\
+	}
+
+/** Number of fields the Count property code generator generated code for. */
+std::atomic<uint32>	generatedFieldCount	= 0u;
+
+/** Cache fingerprint of the Count property code generator. */
+std::atomic<uint64>	countFingerprint	= 1u;
+
+/** Property code generator declaring a getter for each field with a Count property, named after the first argument of the outer class Tag property. */
+class CountPropertyCodeGen : public MacroPropertyCodeGen
+{
+	public:
+		CountPropertyCodeGen() noexcept:
+			MacroPropertyCodeGen("Count", EEntityType::Field)
+		{}
+
+		virtual uint64 getCacheFingerprint() const noexcept override
+		{
+			return countFingerprint;
+		}
+
+		virtual bool generateClassFooterCodeForEntity(EntityInfo const& entity, Property const& property, uint8 /* propertyIndex */, MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+		{
+			FieldInfo const&	field	= static_cast<FieldInfo const&>(entity);
+			std::string			prefix	= "get";
+
+			for (Property const& outerProperty : entity.outerEntity->properties)
+			{
+				if (outerProperty.name == "Tag" && !outerProperty.arguments.empty())
+				{
+					prefix = outerProperty.arguments.front();
+				}
+			}
+
+			inout_result += field.type.getCanonicalName() + " " + prefix + "_" + field.name + "() const;";
+
+			for (std::string const& argument : property.arguments)
+			{
+				inout_result += " //" + argument;
+			}
+
+			inout_result += env.getSeparator();
+
+			generatedFieldCount++;
+
+			return true;
+		}
+
+		virtual bool generateSourceFileHeaderCodeForEntity(EntityInfo const& entity, Property const& /* property */, uint8 /* propertyIndex */, MacroCodeGenEnv& env, std::string& inout_result) noexcept override
+		{
+			FieldInfo const& field = static_cast<FieldInfo const&>(entity);
+
+			inout_result += field.type.getCanonicalName() + " " + entity.outerEntity->getFullName() + "::get_" + field.name + "() const { return " + field.name + "; }" + env.getSeparator();
+
+			return true;
+		}
+};
+
+class CountCodeGenModule : public MacroCodeGenModule
+{
+	private:
+		CountPropertyCodeGen _countPropertyCodeGen;
+
+	public:
+		CountCodeGenModule() noexcept
+		{
+			addPropertyCodeGen(_countPropertyCodeGen);
+		}
+
+		CountCodeGenModule(CountCodeGenModule const&):
+			CountCodeGenModule()
+		{
+		}
+
+		virtual uint64 getCacheFingerprint() const noexcept override
+		{
+			return 1u;
+		}
+
+		virtual CountCodeGenModule* clone() const noexcept override
+		{
+			return new CountCodeGenModule(*this);
+		}
+};
+
+/** Project written in a temporary directory and generated with the Count code generation module. */
+class TestProject
+{
+	public:
+		fs::path					directory;
+		DefaultLogger				logger;
+		FileParser					fileParser;
+		MacroCodeGenUnit			codeGenUnit;
+		MacroCodeGenUnitSettings	codeGenUnitSettings;
+		CountCodeGenModule			codeGenModule;
+		CodeGenManager				codeGenManager;
+
+		explicit TestProject(std::string const& name, uint32 threadCount = 0u):
+			directory{fs::temp_directory_path() / "KodgenCodeGenTests" / name},
+			codeGenManager{threadCount}
+		{
+			initialize();
+		}
+
+		TestProject(std::string const& name, IExecutor& executor):
+			directory{fs::temp_directory_path() / "KodgenCodeGenTests" / name},
+			codeGenManager{executor}
+		{
+			initialize();
+		}
+
+		~TestProject()
+		{
+			fs::remove_all(directory);
+		}
+
+		void initialize()
+		{
+			fs::remove_all(directory);
+			fs::create_directories(getIncludeDirectory());
+
+			fileParser.logger		= &logger;
+			codeGenUnit.logger		= &logger;
+			codeGenManager.logger	= &logger;
+
+			ParsingSettings& parsingSettings = fileParser.getSettings();
+
+			parsingSettings.propertyParsingSettings.propertySeparator		= ',';
+			parsingSettings.propertyParsingSettings.argumentEnclosers[0]	= '[';
+			parsingSettings.propertyParsingSettings.argumentEnclosers[1]	= ']';
+			parsingSettings.propertyParsingSettings.argumentSeparator		= ',';
+			parsingSettings.propertyParsingSettings.classMacroName			= "KGClass";
+			parsingSettings.propertyParsingSettings.fieldMacroName			= "KGField";
+
+#if defined(__GNUC__)
+			parsingSettings.setCompilerExeName("g++");
+#elif defined(__clang__)
+			parsingSettings.setCompilerExeName("clang++");
+#elif defined(_MSC_VER)
+			parsingSettings.setCompilerExeName("msvc");
+#endif
+
+			codeGenUnitSettings.setOutputDirectory(getOutputDirectory());
+			codeGenUnitSettings.setGeneratedHeaderFileNamePattern("##FILENAME##.h.h");
+			codeGenUnitSettings.setGeneratedSourceFileNamePattern("##FILENAME##.src.h");
+			codeGenUnitSettings.setClassFooterMacroPattern("##CLASSFULLNAME##_GENERATED");
+			codeGenUnitSettings.setHeaderFileFooterMacroPattern("File_##FILENAME##_GENERATED");
+			codeGenUnit.setSettings(codeGenUnitSettings);
+			codeGenUnit.addModule(codeGenModule);
+
+			codeGenManager.settings.addToProcessDirectory(getIncludeDirectory());
+			codeGenManager.settings.addIgnoredDirectory(getOutputDirectory());
+			codeGenManager.settings.addSupportedFileExtension(".h");
+		}
+
+		fs::path getIncludeDirectory() const
+		{
+			return directory / "Include";
+		}
+
+		fs::path getOutputDirectory() const
+		{
+			return directory / "Include" / "Generated";
+		}
+
+		void writeFile(fs::path const& relativePath, std::string const& content) const
+		{
+			fs::path path = getIncludeDirectory() / relativePath;
+
+			fs::create_directories(path.parent_path());
+			std::ofstream(path, std::ios::out | std::ios::trunc) << content;
+		}
+
+		std::string readGeneratedFile(fs::path const& relativePath) const
+		{
+			std::ifstream		stream(getOutputDirectory() / relativePath);
+			std::stringstream	content;
+
+			content << stream.rdbuf();
+
+			return content.str();
+		}
+
+		std::string readAmalgamationFile(fs::path const& sourceRelativePath) const
+		{
+			//Settings work on sanitized paths
+			return readGeneratedFile(codeGenUnitSettings.getAmalgamationFileName(fs::canonical(getIncludeDirectory()) / sourceRelativePath));
+		}
+
+		CodeGenResult run(bool forceRegenerateAll = false)
+		{
+			//The unit keeps the settings it was given, so they are set again in case they were modified
+			codeGenUnit.setSettings(codeGenUnitSettings);
+
+			return codeGenManager.run(fileParser, codeGenUnit, forceRegenerateAll);
+		}
+
+		CodeGenRunHandle runAsync(CodeGenManager::FileProcessedCallback onFileProcessed)
+		{
+			codeGenUnit.setSettings(codeGenUnitSettings);
+
+			return codeGenManager.runAsync(fileParser, codeGenUnit, false, std::move(onFileProcessed));
+		}
+};
+
+bool testEntityCodeCache()
+{
+	TestProject project("EntityCodeCache");
+
+	project.codeGenManager.settings.setEntityCodeCache(true);
+
+	auto writeHeader = [&project](std::string const& tag, std::string const& valueType, std::string const& countArgument)
+	{
+		project.writeFile("Foo.h", "class KGClass(Tag[" + tag + "]) Foo\n"
+								   "{\n"
+								   "	KGField(Count) " + valueType + " value;\n"
+								   "	KGField(Count" + countArgument + ") float other;\n"
+								   "};\n");
+	};
+
+	//First generation: no snippet is cached, and the second iteration of the macro unit reuses the code of the first one
+	writeHeader("get", "int", "");
+	generatedFieldCount = 0u;
+
+	CHECK(project.run().completed);
+	CHECK(generatedFieldCount == 2u);
+
+	std::string firstCode = project.readGeneratedFile("Foo.h.h");
+
+	CHECK(firstCode.find("int get_value() const;") != std::string::npos);
+	CHECK(firstCode.find("float get_other() const;") != std::string::npos);
+
+	//Unchanged entities: the code is replayed from the cache
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 0u);
+	CHECK(project.readGeneratedFile("Foo.h.h") == firstCode);
+
+	//Modified field: only this field is generated again
+	writeHeader("get", "unsigned int", "");
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 1u);
+	CHECK(project.readGeneratedFile("Foo.h.h").find("unsigned int get_value() const;") != std::string::npos);
+
+	//Modified property of a field
+	writeHeader("get", "unsigned int", "[Argument]");
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 1u);
+	CHECK(project.readGeneratedFile("Foo.h.h").find("float get_other() const; //Argument") != std::string::npos);
+
+	//Modified property of the outer class: all fields are generated again
+	writeHeader("fetch", "unsigned int", "[Argument]");
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 2u);
+	CHECK(project.readGeneratedFile("Foo.h.h").find("unsigned int fetch_value() const;") != std::string::npos);
+
+	//Modified generator fingerprint
+	countFingerprint = 2u;
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 2u);
+
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 0u);
+
+	//Generators can check inheritance across files when the project struct class tree is built, so nothing is reused, even between iterations
+	project.codeGenManager.settings.setProjectStructClassTree(true, false);
+	generatedFieldCount = 0u;
+
+	CHECK(project.run(true).completed);
+	CHECK(generatedFieldCount == 2u * project.codeGenUnit.getIterationCount());
+
+	countFingerprint = 1u;
+
+	return true;
+}
+
+/**
+*	@brief Count the occurences of a string in another string.
+*
+*	@param string		String to search in.
+*	@param substring	String to count.
+*
+*	@return The number of occurences of substring in string.
+*/
+size_t countOccurences(std::string const& string, std::string const& substring)
+{
+	size_t count = 0u;
+
+	for (size_t position = string.find(substring); position != std::string::npos; position = string.find(substring, position + substring.size()))
+	{
+		count++;
+	}
+
+	return count;
+}
+
+bool testAmalgamationFileNames()
+{
+	fs::path directory = fs::temp_directory_path() / "KodgenCodeGenTests" / "AmalgamationFileNames";
+
+	fs::remove_all(directory);
+
+	//Two checkouts of the same project, with directories sharing the same name
+	for (char const* checkout : { "First", "Second" })
+	{
+		for (char const* subdirectory : { "Out", "a/Foo", "a/Nested", "b/Foo", "c" })
+		{
+			fs::create_directories(directory / checkout / subdirectory);
+		}
+	}
+
+	fs::path root = fs::canonical(directory);
+
+	auto makeSettings = [&root](char const* checkout, EAmalgamationMode amalgamationMode)
+	{
+		MacroCodeGenUnitSettings settings;
+
+		settings.setOutputDirectory(root / checkout / "Out");
+		settings.setAmalgamationMode(amalgamationMode);
+		settings.setAmalgamationFileNamePattern("##DIRNAME##.amalgamation.src.h");
+
+		return settings;
+	};
+
+	//Directories with the same name get different files, files of the same directory share a file
+	MacroCodeGenUnitSettings	perDirectory	= makeSettings("First", EAmalgamationMode::PerDirectory);
+	fs::path					aFoo			= perDirectory.getAmalgamationFileName(root / "First" / "a" / "Foo" / "x.h");
+	fs::path					bFoo			= perDirectory.getAmalgamationFileName(root / "First" / "b" / "Foo" / "y.h");
+
+	CHECK(aFoo != bFoo);
+	CHECK(aFoo.string().rfind("Foo_", 0u) == 0u);
+	CHECK(bFoo.string().rfind("Foo_", 0u) == 0u);
+	CHECK(perDirectory.getAmalgamationFileName(root / "First" / "a" / "Foo" / "z.h") == aFoo);
+	CHECK(perDirectory.getAmalgamationFileName(root / "First" / "a" / "Nested" / "x.h") != aFoo);
+
+	//Names only depend on the location relative to the output directory
+	MacroCodeGenUnitSettings otherCheckout = makeSettings("Second", EAmalgamationMode::PerDirectory);
+
+	CHECK(otherCheckout.getAmalgamationFileName(root / "Second" / "a" / "Foo" / "x.h") == aFoo);
+	CHECK(otherCheckout.getAmalgamationFileName(root / "Second" / "b" / "Foo" / "y.h") == bFoo);
+
+	//Files are gathered by their deepest module directory, files in no module directory are gathered per directory
+	MacroCodeGenUnitSettings perModule = makeSettings("First", EAmalgamationMode::PerModule);
+
+	CHECK(perModule.addAmalgamationModuleDirectory(root / "First" / "a"));
+	CHECK(perModule.addAmalgamationModuleDirectory(root / "First" / "a" / "Nested"));
+	CHECK(!perModule.addAmalgamationModuleDirectory(root / "First" / "a"));
+	CHECK(!perModule.addAmalgamationModuleDirectory(root / "First" / "Missing"));
+
+	fs::path moduleA = perModule.getAmalgamationFileName(root / "First" / "a" / "x.h");
+
+	CHECK(moduleA.string().rfind("a_", 0u) == 0u);
+	CHECK(perModule.getAmalgamationFileName(root / "First" / "a" / "Foo" / "x.h") == moduleA);
+	CHECK(perModule.getAmalgamationFileName(root / "First" / "a" / "Nested" / "x.h").string().rfind("Nested_", 0u) == 0u);
+	CHECK(perModule.getAmalgamationFileName(root / "First" / "b" / "Foo" / "y.h") == bFoo);
+
+	//Single file named after the output directory
+	MacroCodeGenUnitSettings single = makeSettings("First", EAmalgamationMode::Single);
+
+	CHECK(single.getAmalgamationFileName(root / "First" / "a" / "Foo" / "x.h") == "Out.amalgamation.src.h");
+	CHECK(single.getAmalgamationFileName(root / "First" / "c" / "x.h") == "Out.amalgamation.src.h");
+
+	CHECK(makeSettings("First", EAmalgamationMode::None).getAmalgamationFileName(root / "First" / "c" / "x.h").empty());
+
+	fs::remove_all(directory);
+
+	return true;
+}
+
+bool testAmalgamationFragments()
+{
+	TestProject project("AmalgamationFragments");
+
+	project.codeGenUnitSettings.setAmalgamationMode(EAmalgamationMode::PerDirectory);
+
+	project.writeFile("A.h", "class KGClass() A { KGField(Count) int a; };\n");
+	project.writeFile("B.h", "class KGClass() B { KGField(Count) int b; };\n");
+
+	CHECK(project.run().completed);
+
+	std::string amalgamation = project.readAmalgamationFile("A.h");
+
+	CHECK(amalgamation == project.readAmalgamationFile("B.h"));
+	CHECK(countOccurences(amalgamation, "//KODGEN_FRAGMENT_BEGIN") == 2u);
+	CHECK(amalgamation.find("int A::get_a() const { return a; }") != std::string::npos);
+	CHECK(amalgamation.find("int B::get_b() const { return b; }") != std::string::npos);
+
+	//A regenerated file replaces its fragment, the fragments of up-to-date files are kept
+	project.writeFile("A.h", "class KGClass() A { KGField(Count) unsigned long long a; };\n");
+
+	CodeGenResult result = project.run();
+
+	CHECK(result.completed);
+	CHECK(std::all_of(result.parsedFiles.cbegin(), result.parsedFiles.cend(), [](fs::path const& file) { return file.filename() == "A.h"; }));
+
+	amalgamation = project.readAmalgamationFile("A.h");
+
+	CHECK(countOccurences(amalgamation, "//KODGEN_FRAGMENT_BEGIN") == 2u);
+	CHECK(amalgamation.find("int A::get_a() const") == std::string::npos);
+	CHECK(amalgamation.find("unsigned long long A::get_a() const { return a; }") != std::string::npos);
+	CHECK(amalgamation.find("int B::get_b() const { return b; }") != std::string::npos);
+
+	//A deleted file loses its fragment even if no other file of its amalgamation is regenerated
+	fs::remove(project.getIncludeDirectory() / "B.h");
+
+	result = project.run();
+
+	CHECK(result.completed);
+	CHECK(result.parsedFiles.empty());
+	CHECK(result.removedFiles.size() == 1u);
+	CHECK(result.removedFiles.front().filename() == "B.h");
+
+	amalgamation = project.readAmalgamationFile("A.h");
+
+	CHECK(countOccurences(amalgamation, "//KODGEN_FRAGMENT_BEGIN") == 1u);
+	CHECK(amalgamation.find("B::get_b") == std::string::npos);
+	CHECK(amalgamation.find("unsigned long long A::get_a() const { return a; }") != std::string::npos);
+
+	//An ignored file loses its fragment as well
+	project.codeGenManager.settings.addIgnoredFile(project.getIncludeDirectory() / "A.h");
+
+	result = project.run();
+
+	CHECK(result.completed);
+	CHECK(result.removedFiles.size() == 1u);
+	CHECK(project.readAmalgamationFile("A.h").find("//KODGEN_FRAGMENT_BEGIN") == std::string::npos);
+
+	return true;
+}
+
+/**
+*	@brief Write a file, creating its directory if needed.
+*
+*	@param path		Path to the file.
+*	@param content	Content of the file.
+*/
+void writeTextFile(fs::path const& path, std::string const& content)
+{
+	fs::create_directories(path.parent_path());
+
+	std::ofstream stream(path, std::ios::out | std::ios::trunc | std::ios::binary);
+
+	stream << content;
+}
+
+/**
+*	@brief Read a whole file.
+*
+*	@param path Path to the file.
+*
+*	@return The content of the file.
+*/
+std::string readTextFile(fs::path const& path)
+{
+	std::ifstream		stream(path, std::ios::in | std::ios::binary);
+	std::stringstream	content;
+
+	content << stream.rdbuf();
+
+	return content.str();
+}
+
+bool testArtifactCacheRelocation()
+{
+	fs::path directory = fs::temp_directory_path() / "KodgenCodeGenTests" / "ArtifactCache";
+
+	fs::remove_all(directory);
+	fs::create_directories(directory);
+
+	directory = fs::canonical(directory);
+
+	//The cache directory is sanitized when loaded, and created if it doesn't exist
+	fs::path settingsFile = directory / "Settings.toml";
+
+	writeTextFile(settingsFile, "[CodeGenManagerSettings]\nartifactCacheDirectory = '" + FilesystemHelpers::normalizeSeparator(directory / "First" / ".." / "Cache").string() + "'\n");
+
+	CodeGenManagerSettings settings;
+
+	CHECK(settings.loadFromFile(settingsFile));
+	CHECK(settings.getArtifactCacheDirectory() == directory / "Cache");
+	CHECK(fs::is_directory(settings.getArtifactCacheDirectory()));
+
+	//Store the generated file of a project
+	auto getArguments = [](fs::path const& root, std::vector<std::string>& out_arguments)
+	{
+		out_arguments = { "-I" + (root / "Include").string(), "-std=c++17" };
+
+		std::vector<char const*> result;
+
+		for (std::string const& argument : out_arguments)
+		{
+			result.push_back(argument.c_str());
+		}
+
+		return result;
+	};
+
+	fs::path					root			= directory / "First";
+	std::vector<std::string>	argumentStrings;
+	fs::path					generatedFile	= root / "Include" / "Generated" / "A.h.h";
+
+	writeTextFile(root / "Include" / "A.h", "#include \"B.h\"\nclass A {};\n");
+	writeTextFile(root / "Include" / "B.h", "class B {};\n");
+	writeTextFile(generatedFile, "#define A_GENERATED\n");
+
+	ArtifactCache storingCache;
+
+	storingCache.setDirectory(settings.getArtifactCacheDirectory());
+	storingCache.setRootDirectory(root);
+
+	opt::optional<uint64> storedKey = storingCache.computeKey(root / "Include" / "A.h", getArguments(root, argumentStrings), { generatedFile }, 1u, root / "Include" / "Generated");
+
+	CHECK(storedKey.has_value());
+	CHECK(storingCache.publish(storedKey.value(), root / "Include" / "A.h", { generatedFile }));
+
+	//Move the project root, the key is unchanged and the generated file is restored at the new location
+	fs::path movedRoot = directory / "Second";
+
+	fs::rename(root, movedRoot);
+	fs::remove(movedRoot / "Include" / "Generated" / "A.h.h");
+
+	root			= movedRoot;
+	generatedFile	= root / "Include" / "Generated" / "A.h.h";
+
+	ArtifactCache restoringCache;
+
+	restoringCache.setDirectory(settings.getArtifactCacheDirectory());
+	restoringCache.setRootDirectory(root);
+
+	opt::optional<uint64> restoredKey = restoringCache.computeKey(root / "Include" / "A.h", getArguments(root, argumentStrings), { generatedFile }, 1u, root / "Include" / "Generated");
+
+	CHECK(restoredKey.has_value());
+	CHECK(restoredKey.value() == storedKey.value());
+	CHECK(restoringCache.restore(restoredKey.value(), root / "Include" / "A.h", { generatedFile }));
+	CHECK(readTextFile(generatedFile) == "#define A_GENERATED\n");
+
+	//An included file change leads to another key, which has no artifact
+	writeTextFile(root / "Include" / "B.h", "class B { int b; };\n");
+
+	restoringCache.clearFileDigests();
+
+	opt::optional<uint64> modifiedKey = restoringCache.computeKey(root / "Include" / "A.h", getArguments(root, argumentStrings), { generatedFile }, 1u, root / "Include" / "Generated");
+
+	CHECK(modifiedKey.has_value());
+	CHECK(modifiedKey.value() != storedKey.value());
+	CHECK(!restoringCache.restore(modifiedKey.value(), root / "Include" / "A.h", { generatedFile }));
+
+	fs::remove_all(directory);
+
+	return true;
+}
+
+bool testFileManifest()
+{
+	fs::path directory = fs::temp_directory_path() / "KodgenCodeGenTests" / "FileManifest";
+
+	fs::remove_all(directory);
+	fs::create_directories(directory);
+
+	fs::path sourceFile		= directory / "A.h";
+	fs::path otherFile		= directory / "B.h";
+	fs::path generatedFile	= directory / "A.h.h";
+	fs::path manifestFile	= directory / "Manifest.txt";
+
+	writeTextFile(sourceFile, "class A {};\n");
+	writeTextFile(otherFile, "class B {};\n");
+	writeTextFile(generatedFile, "#define A_GENERATED\n");
+
+	FileStatus sourceStatus;
+	FileStatus otherStatus;
+
+	CHECK(FileStatus::query(sourceFile, sourceStatus));
+	CHECK(FileStatus::query(otherFile, otherStatus));
+
+	FileManifest manifest;
+
+	manifest.update(sourceFile, sourceStatus, { generatedFile });
+	manifest.setDurations(sourceFile, 10u, 20u);
+	manifest.setTranslationUnitMemory(sourceFile, 30u);
+	manifest.update(otherFile, otherStatus, {});
+
+	CHECK(manifest.save(manifestFile));
+
+	//The manifest is saved through a temporary file which must not be left behind
+	CHECK(std::distance(fs::directory_iterator(directory), fs::directory_iterator()) == 4);
+
+	//Round trip: the source, durations and generated file lines are loaded back
+	std::string manifestContent = readTextFile(manifestFile);
+
+	CHECK(manifestContent.rfind("KODGEN_MANIFEST", 0u) == 0u);
+	CHECK(manifestContent.find("\nS " + std::to_string(sourceStatus.size) + " ") != std::string::npos);
+	CHECK(manifestContent.find("\nC 10 20 30\n") != std::string::npos);
+	CHECK(manifestContent.find("\nG ") != std::string::npos);
+
+	FileManifest	loadedManifest;
+	uint64			parseDuration		= 0u;
+	uint64			generationDuration	= 0u;
+
+	CHECK(loadedManifest.load(manifestFile));
+	CHECK(loadedManifest.isUpToDate(sourceFile, sourceStatus, { generatedFile }));
+	CHECK(loadedManifest.getDurations(sourceFile, parseDuration, generationDuration));
+	CHECK(parseDuration == 10u && generationDuration == 20u);
+	CHECK(loadedManifest.getTranslationUnitMemory(sourceFile) == 30u);
+
+	//A file without generated files is never up-to-date
+	CHECK(!loadedManifest.isUpToDate(otherFile, otherStatus, {}));
+
+	//Change detection on the source status (S line), the expected generated files and the generated files status (G line)
+	writeTextFile(sourceFile, "class A { int a; };\n");
+
+	FileStatus modifiedSourceStatus;
+
+	CHECK(FileStatus::query(sourceFile, modifiedSourceStatus));
+	CHECK(!loadedManifest.isUpToDate(sourceFile, modifiedSourceStatus, { generatedFile }));
+	CHECK(!loadedManifest.isUpToDate(sourceFile, sourceStatus, { generatedFile, directory / "A.h.cpp" }));
+	CHECK(!loadedManifest.isUpToDate(sourceFile, sourceStatus, { directory / "Other.h.h" }));
+
+	writeTextFile(generatedFile, "#define A_GENERATED 1\n");
+
+	CHECK(!loadedManifest.isUpToDate(sourceFile, sourceStatus, { generatedFile }));
+
+	fs::remove(generatedFile);
+
+	CHECK(!loadedManifest.isUpToDate(sourceFile, sourceStatus, { generatedFile }));
+
+	//Manifests without the translation unit memory in the C lines are still valid
+	writeTextFile(manifestFile, "KODGEN_MANIFEST 2\nS 1 2 3 " + sourceFile.string() + "\nC 4 5\n");
+
+	CHECK(loadedManifest.load(manifestFile));
+	CHECK(loadedManifest.getDurations(sourceFile, parseDuration, generationDuration));
+	CHECK(parseDuration == 4u && generationDuration == 5u);
+	CHECK(loadedManifest.getTranslationUnitMemory(sourceFile) == 0u);
+
+	//Corrupted or outdated manifests are discarded
+	writeTextFile(manifestFile, "KODGEN_MANIFEST 2\nS 1 two 3 " + sourceFile.string() + "\n");
+
+	CHECK(!loadedManifest.load(manifestFile));
+	CHECK(!loadedManifest.getDurations(sourceFile, parseDuration, generationDuration));
+
+	writeTextFile(manifestFile, "KODGEN_MANIFEST 1\n");
+
+	CHECK(!loadedManifest.load(manifestFile));
+
+	//Removed files are reported sorted
+	manifest.update(directory / "C.h", otherStatus, {});
+
+	std::vector<fs::path> removedFiles = manifest.prune([&sourceFile](fs::path const& file) { return file == sourceFile; });
+
+	CHECK(removedFiles == std::vector<fs::path>({ otherFile, directory / "C.h" }));
+	CHECK(manifest.prune([](fs::path const&) { return false; }) == std::vector<fs::path>({ sourceFile }));
+
+	fs::remove_all(directory);
+
+	return true;
+}
+
+bool testSanitizeIgnoredPaths()
+{
+	fs::path directory = fs::temp_directory_path() / "KodgenCodeGenTests" / "IgnoredPaths";
+
+	fs::remove_all(directory);
+	fs::create_directories(directory / "Ignored");
+	writeTextFile(directory / "A.h", "class A {};\n");
+
+	directory = fs::canonical(directory);
+
+	CodeGenManagerSettings settings;
+
+	//Paths are sanitized once, not when they are added
+	settings.addIgnoredFile(directory / "Ignored" / ".." / "A.h");
+	settings.addIgnoredDirectory(directory / "." / "Ignored");
+
+	CHECK(settings.getIgnoredFiles().count(directory / "A.h") == 0u);
+
+	settings.sanitizeIgnoredPaths();
+
+	CHECK(settings.getIgnoredFiles().count(directory / "A.h") == 1u);
+	CHECK(settings.getIgnoredDirectories().count(directory / "Ignored") == 1u);
+	CHECK(settings.isIgnoredFile(directory / "A.h"));
+	CHECK(settings.isIgnoredDirectory(directory / "Ignored"));
+	CHECK(!settings.isIgnoredFile(directory / "B.h"));
+
+	fs::remove_all(directory);
+
+	return true;
+}
+
+bool testRemovedFiles()
+{
+	TestProject project("RemovedFiles");
+
+	project.writeFile("A.h", "class KGClass() A { KGField(Count) int a; };\n");
+	project.writeFile("B.h", "class KGClass() B { KGField(Count) int b; };\n");
+
+	CodeGenResult result = project.run();
+
+	CHECK(result.completed);
+	CHECK(result.removedFiles.empty());
+
+	//Deleted files are reported once
+	fs::remove(project.getIncludeDirectory() / "B.h");
+
+	result = project.run();
+
+	CHECK(result.completed);
+	CHECK(result.parsedFiles.empty());
+	CHECK(result.removedFiles.size() == 1u);
+	CHECK(result.removedFiles.front() == fs::canonical(project.getIncludeDirectory()) / "B.h");
+
+	result = project.run();
+
+	CHECK(result.completed);
+	CHECK(result.removedFiles.empty());
+
+	//Ignored files are reported as removed
+	project.codeGenManager.settings.addIgnoredFile(project.getIncludeDirectory() / "A.h");
+
+	result = project.run();
+
+	CHECK(result.completed);
+	CHECK(result.removedFiles.size() == 1u);
+	CHECK(result.removedFiles.front().filename() == "A.h");
+
+	return true;
+}
+
+/**
+*	@brief Generate each shard of a project and get the shard which parsed each file.
+*
+*	@param project		Project to generate.
+*	@param shardCount	Number of shards.
+*	@param out_shards	Shard index of each parsed file name.
+*
+*	@return true if each file was parsed by a single shard, else false.
+*/
+bool generateShards(TestProject& project, uint32 shardCount, std::map<std::string, uint32>& out_shards)
+{
+	out_shards.clear();
+
+	for (uint32 shardIndex = 0u; shardIndex < shardCount; shardIndex++)
+	{
+		CHECK(project.codeGenManager.settings.setShard(shardIndex, shardCount));
+
+		CodeGenResult result = project.run(true);
+
+		CHECK(result.completed);
+
+		//Files are parsed once per code generation iteration
+		std::set<std::string> shardFiles;
+
+		for (fs::path const& file : result.parsedFiles)
+		{
+			shardFiles.insert(file.filename().string());
+		}
+
+		for (std::string const& file : shardFiles)
+		{
+			CHECK(out_shards.emplace(file, shardIndex).second);
+		}
+	}
+
+	return true;
+}
+
+bool testShardPartition()
+{
+	constexpr uint32 const fileCount	= 16u;
+	constexpr uint32 const shardCount	= 3u;
+
+	TestProject project("ShardPartition");
+	TestProject reorderedProject("ShardPartitionReordered");
+
+	for (uint32 i = 0u; i < fileCount; i++)
+	{
+		std::string index = std::to_string(i);
+
+		project.writeFile("File" + index + ".h", "class KGClass() C" + index + " { KGField(Count) int a; };\n");
+		reorderedProject.writeFile("File" + index + ".h", "class KGClass() C" + index + " { KGField(Count) int a; };\n");
+	}
+
+	//Every file is processed by exactly one shard
+	std::map<std::string, uint32> shards;
+
+	CHECK(generateShards(project, shardCount, shards));
+	CHECK(shards.size() == fileCount);
+
+	//Files are spread between all shards
+	for (uint32 shardIndex = 0u; shardIndex < shardCount; shardIndex++)
+	{
+		CHECK(std::any_of(shards.cbegin(), shards.cend(), [shardIndex](auto const& fileShard) { return fileShard.second == shardIndex; }));
+	}
+
+	//The assignment is stable across runs
+	std::map<std::string, uint32> rerunShards;
+
+	CHECK(generateShards(project, shardCount, rerunShards));
+	CHECK(rerunShards == shards);
+
+	//The assignment only depends on the file path relative to the output directory,
+	//not on the project location nor on the order of the files to process
+	reorderedProject.codeGenManager.settings.clearToProcessDirectories();
+
+	for (uint32 i = fileCount; i > 0u; i--)
+	{
+		CHECK(reorderedProject.codeGenManager.settings.addToProcessFile(reorderedProject.getIncludeDirectory() / ("File" + std::to_string(i - 1u) + ".h")));
+	}
+
+	std::map<std::string, uint32> reorderedShards;
+
+	CHECK(generateShards(reorderedProject, shardCount, reorderedShards));
+	CHECK(reorderedShards == shards);
+
+	return true;
+}
+
+bool testMergeShardResults()
+{
+	std::vector<CodeGenResult> shardResults(3u);
+
+	shardResults[0].completed					= true;
+	shardResults[0].duration					= 2.0f;
+	shardResults[0].parsedFiles					= { "A.h", "B.h" };
+	shardResults[0].upToDateFiles				= { "D.h", "E.h" };
+	shardResults[0].removedFiles				= { "F.h" };
+	shardResults[0].peakTranslationUnitsMemory	= 100u;
+	shardResults[0].peakResidentSetSize			= 1000u;
+	shardResults[0].filesMemoryUsage.push_back(FileMemoryUsage{ "A.h", 10u, 1u });
+
+	shardResults[1].completed					= true;
+	shardResults[1].duration					= 5.0f;
+	shardResults[1].parsedFiles					= { "C.h" };
+	shardResults[1].upToDateFiles				= { "E.h", "D.h" };
+	shardResults[1].removedFiles				= { "F.h" };
+	shardResults[1].restoredFiles				= { "G.h" };
+	shardResults[1].peakTranslationUnitsMemory	= 300u;
+	shardResults[1].peakResidentSetSize			= 500u;
+	shardResults[1].filesMemoryUsage.push_back(FileMemoryUsage{ "C.h", 30u, 3u });
+
+	shardResults[2].completed					= true;
+	shardResults[2].duration					= 1.0f;
+	shardResults[2].skippedFiles				= { "H.h" };
+	shardResults[2].upToDateFiles				= { "D.h", "E.h" };
+	shardResults[2].removedFiles				= { "F.h" };
+
+	//Results go through their file format, as they do between shard processes
+	fs::path resultFile = fs::temp_directory_path() / "KodgenCodeGenTests" / "ShardResult.txt";
+
+	fs::create_directories(resultFile.parent_path());
+
+	CHECK(shardResults[1].save(resultFile));
+
+	shardResults[1] = CodeGenResult();
+
+	CHECK(shardResults[1].load(resultFile));
+
+	fs::remove(resultFile);
+
+	std::vector<CodeGenResult> failedShardResults{ shardResults[0], shardResults[2] };
+
+	CodeGenResult result = CodeGenResult::mergeShardResults(std::move(shardResults));
+
+	//Files processed by each shard are summed, files identified by all shards are kept once
+	CHECK(result.completed);
+	CHECK(result.duration == 5.0f);
+	CHECK(result.parsedFiles == std::vector<fs::path>({ "A.h", "B.h", "C.h" }));
+	CHECK(result.restoredFiles == std::vector<fs::path>({ "G.h" }));
+	CHECK(result.skippedFiles == std::vector<fs::path>({ "H.h" }));
+	CHECK(result.upToDateFiles == std::vector<fs::path>({ "D.h", "E.h" }));
+	CHECK(result.removedFiles == std::vector<fs::path>({ "F.h" }));
+	CHECK(result.filesMemoryUsage.size() == 2u);
+	CHECK(result.peakTranslationUnitsMemory == 300u);
+	CHECK(result.peakResidentSetSize == 1000u);
+
+	//The merged result is completed only if all shards completed
+	failedShardResults[1].completed = false;
+
+	CHECK(!CodeGenResult::mergeShardResults(std::move(failedShardResults)).completed);
+	CHECK(!CodeGenResult::mergeShardResults({}).completed);
+
+	return true;
+}
+
+bool testRunAsync()
+{
+	constexpr uint32 const fileCount = 6u;
+
+	//A single worker makes the progress of the run predictable
+	TestProject project("RunAsync", 1u);
+
+	for (uint32 i = 0u; i < fileCount; i++)
+	{
+		std::string index = std::to_string(i);
+
+		project.writeFile("File" + index + ".h", "class KGClass() C" + index + " { KGField(Count) int a; };\n");
+	}
+
+	//A joined run reports its files as soon as they are generated
+	std::atomic<uint32> generatedCount = 0u;
+
+	CodeGenRunHandle handle = project.runAsync([&generatedCount](fs::path const&, EFileProcessingStep step, bool succeeded)
+	{
+		if (step == EFileProcessingStep::Generated && succeeded)
+		{
+			generatedCount++;
+		}
+	});
+
+	CHECK(handle.isValid());
+
+	CodeGenResult result = handle.join();
+
+	CHECK(!handle.isValid());
+	CHECK(result.completed);
+	CHECK(generatedCount == fileCount);
+
+	//A cancelled run skips the files which were not generated yet
+	for (uint32 i = 0u; i < fileCount; i++)
+	{
+		project.writeFile("File" + std::to_string(i) + ".h", "class KGClass() C" + std::to_string(i) + " { KGField(Count) long long a; };\n");
+	}
+
+	std::promise<void>	parsed;
+	std::promise<void>	cancelled;
+	std::future<void>	cancelledFuture	= cancelled.get_future();
+	std::atomic<bool>	blocked			= false;
+	std::atomic<uint32>	skippedCount	= 0u;
+
+	handle = project.runAsync([&parsed, &cancelledFuture, &blocked, &skippedCount](fs::path const&, EFileProcessingStep step, bool)
+	{
+		//Hold the only worker on the first parsed file until the run is cancelled
+		if (step == EFileProcessingStep::Parsed && !blocked.exchange(true))
+		{
+			parsed.set_value();
+			cancelledFuture.wait();
+		}
+		else if (step == EFileProcessingStep::Skipped)
+		{
+			skippedCount++;
+		}
+	});
+
+	parsed.get_future().wait();
+
+	CHECK(!handle.isFinished());
+
+	handle.cancel();
+	cancelled.set_value();
+
+	result = handle.join();
+
+	CHECK(!result.completed);
+	CHECK(!result.skippedFiles.empty());
+	CHECK(skippedCount == result.skippedFiles.size());
+
+	//Skipped files are processed by the next run, which is not affected by the previous cancellation
+	std::vector<fs::path> skippedFiles = result.skippedFiles;
+
+	result = project.run();
+
+	CHECK(result.completed);
+
+	for (fs::path const& skippedFile : skippedFiles)
+	{
+		CHECK(std::find(result.parsedFiles.cbegin(), result.parsedFiles.cend(), skippedFile) != result.parsedFiles.cend());
+	}
+
+	return true;
+}
+
+/** Executor forwarding its tasks to a ThreadPool and counting them. */
+class CountingExecutor : public IExecutor
+{
+	public:
+		ThreadPool&			threadPool;
+		std::atomic<uint32>	enqueuedTaskCount	= 0u;
+
+		explicit CountingExecutor(ThreadPool& pool):
+			threadPool{pool}
+		{
+		}
+
+		virtual void enqueueTask(std::shared_ptr<TaskBase> task, ETaskPriority priority) noexcept override
+		{
+			enqueuedTaskCount++;
+
+			threadPool.enqueueTask(std::move(task), priority);
+		}
+
+		virtual void waitTask(TaskBase const& task) noexcept override
+		{
+			threadPool.waitTask(task);
+		}
+
+		virtual uint32 getWorkerCount() const noexcept override
+		{
+			return threadPool.getWorkerCount();
+		}
+};
+
+bool testSharedExecutor()
+{
+	constexpr uint32 fileCount = 4u;
+
+	//A single worker makes sure that a run started from one of its tasks can't block it
+	ThreadPool			pool(1u);
+	CountingExecutor	executor(pool);
+	TestProject			firstProject("SharedExecutorFirst", executor);
+	TestProject			secondProject("SharedExecutorSecond", pool);
+
+	for (uint32 i = 0u; i < fileCount; i++)
+	{
+		firstProject.writeFile("File" + std::to_string(i) + ".h", "class KGClass() A" + std::to_string(i) + " { KGField(Count) int a; };\n");
+		secondProject.writeFile("File" + std::to_string(i) + ".h", "class KGClass() B" + std::to_string(i) + " { KGField(Count) int b; };\n");
+	}
+
+	//Both managers run at the same time on the same pool
+	CodeGenResult	firstResult;
+	std::thread		firstThread([&firstProject, &firstResult]() { firstResult = firstProject.run(); });
+	CodeGenResult	secondResult = secondProject.run();
+
+	firstThread.join();
+
+	CHECK(firstResult.completed);
+	CHECK(secondResult.completed);
+	CHECK(firstResult.parsedFiles.size() == secondResult.parsedFiles.size());
+	CHECK(!firstResult.parsedFiles.empty());
+	CHECK(executor.enqueuedTaskCount != 0u);
+
+	for (uint32 i = 0u; i < fileCount; i++)
+	{
+		CHECK(firstProject.readGeneratedFile("File" + std::to_string(i) + ".h.h").find("A" + std::to_string(i)) != std::string::npos);
+		CHECK(secondProject.readGeneratedFile("File" + std::to_string(i) + ".h.h").find("B" + std::to_string(i)) != std::string::npos);
+	}
+
+	//A run started from a task of the shared pool executes its tasks while waiting for them
+	std::shared_ptr<TaskBase> task = pool.submitTask("Run", [&secondProject](TaskBase*) { return secondProject.run(true); });
+
+	pool.waitTask(*task);
+
+	secondResult = TaskHelper::getResult<CodeGenResult>(task.get());
+
+	CHECK(secondResult.completed);
+	CHECK(secondResult.parsedFiles.size() == firstResult.parsedFiles.size());
+
+	//The managers don't stop the pool they share
+	std::shared_ptr<TaskBase> otherTask = pool.submitTask("Other", [](TaskBase*) { return 42; });
+
+	pool.waitTask(*otherTask);
+
+	CHECK(TaskHelper::getResult<int>(otherTask.get()) == 42);
+
+	return true;
+}
+
+int main()
+{
+	bool success = true;
+
+	success &= testEntityCodeCache();
+	success &= testAmalgamationFileNames();
+	success &= testAmalgamationFragments();
+	success &= testArtifactCacheRelocation();
+	success &= testFileManifest();
+	success &= testSanitizeIgnoredPaths();
+	success &= testRemovedFiles();
+	success &= testShardPartition();
+	success &= testMergeShardResults();
+	success &= testRunAsync();
+	success &= testSharedExecutor();
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -0,0 +1,343 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <unordered_set>
+#include <queue>
+#include <random>
+#include <thread>
+#include <atomic>
+
+#include <Kodgen/InfoStructures/StructClassTree.h>
+#include <Kodgen/InfoStructures/FrozenStructClassTree.h>
+#include <Kodgen/InfoStructures/ProjectStructClassTree.h>
+
+using namespace kodgen;
+
+#define CHECK(condition)																	\
+	if (!(condition))																		\
+	{																						\
+		std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl;	\
+		return false;																		\
+	}
+
+/**
+*	@brief Check whether a struct/class is reachable from another one through inheritance links, with a traversal which terminates on cycles.
+*
+*	@param tree					Tree containing the links.
+*	@param baseStructClassName	Name of the struct/class to reach.
+*	@param childStructClassName	Name of the struct/class to start from.
+*
+*	@return true if baseStructClassName is reachable from childStructClassName, else false.
+*/
+bool isReachable(StructClassTree const& tree, std::string const& baseStructClassName, std::string const& childStructClassName)
+{
+	std::unordered_set<std::string>	visited{ childStructClassName };
+	std::queue<std::string>			toCheck;
+
+	toCheck.push(childStructClassName);
+
+	while (!toCheck.empty())
+	{
+		auto it = tree.getEntries().find(toCheck.front());
+		toCheck.pop();
+
+		if (it == tree.getEntries().cend())
+		{
+			continue;
+		}
+
+		for (StructClassTree::InheritanceLink const& inheritanceLink : it->second)
+		{
+			if (inheritanceLink.inheritedStructClassName == baseStructClassName)
+			{
+				return true;
+			}
+
+			if (visited.insert(inheritanceLink.inheritedStructClassName).second)
+			{
+				toCheck.push(inheritanceLink.inheritedStructClassName);
+			}
+		}
+	}
+
+	return false;
+}
+
+/**
+*	@brief	Compare the answers of a FrozenStructClassTree to the answers of the StructClassTree it is built from, for all pairs of structs/classes.
+*			StructClassTree::isBaseOf never returns when the base is not reachable from a cycle, so the frozen tree must return false in that case.
+*
+*	@param tree			Tree to freeze.
+*	@param hasCycles	Can the tree contain cycles.
+*
+*	@return true if both trees give the same answers, else false.
+*/
+bool compareTrees(StructClassTree const& tree, bool hasCycles)
+{
+	FrozenStructClassTree		frozenTree(tree);
+	std::vector<std::string>	names{ "Unknown" };
+
+	for (auto const& [structClassName, inheritanceLinks] : tree.getEntries())
+	{
+		names.push_back(structClassName);
+	}
+
+	CHECK(frozenTree.getNodeCount() == tree.getEntries().size());
+
+	for (std::string const& baseName : names)
+	{
+		for (std::string const& childName : names)
+		{
+			EAccessSpecifier	expectedAccess	= EAccessSpecifier::Invalid;
+			EAccessSpecifier	frozenAccess	= EAccessSpecifier::Invalid;
+			bool				frozenResult	= frozenTree.isBaseOf(baseName, childName, &frozenAccess);
+
+			if (hasCycles && baseName != childName && !isReachable(tree, baseName, childName))
+			{
+				if (frozenResult)
+				{
+					std::cerr << baseName << " is not a base of " << childName << std::endl;
+				}
+
+				CHECK(!frozenResult);
+
+				continue;
+			}
+
+			bool expectedResult = tree.isBaseOf(baseName, childName, &expectedAccess);
+
+			if (frozenResult != expectedResult || (expectedResult && frozenAccess != expectedAccess))
+			{
+				std::cerr << "isBaseOf(" << baseName << ", " << childName << "): expected " << expectedResult << " with access " << static_cast<int>(expectedAccess) <<
+							 ", got " << frozenResult << " with access " << static_cast<int>(frozenAccess) << std::endl;
+			}
+
+			CHECK(frozenResult == expectedResult);
+			CHECK(!expectedResult || frozenAccess == expectedAccess);
+		}
+	}
+
+	return true;
+}
+
+bool testSingleChains()
+{
+	StructClassTree tree;
+
+	//A -> B -> C -> D and a second chain sharing the root, with a different access on each link
+	tree.addInheritanceLink("B", "A", EAccessSpecifier::Public);
+	tree.addInheritanceLink("C", "B", EAccessSpecifier::Protected);
+	tree.addInheritanceLink("D", "C", EAccessSpecifier::Private);
+	tree.addInheritanceLink("E", "A", EAccessSpecifier::Private);
+	tree.addInheritanceLink("F", "E", EAccessSpecifier::Public);
+
+	//Unrelated chain
+	tree.addInheritanceLink("ns::Y", "ns::X", EAccessSpecifier::Protected);
+
+	CHECK(compareTrees(tree, false));
+
+	//The access of the link inheriting directly from the base is reported
+	FrozenStructClassTree	frozenTree(tree);
+	EAccessSpecifier		access = EAccessSpecifier::Invalid;
+
+	CHECK(frozenTree.isBaseOf("A", "D", &access));
+	CHECK(access == EAccessSpecifier::Public);
+	CHECK(frozenTree.isBaseOf("B", "D", &access));
+	CHECK(access == EAccessSpecifier::Protected);
+	CHECK(frozenTree.isBaseOf("D", "D", &access));
+	CHECK(access == EAccessSpecifier::Invalid);
+	CHECK(!frozenTree.isBaseOf("E", "D"));
+	CHECK(!frozenTree.isBaseOf("D", "A"));
+
+	return true;
+}
+
+bool testMultipleInheritance()
+{
+	StructClassTree tree;
+
+	//Diamond with a different access on each path
+	tree.addInheritanceLink("Left", "Root", EAccessSpecifier::Protected);
+	tree.addInheritanceLink("Right", "Root", EAccessSpecifier::Public);
+	tree.addInheritanceLink("Diamond", "Left", EAccessSpecifier::Public);
+	tree.addInheritanceLink("Diamond", "Right", EAccessSpecifier::Private);
+
+	//Single chains above and below a node with multiple bases
+	tree.addInheritanceLink("Root", "Top", EAccessSpecifier::Private);
+	tree.addInheritanceLink("Bottom", "Diamond", EAccessSpecifier::Protected);
+	tree.addInheritanceLink("Deeper", "Bottom", EAccessSpecifier::Public);
+
+	//Multiple unrelated bases, one of them also inherited through a chain
+	tree.addInheritanceLink("Mixin", "Right", EAccessSpecifier::Public);
+	tree.addInheritanceLink("Multiple", "Mixin", EAccessSpecifier::Private);
+	tree.addInheritanceLink("Multiple", "Other", EAccessSpecifier::Protected);
+	tree.addInheritanceLink("Multiple", "Right", EAccessSpecifier::Public);
+
+	CHECK(compareTrees(tree, false));
+
+	//Bases are found in the same order as StructClassTree: the first path reaching the base gives the access
+	FrozenStructClassTree	frozenTree(tree);
+	EAccessSpecifier		access = EAccessSpecifier::Invalid;
+
+	CHECK(frozenTree.isBaseOf("Root", "Diamond", &access));
+	CHECK(access == EAccessSpecifier::Protected);
+	CHECK(frozenTree.isBaseOf("Top", "Deeper", &access));
+	CHECK(access == EAccessSpecifier::Private);
+
+	return true;
+}
+
+bool testRandomGraphs()
+{
+	std::mt19937 generator(42u);
+
+	//Enough structs/classes for the closure rows to span several 64-bit words
+	for (int graph = 0; graph < 20; graph++)
+	{
+		StructClassTree						tree;
+		uint32								nodeCount = 150u;
+		std::uniform_int_distribution<int>	parentCountDistribution(0, (graph % 2 == 0) ? 1 : 3);
+		std::uniform_int_distribution<int>	accessDistribution(1, 3);
+
+		for (uint32 node = 1u; node < nodeCount; node++)
+		{
+			int parentCount = parentCountDistribution(generator);
+
+			//Only inherit from lower nodes so that the graph has no cycle
+			for (int i = 0; i < parentCount; i++)
+			{
+				uint32 parent = std::uniform_int_distribution<uint32>(0u, node - 1u)(generator);
+
+				tree.addInheritanceLink("N" + std::to_string(node), "N" + std::to_string(parent), static_cast<EAccessSpecifier>(accessDistribution(generator)));
+			}
+		}
+
+		CHECK(compareTrees(tree, false));
+	}
+
+	return true;
+}
+
+bool testCycle()
+{
+	StructClassTree tree;
+
+	//Invalid code, but the frozen tree must still answer without looping
+	tree.addInheritanceLink("CycleA", "CycleB", EAccessSpecifier::Public);
+	tree.addInheritanceLink("CycleB", "CycleC", EAccessSpecifier::Protected);
+	tree.addInheritanceLink("CycleC", "CycleA", EAccessSpecifier::Private);
+
+	//Single chain leading into the cycle, and a chain outside of it
+	tree.addInheritanceLink("Entry", "CycleA", EAccessSpecifier::Protected);
+	tree.addInheritanceLink("CycleC", "Outside", EAccessSpecifier::Public);
+	tree.addInheritanceLink("Unrelated", "Outside", EAccessSpecifier::Private);
+
+	CHECK(compareTrees(tree, true));
+
+	FrozenStructClassTree	frozenTree(tree);
+	EAccessSpecifier		access = EAccessSpecifier::Invalid;
+
+	CHECK(frozenTree.isBaseOf("Outside", "Entry", &access));
+	CHECK(access == EAccessSpecifier::Public);
+	CHECK(!frozenTree.isBaseOf("Entry", "CycleA"));
+	CHECK(!frozenTree.isBaseOf("Unrelated", "CycleB"));
+
+	return true;
+}
+
+bool testConcurrentProjectTree()
+{
+	constexpr uint32 const fileCount	= 8u;
+	constexpr uint32 const chainLength	= 200u;
+
+	ProjectStructClassTree		projectTree;
+	std::vector<std::thread>	threads;
+	std::atomic<bool>			readerFailed	= false;
+	std::atomic<uint32>			finishedWriters	= 0u;
+
+	auto getName = [](uint32 file, uint32 index)
+	{
+		return "F" + std::to_string(file) + "_C" + std::to_string(index);
+	};
+
+	//Each file has a chain of structs/classes inheriting from a common root, inserted concurrently by one thread per file
+	for (uint32 file = 0u; file < fileCount; file++)
+	{
+		threads.emplace_back([&projectTree, &finishedWriters, &getName, file]()
+		{
+			for (uint32 index = 0u; index < chainLength; index++)
+			{
+				StructClassTree fileTree;
+
+				fileTree.addInheritanceLink(getName(file, index), (index == 0u) ? "Root" : getName(file, index - 1u), EAccessSpecifier::Public);
+
+				projectTree.addInheritanceLinks("File" + std::to_string(file) + ".h", fileTree);
+			}
+
+			finishedWriters++;
+		});
+	}
+
+	//Queries run concurrently with insertions must never see links between different chains
+	threads.emplace_back([&projectTree, &readerFailed, &finishedWriters, &getName]()
+	{
+		while (finishedWriters.load() != fileCount)
+		{
+			if (projectTree.isBaseOf(getName(1u, 0u), getName(0u, chainLength - 1u)))
+			{
+				readerFailed = true;
+			}
+		}
+	});
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	CHECK(!readerFailed);
+	CHECK(projectTree.getEntryCount() == fileCount * chainLength);
+
+	//The frozen tree contains all the links added concurrently
+	projectTree.freeze();
+
+	FrozenStructClassTree const&	frozenTree	= projectTree.getFrozenTree();
+	EAccessSpecifier				access		= EAccessSpecifier::Invalid;
+
+	for (uint32 file = 0u; file < fileCount; file++)
+	{
+		CHECK(frozenTree.isBaseOf("Root", getName(file, chainLength - 1u), &access));
+		CHECK(access == EAccessSpecifier::Public);
+		CHECK(frozenTree.isBaseOf(getName(file, 0u), getName(file, chainLength - 1u)));
+		CHECK(!frozenTree.isBaseOf(getName(file, chainLength - 1u), getName(file, 0u)));
+		CHECK(!frozenTree.isBaseOf(getName((file + 1u) % fileCount, 0u), getName(file, chainLength - 1u)));
+		CHECK(projectTree.isBaseOf("Root", getName(file, chainLength - 1u)));
+	}
+
+	//Entries of a file can be discarded, the frozen tree is only updated by the next freeze
+	projectTree.prune([](fs::path const& file) { return file != "File0.h"; });
+
+	CHECK(projectTree.getEntryCount() == (fileCount - 1u) * chainLength);
+	CHECK(!projectTree.isBaseOf("Root", getName(0u, chainLength - 1u)));
+	CHECK(frozenTree.isBaseOf("Root", getName(0u, chainLength - 1u)));
+
+	projectTree.freeze();
+
+	CHECK(!projectTree.getFrozenTree().isBaseOf("Root", getName(0u, chainLength - 1u)));
+	CHECK(projectTree.getFrozenTree().isBaseOf("Root", getName(1u, chainLength - 1u)));
+
+	return true;
+}
+
+int main()
+{
+	bool success = true;
+
+	success &= testSingleChains();
+	success &= testMultipleInheritance();
+	success &= testRandomGraphs();
+	success &= testCycle();
+	success &= testConcurrentProjectTree();
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
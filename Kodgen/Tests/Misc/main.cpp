@@ -0,0 +1,517 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <fstream>
+#include <sstream>
+#include <typeinfo>
+
+#include <Kodgen/Misc/AsyncLogger.h>
+#include <Kodgen/Misc/System.h>
+#include <Kodgen/Misc/TimingReport.h>
+#include <Kodgen/Threading/MemoryBudget.h>
+
+using namespace kodgen;
+
+#define CHECK(condition)																	\
+	if (!(condition))																		\
+	{																						\
+		std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl;	\
+		return false;																		\
+	}
+
+/** Logger recording the messages and flushes it receives, optionally blocking in log until it is opened. */
+class RecordingLogger : public ILogger
+{
+	private:
+		std::mutex				_mutex;
+		std::condition_variable	_condition;
+		bool					_isOpen	= true;
+
+	public:
+		std::vector<std::string>	events;
+
+		virtual void log(std::string const& message, ELogSeverity) noexcept override
+		{
+			std::unique_lock lock(_mutex);
+
+			events.push_back(message);
+			_condition.notify_all();
+			_condition.wait(lock, [this]() { return _isOpen; });
+		}
+
+		virtual void flush() noexcept override
+		{
+			std::lock_guard lock(_mutex);
+
+			events.push_back("flush");
+		}
+
+		void setOpen(bool isOpen) noexcept
+		{
+			std::lock_guard lock(_mutex);
+
+			_isOpen = isOpen;
+			_condition.notify_all();
+		}
+
+		void waitEventCount(size_t count) noexcept
+		{
+			std::unique_lock lock(_mutex);
+
+			_condition.wait(lock, [this, count]() { return events.size() >= count; });
+		}
+
+		std::vector<std::string> getEvents() noexcept
+		{
+			std::lock_guard lock(_mutex);
+
+			return events;
+		}
+};
+
+bool testMultipleProducers()
+{
+	constexpr size_t producerCount		= 4u;
+	constexpr size_t messagesPerProducer	= 1000u;
+
+	RecordingLogger				sink;
+	AsyncLogger					logger(sink, producerCount * messagesPerProducer);
+	std::vector<std::thread>	producers;
+
+	for (size_t producer = 0u; producer < producerCount; producer++)
+	{
+		producers.emplace_back([&logger, producer]()
+		{
+			for (size_t i = 0u; i < messagesPerProducer; i++)
+			{
+				logger.log(std::to_string(producer) + " " + std::to_string(i));
+			}
+		});
+	}
+
+	for (std::thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	logger.flush();
+
+	//Each message is forwarded exactly once, in the order its producer logged it
+	std::vector<size_t>	nextIndices(producerCount, 0u);
+	size_t				messageCount = 0u;
+
+	for (std::string const& event : sink.getEvents())
+	{
+		if (event == "flush")
+		{
+			continue;
+		}
+
+		size_t separator	= event.find(' ');
+		size_t producer		= std::stoul(event.substr(0u, separator));
+		size_t index		= std::stoul(event.substr(separator + 1u));
+
+		CHECK(producer < producerCount);
+		CHECK(index == nextIndices[producer]);
+
+		nextIndices[producer]++;
+		messageCount++;
+	}
+
+	CHECK(messageCount == producerCount * messagesPerProducer);
+
+	return true;
+}
+
+bool testDroppedMessages()
+{
+	RecordingLogger	sink;
+	AsyncLogger		logger(sink, 4u);
+
+	//Block the flusher thread in the sink while it forwards the first message, so that its slot stays used
+	sink.setOpen(false);
+	logger.log("first");
+	sink.waitEventCount(1u);
+
+	//The 3 remaining slots are filled, the next messages are dropped
+	for (size_t i = 0u; i < 10u; i++)
+	{
+		logger.log("message " + std::to_string(i));
+	}
+
+	sink.setOpen(true);
+	logger.flush();
+
+	std::vector<std::string> events = sink.getEvents();
+
+	CHECK(events.size() == 6u);
+	CHECK(events[0] == "first");
+	CHECK(events[1] == "message 0");
+	CHECK(events[2] == "message 1");
+	CHECK(events[3] == "message 2");
+	CHECK(events[4] == "7 log message(s) dropped since the logger buffer was full.");
+	CHECK(events[5] == "flush");
+
+	//Once the buffer is drained, messages are accepted again
+	logger.log("last");
+	logger.flush();
+
+	events = sink.getEvents();
+
+	CHECK(events.size() == 8u);
+	CHECK(events[6] == "last");
+
+	return true;
+}
+
+bool testFlushOrdering()
+{
+	RecordingLogger	sink;
+	AsyncLogger		logger(sink);
+
+	for (size_t round = 0u; round < 100u; round++)
+	{
+		logger.log(std::to_string(round));
+		logger.flush();
+
+		//When flush returns, the message was forwarded then the sink was flushed
+		std::vector<std::string> events = sink.getEvents();
+
+		CHECK(events.size() >= 2u);
+		CHECK(events[events.size() - 2u] == std::to_string(round));
+		CHECK(events.back() == "flush");
+	}
+
+	return true;
+}
+
+bool testMinSeverity()
+{
+	RecordingLogger	sink;
+	AsyncLogger		logger(sink);
+
+	logger.setMinSeverity(ILogger::ELogSeverity::Warning);
+
+	CHECK(!logger.isLogged(ILogger::ELogSeverity::Info));
+	CHECK(logger.isLogged(ILogger::ELogSeverity::Error));
+
+	logger.log("info", ILogger::ELogSeverity::Info);
+	logger.log("warning", ILogger::ELogSeverity::Warning);
+	logger.flush();
+
+	std::vector<std::string> events = sink.getEvents();
+
+	CHECK(events.size() == 2u);
+	CHECK(events[0] == "warning");
+
+	return true;
+}
+
+bool testMemoryBudgetAdmission()
+{
+	MemoryBudget	budget(100u);
+	std::string		admittedOrder;
+
+	std::shared_ptr<MemoryBudget::Admission> first	= std::make_shared<MemoryBudget::Admission>();
+	std::shared_ptr<MemoryBudget::Admission> second	= std::make_shared<MemoryBudget::Admission>();
+	std::shared_ptr<MemoryBudget::Admission> third	= std::make_shared<MemoryBudget::Admission>();
+	std::shared_ptr<MemoryBudget::Admission> fourth	= std::make_shared<MemoryBudget::Admission>();
+
+	//Admitted work is started before admit returns
+	budget.admit(first, 60u, [&admittedOrder]() { admittedOrder += "1"; });
+	CHECK(admittedOrder == "1");
+	CHECK(first->getAmount() == 60u);
+
+	//Work which doesn't fit waits, without blocking the caller
+	budget.admit(second, 60u, [&admittedOrder]() { admittedOrder += "2"; });
+	CHECK(admittedOrder == "1");
+	CHECK(second->getAmount() == 0u);
+
+	//Smaller work which fits is not held back by the waiting work
+	budget.admit(third, 30u, [&admittedOrder]() { admittedOrder += "3"; });
+	CHECK(admittedOrder == "13");
+
+	budget.admit(fourth, 20u, [&admittedOrder]() { admittedOrder += "4"; });
+	CHECK(admittedOrder == "13");
+
+	//Releasing memory starts the waiting work which now fits, in admission order
+	first->release();
+	CHECK(admittedOrder == "132");
+	CHECK(second->getAmount() == 60u);
+
+	//Releasing twice gives nothing back
+	first->release();
+	CHECK(admittedOrder == "132");
+
+	//Destroying an admission releases its memory
+	third.reset();
+	CHECK(admittedOrder == "1324");
+	CHECK(fourth->getAmount() == 20u);
+
+	return true;
+}
+
+bool testMemoryBudgetLimits()
+{
+	std::string admittedOrder;
+
+	//An unlimited budget admits everything immediately, without accounting for it
+	MemoryBudget								unlimitedBudget;
+	std::shared_ptr<MemoryBudget::Admission>	unlimited = std::make_shared<MemoryBudget::Admission>();
+
+	unlimitedBudget.admit(unlimited, 1000u, [&admittedOrder]() { admittedOrder += "u"; });
+	CHECK(admittedOrder == "u");
+	CHECK(unlimited->getAmount() == 0u);
+
+	//Work larger than the whole budget is clamped to the capacity and admitted alone
+	MemoryBudget								budget(100u);
+	std::shared_ptr<MemoryBudget::Admission>	large	= std::make_shared<MemoryBudget::Admission>();
+	std::shared_ptr<MemoryBudget::Admission>	empty	= std::make_shared<MemoryBudget::Admission>();
+
+	budget.admit(large, 1000u, [&admittedOrder]() { admittedOrder += "l"; });
+	CHECK(admittedOrder == "ul");
+	CHECK(large->getAmount() == 100u);
+
+	//Empty work still accounts for 1 byte, so it waits for the large work
+	budget.admit(empty, 0u, [&admittedOrder]() { admittedOrder += "e"; });
+	CHECK(admittedOrder == "ul");
+
+	large->release();
+	CHECK(admittedOrder == "ule");
+	CHECK(empty->getAmount() == 1u);
+
+	return true;
+}
+
+bool testMemoryBudgetConcurrency()
+{
+	constexpr size_t workCount = 1000u;
+
+	MemoryBudget				budget(10u);
+	std::atomic<size_t>			admittedCount	= 0u;
+	std::atomic<uint64>			usedMemory		= 0u;
+	std::atomic_bool			exceeded		= false;
+	std::vector<std::thread>	threads;
+	std::mutex					admissionsMutex;
+	std::vector<std::shared_ptr<MemoryBudget::Admission>>	admissions;
+
+	//Work is released by other threads while new work is admitted
+	for (size_t thread = 0u; thread < 4u; thread++)
+	{
+		threads.emplace_back([&, thread]()
+		{
+			for (size_t i = thread; i < workCount; i += 4u)
+			{
+				std::shared_ptr<MemoryBudget::Admission> admission = std::make_shared<MemoryBudget::Admission>();
+
+				budget.admit(admission, 1u + i % 5u, [&, admission]()
+				{
+					if (usedMemory.fetch_add(admission->getAmount()) + admission->getAmount() > 10u)
+					{
+						exceeded = true;
+					}
+
+					admittedCount++;
+
+					std::lock_guard<std::mutex> lock(admissionsMutex);
+
+					admissions.push_back(admission);
+				});
+
+				//Release the admitted work of other threads
+				std::shared_ptr<MemoryBudget::Admission> toRelease;
+
+				{
+					std::lock_guard<std::mutex> lock(admissionsMutex);
+
+					if (!admissions.empty())
+					{
+						toRelease = std::move(admissions.back());
+						admissions.pop_back();
+					}
+				}
+
+				if (toRelease != nullptr)
+				{
+					usedMemory.fetch_sub(toRelease->getAmount());
+					toRelease->release();
+				}
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	//Release the remaining work until everything was admitted
+	while (true)
+	{
+		std::shared_ptr<MemoryBudget::Admission> toRelease;
+
+		{
+			std::lock_guard<std::mutex> lock(admissionsMutex);
+
+			if (admissions.empty())
+			{
+				break;
+			}
+
+			toRelease = std::move(admissions.back());
+			admissions.pop_back();
+		}
+
+		usedMemory.fetch_sub(toRelease->getAmount());
+		toRelease->release();
+	}
+
+	CHECK(!exceeded);
+	CHECK(admittedCount == workCount);
+	CHECK(usedMemory == 0u);
+
+	return true;
+}
+
+/**
+*	@brief Write a file of a fake cgroup hierarchy.
+*/
+static void writeFile(fs::path const& path, std::string const& content)
+{
+	fs::create_directories(path.parent_path());
+
+	std::ofstream stream(path, std::ios::out | std::ios::trunc);
+
+	stream << content;
+}
+
+bool testCgroupParsing()
+{
+	fs::path root		= fs::temp_directory_path() / ("KodgenMiscTests" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())));
+	fs::path cgroupRoot	= root / "cgroup";
+	fs::path cgroupFile	= root / "self_cgroup";
+
+	fs::remove_all(root);
+
+	//v1 entries are ignored, the v2 entry is the one with hierarchy 0
+	writeFile(cgroupFile, "12:cpu,cpuacct:/v1\n0::/parent/child\n");
+
+	//No quota nor limit anywhere
+	CHECK(System::getCpuQuota(cgroupFile, cgroupRoot) == 0u);
+	CHECK(System::getAvailableMemory(cgroupFile, cgroupRoot) == 0u);
+
+	//The quota is rounded up, and the most restrictive cgroup wins
+	writeFile(cgroupRoot / "parent" / "cpu.max", "250000 100000\n");
+	writeFile(cgroupRoot / "parent" / "child" / "cpu.max", "max 100000\n");
+	CHECK(System::getCpuQuota(cgroupFile, cgroupRoot) == 3u);
+
+	writeFile(cgroupRoot / "parent" / "child" / "cpu.max", "50000 100000\n");
+	CHECK(System::getCpuQuota(cgroupFile, cgroupRoot) == 1u);
+
+	//Available memory is the smallest limit minus usage of all the cgroups
+	writeFile(cgroupRoot / "parent" / "memory.max", "1000\n");
+	writeFile(cgroupRoot / "parent" / "memory.current", "400\n");
+	writeFile(cgroupRoot / "parent" / "child" / "memory.max", "max\n");
+	writeFile(cgroupRoot / "parent" / "child" / "memory.current", "300\n");
+	CHECK(System::getAvailableMemory(cgroupFile, cgroupRoot) == 600u);
+
+	writeFile(cgroupRoot / "parent" / "child" / "memory.max", "500\n");
+	CHECK(System::getAvailableMemory(cgroupFile, cgroupRoot) == 200u);
+
+	//A reached limit leaves 1 byte, so that it is not mistaken for no limit
+	writeFile(cgroupRoot / "parent" / "child" / "memory.current", "800\n");
+	CHECK(System::getAvailableMemory(cgroupFile, cgroupRoot) == 1u);
+
+	//Without a v2 entry, there is no cgroup to read
+	writeFile(cgroupFile, "12:cpu,cpuacct:/parent/child\n");
+	CHECK(System::getCpuQuota(cgroupFile, cgroupRoot) == 0u);
+	CHECK(System::getAvailableMemory(cgroupFile, cgroupRoot) == 0u);
+
+	fs::remove_all(root);
+
+	return true;
+}
+
+bool testTimingReport()
+{
+	TimingReport::Clock::time_point origin = TimingReport::Clock::now();
+
+	auto milliseconds = [](uint64 count) { return std::chrono::milliseconds(count); };
+
+	//Spans of each task are recorded in separate reports and merged together
+	TimingReport report;
+	TimingReport otherReport;
+
+	report.addSpan("File", "Parse", "Slow.h", origin + milliseconds(1), origin + milliseconds(31));
+	report.addSpan("Phase", "Scan", "", origin, origin + milliseconds(2));
+	otherReport.addSpan("File", "Parse", "Fast.h", origin + milliseconds(2), origin + milliseconds(7));
+	otherReport.addSpan("File", "Generate", "Fast.h", origin + milliseconds(7), origin + milliseconds(17));
+
+	report.mergeReport(std::move(otherReport));
+
+	CHECK(otherReport.spans.empty());
+	CHECK(report.spans.size() == 4u);
+	CHECK(report.spans[2].detail == "Fast.h");
+	CHECK(report.spans[2].duration == 5000u);
+
+	//The summary aggregates spans per category/name and sorts files from the slowest one
+	std::string summary = report.getSummary();
+
+	CHECK(summary.find("Category") == 0u);
+	CHECK(summary.find("File       Parse                                           2       35.000       17.500       30.000") != std::string::npos);
+	CHECK(summary.find("Phase      Scan                                            1        2.000") != std::string::npos);
+	CHECK(summary.find("Slow.h") < summary.find("Fast.h"));
+	CHECK(summary.find("15.000 ms  Fast.h") != std::string::npos);
+	CHECK(report.getSummary(1u).find("Fast.h") == std::string::npos);
+	CHECK(report.getSummary(0u).find("Slowest files") == std::string::npos);
+
+	//The trace is relative to the earliest span and escapes names and details
+	report.addSpan("File", "Parse", "Dir\\\"Quoted\".h", origin + milliseconds(3), origin + milliseconds(4));
+
+	fs::path traceFile = fs::temp_directory_path() / ("KodgenTimingReport" + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".json");
+
+	CHECK(report.exportChromeTrace(traceFile));
+
+	std::ifstream		stream(traceFile);
+	std::stringstream	content;
+
+	content << stream.rdbuf();
+	stream.close();
+
+	fs::remove(traceFile);
+
+	CHECK(content.str().find("{\"traceEvents\":[") == 0u);
+	CHECK(content.str().find("{\"name\":\"Scan\",\"cat\":\"Phase\",\"ph\":\"X\",\"ts\":0,\"dur\":2000,") != std::string::npos);
+	CHECK(content.str().find("\"ts\":1000,\"dur\":30000,") != std::string::npos);
+	CHECK(content.str().find("\"args\":{\"detail\":\"Dir\\\\\\\"Quoted\\\".h\"}") != std::string::npos);
+	CHECK(content.str().find("\"displayTimeUnit\":\"ms\"}") != std::string::npos);
+
+	//Type names are demangled when the compiler supports it
+	CHECK(TimingReport::getReadableName(nullptr).empty());
+	CHECK(TimingReport::getReadableName("Parse") == "Parse");
+#if defined(__GNUC__) || defined(__clang__)
+	CHECK(TimingReport::getReadableName(typeid(TimingReport).name()) == "kodgen::TimingReport");
+#endif
+
+	return true;
+}
+
+int main()
+{
+	bool success = true;
+
+	success &= testMultipleProducers();
+	success &= testDroppedMessages();
+	success &= testFlushOrdering();
+	success &= testMinSeverity();
+	success &= testMemoryBudgetAdmission();
+	success &= testMemoryBudgetLimits();
+	success &= testMemoryBudgetConcurrency();
+	success &= testCgroupParsing();
+	success &= testTimingReport();
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
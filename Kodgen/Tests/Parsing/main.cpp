@@ -0,0 +1,586 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <fstream>
+#include <cstring>	//std::memcpy
+#include <limits>
+#include <algorithm>	//std::min
+
+#if !_WIN32
+#include <unistd.h>
+#endif
+
+#include <Kodgen/Parsing/ParsingWorkerPool.h>
+#include <Kodgen/Parsing/FileParser.h>
+#include <Kodgen/Parsing/FileParsingResultSerializer.h>
+#include <Kodgen/Parsing/CompilationDatabase.h>
+#include <Kodgen/Misc/DefaultLogger.h>
+#include <Kodgen/Threading/CancellationToken.h>
+
+using namespace kodgen;
+
+#define CHECK(condition)																	\
+	if (!(condition))																		\
+	{																						\
+		std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl;	\
+		return false;																		\
+	}
+
+/** Number of files parsed by a worker before it is replaced. */
+constexpr uint32 const maxFilesPerWorker = 3u;
+
+/** Parse function of the test workers: report the worker process id in an error, crash or hang on request. */
+void fakeParse(fs::path const& file, FileParsingResult& out_result)
+{
+	if (file == "crash")
+	{
+		std::abort();
+	}
+	else if (file == "hang")
+	{
+		std::this_thread::sleep_for(std::chrono::hours(1));
+	}
+
+	out_result.parsedFile = file;
+
+#if !_WIN32
+	out_result.errors.emplace_back(std::to_string(::getpid()));
+#endif
+}
+
+bool testWorkerParsing(ParsingWorkerPool& pool)
+{
+	constexpr size_t const threadCount		= 4u;
+	constexpr size_t const filesPerThread	= 12u;
+
+	std::mutex					mutex;
+	std::set<std::string>		processIds;
+	std::vector<std::thread>	threads;
+	bool						succeeded = true;
+
+	//Workers are replaced while other threads are parsing
+	for (size_t i = 0u; i < threadCount; i++)
+	{
+		threads.emplace_back([&, i]()
+		{
+			for (size_t j = 0u; j < filesPerThread; j++)
+			{
+				fs::path			file = "file" + std::to_string(i) + "_" + std::to_string(j);
+				FileParsingResult	result;
+				bool				parsed = pool.parse(file, result);
+
+				std::lock_guard lock(mutex);
+
+				succeeded &= parsed && result.parsedFile == file && result.errors.size() == 1u;
+
+				if (!result.errors.empty())
+				{
+					processIds.insert(result.errors.front().getDescription());
+				}
+			}
+		});
+	}
+
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	CHECK(succeeded);
+	CHECK(processIds.size() >= threadCount * filesPerThread / maxFilesPerWorker);
+
+	return true;
+}
+
+bool testWorkerCrash(ParsingWorkerPool& pool)
+{
+	FileParsingResult crashResult;
+
+	CHECK(!pool.parse("crash", crashResult));
+	CHECK(crashResult.parsedFile == "crash");
+	CHECK(!crashResult.errors.empty());
+
+	//The crashed worker is replaced
+	for (int i = 0; i < 4; i++)
+	{
+		FileParsingResult result;
+
+		CHECK(pool.parse("afterCrash", result));
+		CHECK(result.parsedFile == "afterCrash");
+	}
+
+	return true;
+}
+
+bool testWorkerInterruption(ParsingWorkerPool& pool)
+{
+	FileParsingResult timedOutResult;
+
+	CHECK(!pool.parse("hang", timedOutResult, 100u));
+	CHECK(!timedOutResult.errors.empty());
+	CHECK(timedOutResult.errors.front().getDescription().find("timed out") != std::string::npos);
+
+	CancellationSource	cancellationSource;
+	FileParsingResult	cancelledResult;
+	std::thread			cancellingThread([&cancellationSource]()
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		cancellationSource.cancel();
+	});
+
+	CHECK(!pool.parse("hang", cancelledResult, 0u, cancellationSource.getToken()));
+	cancellingThread.join();
+	CHECK(!cancelledResult.errors.empty());
+	CHECK(cancelledResult.errors.front().getDescription().find("cancelled") != std::string::npos);
+
+	//The killed workers are replaced
+	FileParsingResult result;
+
+	CHECK(pool.parse("afterInterruption", result));
+	CHECK(result.parsedFile == "afterInterruption");
+
+	return true;
+}
+
+/** Header covering the encoded entity kinds: properties, templates, inheritance, nested entities, enums, functions and variables. */
+constexpr char const* const fixtureCode = R"(
+namespace Outer KGNamespace(Tag)
+{
+	template <typename T, int N>
+	struct Buffer
+	{
+		T values[N];
+	};
+
+	enum class KGEnum(Flags) Color : unsigned char
+	{
+		Red KGEnumVal(Primary[1, 2]) = 1,
+		Green = 2,
+		Blue = 4
+	};
+
+	class Base
+	{
+		public:
+			virtual ~Base() = default;
+
+		protected:
+			int baseValue = 0;
+	};
+
+	class KGClass(Serialized, Version[2]) Derived : public Base, private Buffer<float, 4>
+	{
+		public:
+			struct Nested
+			{
+				double ratio;
+			};
+
+			KGField(Get[const, &], Set)
+			Nested nested;
+
+			KGMethod(Callable)
+			virtual int compute(int value, Nested const& other) const noexcept;
+
+		private:
+			Color color = Color::Green;
+	};
+
+	KGFunction(Pure)
+	inline float square(float value) { return value * value; }
+
+	extern int globalCounter;
+}
+
+struct TopLevel : Outer::Derived
+{
+};
+)";
+
+/**
+*	@brief Find an entity of an encoded result by name.
+*
+*	@param view Opened encoded result.
+*	@param name Name of the entity.
+*
+*	@return The first entity with the name, or an invalid entity if there is none.
+*/
+FileParsingResultView::Entity findEntity(FileParsingResultView const& view, std::string_view name)
+{
+	for (FileParsingResultView::Entity entity : view.getEntities())
+	{
+		if (entity.getName() == name)
+		{
+			return entity;
+		}
+	}
+
+	return FileParsingResultView::Entity(&view, view.getEntities().size());
+}
+
+/**
+*	@brief Parse the fixture header with the same settings as the CppProperties example.
+*
+*	@param out_result Result to fill.
+*
+*	@return true if the fixture was parsed without error, else false.
+*/
+bool parseFixture(FileParsingResult& out_result)
+{
+	fs::path directory	= fs::temp_directory_path() / "KodgenParsingTests";
+	fs::path fixture	= directory / "Fixture.h";
+
+	fs::create_directories(directory);
+	std::ofstream(fixture, std::ios::out | std::ios::trunc) << fixtureCode;
+
+	DefaultLogger	logger;
+	FileParser		fileParser;
+	ParsingSettings&	parsingSettings = fileParser.getSettings();
+
+	fileParser.logger = &logger;
+
+	parsingSettings.shouldParseAllNamespaces	= true;
+	parsingSettings.shouldParseAllClasses		= true;
+	parsingSettings.shouldParseAllStructs		= true;
+	parsingSettings.shouldParseAllVariables		= true;
+	parsingSettings.shouldParseAllFields		= true;
+	parsingSettings.shouldParseAllFunctions		= true;
+	parsingSettings.shouldParseAllMethods		= true;
+	parsingSettings.shouldParseAllEnums			= true;
+
+	parsingSettings.propertyParsingSettings.propertySeparator		= ',';
+	parsingSettings.propertyParsingSettings.argumentEnclosers[0]	= '[';
+	parsingSettings.propertyParsingSettings.argumentEnclosers[1]	= ']';
+	parsingSettings.propertyParsingSettings.argumentSeparator		= ',';
+
+	parsingSettings.propertyParsingSettings.namespaceMacroName	= "KGNamespace";
+	parsingSettings.propertyParsingSettings.classMacroName		= "KGClass";
+	parsingSettings.propertyParsingSettings.structMacroName		= "KGStruct";
+	parsingSettings.propertyParsingSettings.variableMacroName	= "KGVariable";
+	parsingSettings.propertyParsingSettings.fieldMacroName		= "KGField";
+	parsingSettings.propertyParsingSettings.functionMacroName	= "KGFunction";
+	parsingSettings.propertyParsingSettings.methodMacroName		= "KGMethod";
+	parsingSettings.propertyParsingSettings.enumMacroName		= "KGEnum";
+	parsingSettings.propertyParsingSettings.enumValueMacroName	= "KGEnumVal";
+
+#if defined(__GNUC__)
+	parsingSettings.setCompilerExeName("g++");
+#elif defined(__clang__)
+	parsingSettings.setCompilerExeName("clang++");
+#elif defined(_MSC_VER)
+	parsingSettings.setCompilerExeName("msvc");
+#endif
+
+	parsingSettings.init(&logger);
+
+	bool parsed = fileParser.parse(fixture, out_result);
+
+	fs::remove_all(directory);
+
+	return parsed && out_result.errors.empty();
+}
+
+bool testResultRoundTrip(FileParsingResult const& result)
+{
+	//Make sure the fixture was parsed as expected, so that the round trip covers all entity kinds
+	CHECK(result.namespaces.size() == 1u);
+	CHECK(result.structs.size() == 1u);
+
+	NamespaceInfo const& outer = result.namespaces.front();
+
+	CHECK(outer.classes.size() == 2u);
+	CHECK(outer.structs.size() == 1u);
+	CHECK(outer.enums.size() == 1u);
+	CHECK(outer.functions.size() == 1u);
+	CHECK(outer.variables.size() == 1u);
+
+	std::vector<uint8> buffer;
+
+	CHECK(FileParsingResultSerializer::serialize(result, buffer));
+
+	//The view reads the entities without decoding them
+	FileParsingResultView view;
+
+	CHECK(view.open(buffer.data(), buffer.size()));
+	CHECK(view.getParsedFile() == result.parsedFile.string());
+	CHECK(view.getErrors().empty());
+	CHECK(view.getRootEntities().size() == 2u);
+	CHECK(view.getRootEntities()[0].getName() == "Outer");
+	CHECK(view.getRootEntities()[1].getName() == "TopLevel");
+
+	FileParsingResultView::Entity derived = findEntity(view, "Derived");
+
+	CHECK(derived.isValid());
+	CHECK(derived.getEntityType() == EEntityType::Class);
+	CHECK(derived.getOuterEntity().getName() == "Outer");
+	CHECK(derived.getProperties().size() == 2u);
+	CHECK(derived.getProperties()[0].getName() == "Serialized");
+	CHECK(derived.getProperties()[1].getName() == "Version");
+	CHECK(derived.getProperties()[1].getArgumentCount() == 1u);
+	CHECK(derived.getProperties()[1].getArgument(0u) == "2");
+	CHECK(derived.getParents().size() == 2u);
+	CHECK(derived.getParents()[0].getInheritanceAccess() == EAccessSpecifier::Public);
+	CHECK(derived.getParents()[1].getInheritanceAccess() == EAccessSpecifier::Private);
+
+	FileParsingResultView::Entity compute = findEntity(view, "compute");
+
+	CHECK(compute.isValid());
+	CHECK(compute.getOuterEntity().getIndex() == derived.getIndex());
+	CHECK(compute.getAccessSpecifier() == EAccessSpecifier::Public);
+	CHECK(compute.getParameters().size() == 2u);
+	CHECK(compute.getParameters()[1].getName() == "other");
+
+	FileParsingResultView::Entity blue = findEntity(view, "Blue");
+
+	CHECK(blue.isValid());
+	CHECK(blue.getValue() == 4);
+
+	//Decoding then encoding again must give the same bytes, so nothing was lost by the decoding
+	FileParsingResult	decodedResult;
+	std::vector<uint8>	reencodedBuffer;
+
+	CHECK(FileParsingResultSerializer::deserialize(buffer.data(), buffer.size(), decodedResult));
+	CHECK(FileParsingResultSerializer::serialize(decodedResult, reencodedBuffer));
+	CHECK(reencodedBuffer == buffer);
+
+	//Spot check the decoded info structures against the parsed ones
+	CHECK(decodedResult.parsedFile == result.parsedFile);
+	CHECK(decodedResult.namespaces.size() == 1u);
+
+	NamespaceInfo const& decodedOuter = decodedResult.namespaces.front();
+
+	CHECK(decodedOuter.name == outer.name);
+	CHECK(decodedOuter.id == outer.id);
+	CHECK(decodedOuter.properties.size() == 1u);
+	CHECK(decodedOuter.properties.front().name == "Tag");
+	CHECK(decodedOuter.classes.size() == outer.classes.size());
+
+	for (size_t i = 0u; i < outer.classes.size(); i++)
+	{
+		StructClassInfo const& parsedClass	= outer.classes[i];
+		StructClassInfo const& decodedClass	= decodedOuter.classes[i];
+
+		CHECK(decodedClass.name == parsedClass.name);
+		CHECK(decodedClass.type.getCanonicalName() == parsedClass.type.getCanonicalName());
+		CHECK(decodedClass.parents.size() == parsedClass.parents.size());
+		CHECK(decodedClass.fields.size() == parsedClass.fields.size());
+		CHECK(decodedClass.methods.size() == parsedClass.methods.size());
+		CHECK(decodedClass.nestedStructs.size() == parsedClass.nestedStructs.size());
+
+		for (size_t j = 0u; j < parsedClass.fields.size(); j++)
+		{
+			CHECK(decodedClass.fields[j].name == parsedClass.fields[j].name);
+			CHECK(decodedClass.fields[j].type.getCanonicalName() == parsedClass.fields[j].type.getCanonicalName());
+			CHECK(decodedClass.fields[j].accessSpecifier == parsedClass.fields[j].accessSpecifier);
+			CHECK(decodedClass.fields[j].memoryOffset == parsedClass.fields[j].memoryOffset);
+		}
+
+		for (size_t j = 0u; j < parsedClass.methods.size(); j++)
+		{
+			CHECK(decodedClass.methods[j].prototype == parsedClass.methods[j].prototype);
+			CHECK(decodedClass.methods[j].parameters.size() == parsedClass.methods[j].parameters.size());
+		}
+	}
+
+	CHECK(decodedOuter.enums.size() == 1u);
+	CHECK(decodedOuter.enums.front().enumValues.size() == 3u);
+	CHECK(decodedOuter.enums.front().enumValues.front().properties.front().arguments == outer.enums.front().enumValues.front().properties.front().arguments);
+	CHECK(decodedOuter.enums.front().underlyingType.getCanonicalName() == outer.enums.front().underlyingType.getCanonicalName());
+	CHECK(decodedOuter.functions.front().prototype == outer.functions.front().prototype);
+	CHECK(decodedOuter.variables.front().type.getCanonicalName() == outer.variables.front().type.getCanonicalName());
+
+	//Inheritance links of the tree
+	auto const& parsedEntries	= result.structClassTree.getEntries();
+	auto const& decodedEntries	= decodedResult.structClassTree.getEntries();
+
+	CHECK(decodedEntries.size() == parsedEntries.size());
+
+	for (auto const& [childName, parsedLinks] : parsedEntries)
+	{
+		auto it = decodedEntries.find(childName);
+
+		CHECK(it != decodedEntries.cend());
+		CHECK(it->second.size() == parsedLinks.size());
+
+		for (size_t i = 0u; i < parsedLinks.size(); i++)
+		{
+			CHECK(it->second[i].inheritedStructClassName == parsedLinks[i].inheritedStructClassName);
+			CHECK(it->second[i].inheritanceAccess == parsedLinks[i].inheritanceAccess);
+		}
+	}
+
+	EAccessSpecifier access = EAccessSpecifier::Invalid;
+
+	CHECK(decodedResult.structClassTree.isBaseOf("Outer::Base", "Outer::Derived", &access));
+	CHECK(access == EAccessSpecifier::Public);
+	CHECK(decodedResult.structClassTree.isBaseOf("Outer::Buffer<float, 4>", "Outer::Derived", &access));
+	CHECK(access == EAccessSpecifier::Private);
+
+	return true;
+}
+
+bool testCorruptedBuffer(FileParsingResult const& result)
+{
+	using Format = FileParsingResultFormat;
+
+	std::vector<uint8> buffer;
+
+	CHECK(FileParsingResultSerializer::serialize(result, buffer));
+
+	FileParsingResultView	view;
+	FileParsingResult		decodedResult;
+
+	//Edit a copy of the header of a valid buffer, so that a single field is corrupted at a time
+	auto isRejected = [&buffer, &view, &decodedResult](auto&& corrupt, size_t size)
+	{
+		std::vector<uint8>	corruptedBuffer = buffer;
+		Format::Header		header;
+
+		std::memcpy(&header, corruptedBuffer.data(), sizeof(header));
+		corrupt(header);
+		std::memcpy(corruptedBuffer.data(), &header, sizeof(header));
+
+		size = std::min(size, corruptedBuffer.size());
+
+		return !view.open(corruptedBuffer.data(), size) && !view.isValid() &&
+			   !FileParsingResultSerializer::deserialize(corruptedBuffer.data(), size, decodedResult);
+	};
+
+	auto keepHeader = [](Format::Header&) {};
+
+	CHECK(view.open(buffer.data(), buffer.size()));
+	CHECK(!isRejected(keepHeader, buffer.size()));
+
+	CHECK(isRejected([](Format::Header& header) { header.magic++; }, buffer.size()));
+	CHECK(isRejected([](Format::Header& header) { header.version++; }, buffer.size()));
+	CHECK(isRejected([&buffer](Format::Header& header) { header.size = buffer.size() + 8u; }, buffer.size()));
+	CHECK(isRejected([](Format::Header& header) { header.entities.count = std::numeric_limits<uint32>::max(); }, buffer.size()));
+	CHECK(isRejected([](Format::Header& header) { header.strings.offset = static_cast<uint32>(header.size); header.strings.count = 1u; }, buffer.size()));
+	CHECK(isRejected([](Format::Header& header) { header.types.offset += 4u; }, buffer.size()));
+
+	//Truncated buffers
+	CHECK(isRejected(keepHeader, buffer.size() - 8u));
+	CHECK(isRejected(keepHeader, sizeof(Format::Header) - 1u));
+	CHECK(isRejected(keepHeader, 0u));
+
+	//Misaligned buffer
+	std::vector<uint8> misalignedBuffer(buffer.size() + 1u);
+
+	std::memcpy(misalignedBuffer.data() + 1u, buffer.data(), buffer.size());
+
+	CHECK(!view.open(misalignedBuffer.data() + 1u, buffer.size()));
+	CHECK(!view.open(nullptr, buffer.size()));
+
+	return true;
+}
+
+bool testCompilationDatabase()
+{
+	fs::path directory = fs::temp_directory_path() / "KodgenParsingTests" / "CompilationDatabase";
+
+	fs::remove_all(directory);
+
+	for (char const* subdirectory : { "Build", "Include", "Source/A/Sub", "Source/B" })
+	{
+		fs::create_directories(directory / subdirectory);
+	}
+
+	directory = fs::canonical(directory);
+
+	for (char const* file : { "Source/A/a.cpp", "Source/A/b.cpp", "Source/A/Sub/h.h", "Source/B/c.cpp", "Source/h.h" })
+	{
+		std::ofstream(directory / file) << "\n";
+	}
+
+	std::string buildDirectory = directory.generic_string() + "/Build";
+
+	//Files of the same target share their arguments, whatever the format of their command
+	std::ofstream(directory / "Build" / "compile_commands.json") << "[\n"
+		"{ \"directory\": \"" << buildDirectory << "\", \"command\": \"clang++ -std=c++17 -I../Include -DA_DEFINE -Wall -c ../Source/A/b.cpp -o b.o\", \"file\": \"../Source/A/b.cpp\" },\n"
+		"{ \"directory\": \"" << buildDirectory << "\", \"arguments\": [\"clang++\", \"-std=c++17\", \"-I\", \"../Include\", \"-D\", \"A_DEFINE\", \"-O2\", \"-c\", \"../Source/A/a.cpp\"], \"file\": \"../Source/A/a.cpp\" },\n"
+		"{ \"directory\": \"" << buildDirectory << "\", \"arguments\": [\"cl.exe\", \"/std:c++20\", \"/I../Include\", \"/DB_DEFINE=2\", \"-isystem\", \"/usr/include\", \"/c\", \"../Source/B/c.cpp\"], \"file\": \"../Source/B/c.cpp\" }\n"
+		"]\n";
+
+	CompilationDatabase database;
+
+	CHECK(database.load(directory / "Build", nullptr));
+	CHECK(database.getArgumentSets().size() == 2u);
+
+	opt::optional<uint32> aArguments = database.findArgumentSet(directory / "Source" / "A" / "a.cpp");
+	opt::optional<uint32> bArguments = database.findArgumentSet(directory / "Source" / "B" / "c.cpp");
+
+	CHECK(aArguments.has_value() && bArguments.has_value());
+	CHECK(database.findArgumentSet(directory / "Source" / "A" / "b.cpp") == aArguments);
+	CHECK(aArguments != bArguments);
+
+	//Only the arguments affecting parsing are kept, with absolute paths
+	std::string includeDirectory = (directory / "Include").string();
+
+	CHECK(database.getArgumentSets()[aArguments.value()] == std::vector<std::string>({ "-std=c++17", "-I" + includeDirectory, "-DA_DEFINE" }));
+	CHECK(database.getArgumentSets()[bArguments.value()] == std::vector<std::string>({ "-std=c++20", "-I" + includeDirectory, "-DB_DEFINE=2", "-isystem/usr/include" }));
+
+	//Headers get the arguments of the nearest compiled file, files outside of the project get none
+	CHECK(database.findArgumentSet(directory / "Source" / "A" / "Sub" / "h.h") == aArguments);
+	CHECK(database.findArgumentSet(directory / "Source" / "h.h") == aArguments);
+	CHECK(!database.findArgumentSet(directory.parent_path() / "Other.h").has_value());
+
+	//A directory without database fails to load and clears the previous commands
+	CHECK(!database.load(directory / "Include", nullptr));
+	CHECK(database.getArgumentSets().empty());
+	CHECK(!database.findArgumentSet(directory / "Source" / "A" / "a.cpp").has_value());
+
+	fs::remove_all(directory);
+
+	return true;
+}
+
+int main()
+{
+	bool success = true;
+
+	if (ParsingWorkerPool::isSupported())
+	{
+		//The helper process is forked before the tests start any thread
+		ParsingWorkerPool pool;
+
+		if (!pool.start(2u, maxFilesPerWorker, fakeParse))
+		{
+			std::cerr << "Failed to start the parsing worker pool." << std::endl;
+
+			return EXIT_FAILURE;
+		}
+
+		success &= testWorkerParsing(pool);
+		success &= testWorkerCrash(pool);
+		success &= testWorkerInterruption(pool);
+
+		pool.stop();
+		success &= !pool.isRunning();
+	}
+
+	success &= testCompilationDatabase();
+
+	FileParsingResult fixtureResult;
+
+	if (parseFixture(fixtureResult))
+	{
+		success &= testResultRoundTrip(fixtureResult);
+		success &= testCorruptedBuffer(fixtureResult);
+	}
+	else
+	{
+		for (ParsingError const& error : fixtureResult.errors)
+		{
+			std::cerr << error.toString() << std::endl;
+		}
+
+		std::cerr << "Failed to parse the fixture." << std::endl;
+		success = false;
+	}
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
\ No newline at end of file
@@ -1,7 +1,20 @@
 #include <iostream>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <chrono>
+#include <ctime>	//std::clock
 
 #include <Kodgen/Threading/ThreadPool.h>
 #include <Kodgen/Threading/TaskHelper.h>
+#include <Kodgen/Threading/CancellationToken.h>
+
+#if KODGEN_COROUTINES
+#include <Kodgen/Threading/Coroutine.h>
+#endif
 
 using namespace kodgen;
 
@@ -15,6 +28,354 @@ struct B
 	void operator()(TaskBase*) noexcept { std::cout << "I am B!" << std::endl; }
 };
 
+#define CHECK(condition)																		\
+	if (!(condition))																			\
+	{																							\
+		std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << std::endl;	\
+		return false;																			\
+	}
+
+bool testBatchCoverage()
+{
+	ThreadPool threadPool(4u);
+
+	//Uneven counts and chunk sizes, including chunks larger than the batch
+	for (uint64 count : { 0u, 1u, 7u, 1000u, 4099u })
+	{
+		for (uint64 chunkSize : { 0u, 1u, 3u, 64u, 5000u })
+		{
+			std::vector<std::atomic<uint32>> calls(count);
+
+			std::shared_ptr<TaskBase> batch = threadPool.submitBatch("Coverage", count, [&calls](uint64 index, TaskBase*)
+											  {
+												  calls[index]++;
+											  }, {}, CancellationToken(), ETaskPriority::Normal, chunkSize);
+
+			threadPool.waitTask(*batch);
+
+			CHECK(!batch->wasCancelled());
+
+			//Each index is processed exactly once
+			for (std::atomic<uint32> const& callCount : calls)
+			{
+				CHECK(callCount == 1u);
+			}
+		}
+	}
+
+	return true;
+}
+
+bool testBatchResultsOrder()
+{
+	ThreadPool threadPool(4u);
+
+	std::shared_ptr<TaskBase> batch = threadPool.submitBatch("Squares", 10000u, [](uint64 index, TaskBase*) -> uint64 { return index * index; });
+
+	threadPool.waitTask(*batch);
+
+	std::vector<uint64> results = TaskHelper::getBatchResults<uint64>(batch.get());
+
+	CHECK(results.size() == 10000u);
+
+	//Results are stored by index, regardless of the order chunks were processed in
+	for (uint64 i = 0u; i < results.size(); i++)
+	{
+		CHECK(results[i] == i * i);
+	}
+
+	//parallelFor returns the results the same way
+	std::vector<uint64> parallelForResults = threadPool.parallelFor(1000u, [](uint64 index, TaskBase*) -> uint64 { return index + 1u; });
+
+	CHECK(parallelForResults.size() == 1000u);
+
+	for (uint64 i = 0u; i < parallelForResults.size(); i++)
+	{
+		CHECK(parallelForResults[i] == i + 1u);
+	}
+
+	return true;
+}
+
+bool testNestedParallelFor()
+{
+	ThreadPool threadPool(2u);
+
+	//Each outer index runs a parallelFor from a pool task: waiting workers must execute the inner batches instead of blocking
+	std::shared_ptr<TaskBase> task = threadPool.submitTask("Nested", [&threadPool](TaskBase*) -> uint64
+									 {
+										 std::vector<uint64> sums = threadPool.parallelFor(8u, [&threadPool](uint64 outerIndex, TaskBase*) -> uint64
+																	{
+																		std::vector<uint64> values = threadPool.parallelFor(100u, [outerIndex](uint64 innerIndex, TaskBase*) -> uint64
+																									 {
+																										 return outerIndex * 100u + innerIndex;
+																									 });
+
+																		uint64 sum = 0u;
+
+																		for (uint64 value : values)
+																		{
+																			sum += value;
+																		}
+
+																		return sum;
+																	});
+
+										 uint64 total = 0u;
+
+										 for (uint64 sum : sums)
+										 {
+											 total += sum;
+										 }
+
+										 return total;
+									 });
+
+	threadPool.waitTask(*task);
+
+	//Sum of [0, 800[
+	CHECK(TaskHelper::getResult<uint64>(task.get()) == 799u * 800u / 2u);
+
+	return true;
+}
+
+bool testPriorityOrder()
+{
+	ThreadPool			threadPool(1u);
+	std::mutex			orderMutex;
+	std::vector<char>	order;
+
+	auto record = [&orderMutex, &order](char name)
+	{
+		return [&orderMutex, &order, name](TaskBase*)
+		{
+			std::lock_guard<std::mutex> lock(orderMutex);
+
+			order.push_back(name);
+		};
+	};
+
+	//Queue all tasks before the worker can pick any of them
+	threadPool.setIsRunning(false);
+
+	std::shared_ptr<TaskBase> low1		= threadPool.submitTask("Low", record('l'), {}, CancellationToken(), ETaskPriority::Low);
+	std::shared_ptr<TaskBase> normal1	= threadPool.submitTask("Normal", record('n'), {}, CancellationToken(), ETaskPriority::Normal);
+	std::shared_ptr<TaskBase> high1		= threadPool.submitTask("High", record('h'), {}, CancellationToken(), ETaskPriority::High);
+	std::shared_ptr<TaskBase> low2		= threadPool.submitTask("Low", record('L'), {}, CancellationToken(), ETaskPriority::Low);
+	std::shared_ptr<TaskBase> high2		= threadPool.submitTask("High", record('H'), {}, CancellationToken(), ETaskPriority::High);
+
+	//A high priority task which is not ready doesn't hold back the ready tasks
+	std::shared_ptr<TaskBase> dependent	= threadPool.submitTask("Dependent", record('d'), { low2 }, CancellationToken(), ETaskPriority::High);
+
+	threadPool.setIsRunning(true);
+	threadPool.waitTask(*dependent);
+
+	{
+		std::lock_guard<std::mutex> lock(orderMutex);
+
+		//Highest priority first, then submission order
+		CHECK(std::string(order.begin(), order.end()) == "hHnlLd");
+	}
+
+	//A low priority task gains priority while waiting, so it is not starved by a flow of higher priority tasks submitted after it
+	std::atomic<size_t>				remainingHighTasks = 500u;
+	std::function<void(TaskBase*)>	submitNextHighTask;
+	std::shared_ptr<TaskBase>		lowTask;
+
+	submitNextHighTask = [&](TaskBase*)
+	{
+		record('h')(nullptr);
+
+		if (--remainingHighTasks > 0u)
+		{
+			threadPool.submitTask("High", [&submitNextHighTask](TaskBase* task) { submitNextHighTask(task); }, {}, CancellationToken(), ETaskPriority::High);
+		}
+	};
+
+	order.clear();
+	threadPool.setIsRunning(false);
+
+	lowTask = threadPool.submitTask("Low", record('l'), {}, CancellationToken(), ETaskPriority::Low);
+	threadPool.submitTask("High", [&submitNextHighTask](TaskBase* task) { submitNextHighTask(task); }, {}, CancellationToken(), ETaskPriority::High);
+
+	threadPool.setIsRunning(true);
+	threadPool.waitTask(*lowTask);
+
+	//High priority tasks record themselves before decrementing the count
+	while (remainingHighTasks != 0u)
+	{
+		std::this_thread::yield();
+	}
+
+	std::lock_guard<std::mutex> lock(orderMutex);
+
+	size_t lowPosition = std::find(order.begin(), order.end(), 'l') - order.begin();
+
+	CHECK(order.size() == 501u);
+	CHECK(lowPosition > 0u && lowPosition < 500u);
+
+	return true;
+}
+
+bool testCancellation()
+{
+	ThreadPool			threadPool(2u);
+	CancellationSource	cancellationSource;
+	std::atomic<uint32>	executedCount = 0u;
+
+	threadPool.setIsRunning(false);
+
+	std::shared_ptr<TaskBase> cancelled	= threadPool.submitTask("Cancelled", [&executedCount](TaskBase*) -> int { executedCount++; return 1; }, {}, cancellationSource.getToken());
+	std::shared_ptr<TaskBase> kept		= threadPool.submitTask("Kept", [&executedCount](TaskBase*) -> int { executedCount++; return 2; });
+
+	//A task depending on a cancelled task is skipped even if its own token is not cancelled
+	std::shared_ptr<TaskBase> dependent	= threadPool.submitTask("Dependent", [&executedCount](TaskBase*) -> int { executedCount++; return 3; }, { cancelled });
+
+	std::shared_ptr<TaskBase> batch		= threadPool.submitBatch("Batch", 100u, [&executedCount](uint64, TaskBase*) -> int { executedCount++; return 4; }, {}, cancellationSource.getToken());
+
+	cancellationSource.cancel();
+	threadPool.setIsRunning(true);
+
+	threadPool.waitTask(*cancelled);
+	threadPool.waitTask(*kept);
+	threadPool.waitTask(*dependent);
+	threadPool.waitTask(*batch);
+
+	CHECK(cancelled->wasCancelled());
+	CHECK(dependent->wasCancelled());
+	CHECK(batch->wasCancelled());
+
+	//Tasks without a cancelled token or dependency still run and return their result
+	CHECK(!kept->wasCancelled());
+	CHECK(TaskHelper::getResult<int>(kept.get()) == 2);
+	CHECK(executedCount == 1u);
+
+	return true;
+}
+
+bool testDependencyWait()
+{
+	ThreadPool			threadPool(4u);
+	std::atomic<bool>	dependencyFinished	= false;
+	std::atomic<uint32>	dependentCount		= 0u;
+
+	std::chrono::steady_clock::time_point	wallStart	= std::chrono::steady_clock::now();
+	std::clock_t							cpuStart	= std::clock();
+
+	std::shared_ptr<TaskBase> dependency = threadPool.submitTask("Dependency", [&dependencyFinished](TaskBase*)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+		dependencyFinished = true;
+	});
+
+	std::vector<std::shared_ptr<TaskBase>> dependents;
+
+	for (uint32 i = 0u; i < 8u; i++)
+	{
+		dependents.push_back(threadPool.submitTask("Dependent", [&dependencyFinished, &dependentCount](TaskBase*) -> bool
+		{
+			dependentCount++;
+
+			return dependencyFinished;
+		}, { dependency }));
+	}
+
+	for (std::shared_ptr<TaskBase> const& dependent : dependents)
+	{
+		threadPool.waitTask(*dependent);
+
+		CHECK(TaskHelper::getResult<bool>(dependent.get()));
+	}
+
+	CHECK(dependentCount == 8u);
+
+	double wallDuration	= std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+	double cpuDuration	= static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+	//Workers sleep while the only queued tasks are not ready instead of spinning, so they use a fraction of a core while waiting.
+	//std::clock measures the process time on POSIX systems only
+#ifndef _WIN32
+	CHECK(cpuDuration < wallDuration * 0.5);
+#endif
+
+	return true;
+}
+
+#if KODGEN_COROUTINES
+
+CoroutineTask<int> addOne(IExecutor& executor, std::shared_ptr<TaskBase> valueTask)
+{
+	int value = co_await CoroutineHelper::awaitResult<int>(executor, std::move(valueTask));
+
+	co_return value + 1;
+}
+
+CoroutineTask<int> addOneToBoth(IExecutor& executor, std::shared_ptr<TaskBase> firstTask, std::shared_ptr<TaskBase> secondTask)
+{
+	//Nested coroutines run on the awaiting coroutine's executor
+	int first	= co_await addOne(executor, std::move(firstTask));
+	int second	= co_await addOne(executor, std::move(secondTask));
+
+	co_return first + second;
+}
+
+CoroutineTask<void> countOnExecutor(IExecutor& executor, std::atomic<uint32>& counter)
+{
+	co_await CoroutineHelper::schedule(executor, ETaskPriority::High);
+
+	counter++;
+}
+
+CoroutineTask<bool> awaitTask(IExecutor& executor, std::shared_ptr<TaskBase> task)
+{
+	co_return co_await CoroutineHelper::awaitTask(executor, std::move(task));
+}
+
+bool testCoroutines()
+{
+	ThreadPool threadPool(2u);
+
+	//Nested co_await and awaitResult
+	std::shared_ptr<TaskBase> firstTask		= threadPool.submitTask("First", [](TaskBase*) -> int { std::this_thread::sleep_for(std::chrono::milliseconds(20)); return 41; });
+	std::shared_ptr<TaskBase> secondTask	= threadPool.submitTask("Second", [](TaskBase*) -> int { return 1; });
+	std::shared_ptr<TaskBase> coroutineTask	= CoroutineHelper::submitCoroutine(threadPool, "Add one to both", addOneToBoth(threadPool, firstTask, secondTask));
+
+	threadPool.waitTask(*coroutineTask);
+
+	CHECK(!coroutineTask->wasCancelled());
+	CHECK(TaskHelper::getResult<int>(coroutineTask.get()) == 44);
+
+	//void coroutines finish their task too, so they can be the dependency of other tasks
+	std::atomic<uint32>			counter			= 0u;
+	std::shared_ptr<TaskBase>	voidTask		= CoroutineHelper::submitCoroutine(threadPool, "Count", countOnExecutor(threadPool, counter));
+	std::shared_ptr<TaskBase>	dependentTask	= threadPool.submitTask("Dependent", [&counter](TaskBase*) -> uint32 { return counter.load(); }, { voidTask });
+
+	threadPool.waitTask(*dependentTask);
+
+	CHECK(voidTask->hasFinished());
+	CHECK(TaskHelper::getResult<uint32>(dependentTask.get()) == 1u);
+
+	//Awaiting a cancelled task resumes the coroutine anyway
+	CancellationSource cancellationSource;
+
+	threadPool.setIsRunning(false);
+
+	std::shared_ptr<TaskBase> cancelledTask	= threadPool.submitTask("Cancelled", [](TaskBase*) -> int { return 0; }, {}, cancellationSource.getToken());
+	std::shared_ptr<TaskBase> awaitingTask	= CoroutineHelper::submitCoroutine(threadPool, "Await cancelled", awaitTask(threadPool, cancelledTask));
+
+	cancellationSource.cancel();
+	threadPool.setIsRunning(true);
+	threadPool.waitTask(*awaitingTask);
+
+	CHECK(cancelledTask->wasCancelled());
+	CHECK(!TaskHelper::getResult<bool>(awaitingTask.get()));
+
+	return true;
+}
+
+#endif
+
 int main()
 {
 	ThreadPool threadPool;
@@ -42,5 +403,18 @@ int main()
 	//A is not callable, doesn't compile
 	//auto t4 = threadPool.submitTask(A());
 
-	return EXIT_SUCCESS;
+	bool success = true;
+
+	success &= testBatchCoverage();
+	success &= testBatchResultsOrder();
+	success &= testNestedParallelFor();
+	success &= testPriorityOrder();
+	success &= testCancellation();
+	success &= testDependencyWait();
+
+#if KODGEN_COROUTINES
+	success &= testCoroutines();
+#endif
+
+	return success ? EXIT_SUCCESS : EXIT_FAILURE;
 }
\ No newline at end of file